@@ -30,8 +30,64 @@
  * 3. **Initialize the CLI**: Call `adi_cli_Init()` with the configuration to start the CLI.
  * 4. **Process Commands**: Use `adi_cli_GetCmd()` to retrieve user input, then `adi_cli_Dispatch()`
  * to execute commands.
- * 5. **Handle Callbacks**: Use `adi_cli_RxCallback()` and `adi_cli_TxCallback()` in your
- * communication event handlers.
+ * 5. **Handle Callbacks**: Use `adi_cli_RxCallback()` (or `adi_cli_RxBlockCallback()` in
+ * block receive mode) and `adi_cli_TxCallback()` in your communication event handlers.
+ *
+ * ## Binary Frames
+ * For bulk transfers the host can switch the CLI to binary frames with the internal `binary`
+ * command. Each frame is
+ *
+ * `sync | length (2) | command ID | arguments | CRC-16 (2)`
+ *
+ * - sync is #ADI_CLI_BINARY_SYNC.
+ * - length is the number of bytes of command ID and arguments.
+ * - command ID is the index of the command in the dispatch table given to `adi_cli_Dispatch()`.
+ * - arguments follow the parameter list of the command: 'd' and 'x' are 32-bit integers, 'f' is
+ *   an IEEE 754 single precision value, 'c' is one byte and 's' is a 16-bit length followed by
+ *   the characters.
+ * - The CRC is calculated with ADI_CLI_CONFIG.pfCalculateCrc over length, command ID and
+ *   arguments, as done by adi_crc_AddCCITT16.
+ *
+ * All multi-byte fields are little endian. The CLI answers every frame with a frame carrying the
+ * command ID and an #ADI_CLI_BINARY_STATUS byte, after any text printed by the command. A frame
+ * with command ID #ADI_CLI_BINARY_EXIT_ID returns the CLI to text mode. A frame, without the
+ * sync byte, must fit in APP_CFG_CLI_MAX_CMD_LENGTH bytes.
+ *
+ * Commands that return bulk data, for example the IIOD buffer engine, send it with
+ * `adi_cli_CommitBinaryFrame()` as frames of the same format carrying the command ID and the
+ * data. These frames come before the answer frame of the command.
+ *
+ * ## Resumable Commands
+ * A command with more output than fits the transmit segments, for example a memory dump, can
+ * send one part per call and return #CMD_IN_PROGRESS, keeping its progress in
+ * Args.resumeState. `adi_cli_GetCmd()` then calls it again with the same arguments each time
+ * the segment has room, until it returns another value. The prompt, or the answer frame in
+ * binary mode, follows the last part. String arguments point into the temporary memory, which
+ * must stay untouched until the command completes.
+ *
+ * ## Deferred Logging
+ * Built with ADI_CLI_DEFERRED_LOG defined, the INFO_MSG and CLI_*_MSG families of macros do not
+ * format on the device. Each call stores a record with the location of the format string as its
+ * ID and the raw arguments in a lock-free ring, ADI_CLI_CONFIG.pLogBuffer, which makes them
+ * cheap enough for interrupt context. `adi_cli_FlushMessages()` moves the records into binary
+ * frames with command ID #ADI_CLI_BINARY_LOG_ID, and the host looks up the format strings in the
+ * ELF file of the firmware to format them. The data of a frame is a 32-bit count of the records
+ * dropped because the ring was full, followed by records of 32-bit words:
+ *
+ * `header | format ID | arguments`
+ *
+ * - header holds the number of words of the record in bits 0 to 15, the #ADI_CLI_LOG_LEVEL in
+ *   bits 16 to 23 and #ADI_CLI_LOG_FLAG_TRUNCATED.
+ * - format ID is the address of the format string. With pointers wider than 32 bits, for example
+ *   in host builds, it is the signed 32-bit offset of the format string from
+ *   #adi_cli_LogFormatBase, so the format strings must be in the same image as the CLI service.
+ * - arguments follow the conversions of the format string: one word for integers up to 32 bits,
+ *   characters and `*` widths and precisions, two words, the low one first, for 64-bit integers
+ *   and for floating point values as IEEE 754 double precision, sizeof(void *) bytes, the low
+ *   word first, for pointers, and for strings a word with the number of characters followed by
+ *   the characters, padded to a word.
+ *
+ * Without a log buffer the macros format the messages as before.
  *
  * @{
  */
@@ -56,8 +112,10 @@ extern "C" {
  * The CLI service uses a handle (`ADI_CLI_HANDLE`) to keep track of its state. Pass this handle to
  * CLI API calls and the configuration (`ADI_CLI_CONFIG`) lets you set up how the CLI communicates
  * and which commands it supports.
- * @note Only a single CLI instance is supported. All memory provided to the CLI service must be
- * 32-bit aligned.
+ * @note Several CLI instances, for example one per UART, can run at the same time. Use
+ * #adi_cli_Print or the CLI_*_MSG macros to print to a given instance. The INFO_MSG family of
+ * macros prints to each instance set with #adi_cli_SetHandleTerminal. All memory provided to the
+ * CLI service must be 32-bit aligned.
  *
  * @brief CLI Service configuration structures and types.
  * @{
@@ -70,6 +128,128 @@ typedef int32_t (*ADI_CLI_TRANSMIT_ASYNC_FUNC)(void *, uint8_t *, uint32_t);
 /** Function pointer type for asynchronous receive. */
 typedef int32_t (*ADI_CLI_RECEIVE_ASYNC_FUNC)(void *, char *, uint32_t);
 
+/** Event flag set by #adi_cli_RxCallback and #adi_cli_RxBlockCallback, see #adi_cli_WaitEvent. */
+#define ADI_CLI_EVENT_RX (1u << 0)
+/** Event flag set by #adi_cli_TxCallback, see #adi_cli_WaitEvent. */
+#define ADI_CLI_EVENT_TX (1u << 1)
+
+/** Maximum number of transmit segments. */
+#ifndef ADI_CLI_MAX_TX_SEGMENTS
+#define ADI_CLI_MAX_TX_SEGMENTS 4
+#endif
+
+/**
+ * Transmit segment descriptor.
+ */
+typedef struct
+{
+    /** Pointer to the segment data. */
+    uint8_t *pData;
+    /** Number of bytes in the segment. */
+    uint32_t numBytes;
+} ADI_CLI_TX_SEGMENT;
+
+/** Function pointer type to calculate the CRC-16 of binary frames. */
+typedef uint32_t (*ADI_CLI_CALCULATE_CRC_FUNC)(uint8_t *, uint32_t);
+
+/** Sync byte that starts every binary frame. */
+#define ADI_CLI_BINARY_SYNC 0xA5u
+/** Command ID of the binary frame that returns the CLI to text mode. */
+#define ADI_CLI_BINARY_EXIT_ID 0xFFu
+/** Number of bytes of a binary frame before the arguments: sync, length and command ID. */
+#define ADI_CLI_BINARY_HEADER_NUM_BYTES 4u
+/** Number of bytes of the CRC at the end of a binary frame. */
+#define ADI_CLI_BINARY_CRC_NUM_BYTES 2u
+/** Command ID of the binary frames carrying deferred log records. */
+#define ADI_CLI_BINARY_LOG_ID 0xFEu
+
+/** Number of words of a log record before the arguments: header and format ID. */
+#define ADI_CLI_LOG_RECORD_HEADER_NUM_WORDS 2u
+/** Maximum number of words of the log ring, so that the records padding it up to its end fit the
+ * word count of the header. */
+#define ADI_CLI_LOG_MAX_BUFFER_NUM_WORDS 0x10000u
+/** Gets the number of words of a log record, header included, from its header word. */
+#define ADI_CLI_LOG_HEADER_NUM_WORDS(header) ((header)&0xFFFFu)
+/** Gets the #ADI_CLI_LOG_LEVEL of a log record from its header word. */
+#define ADI_CLI_LOG_HEADER_LEVEL(header) (((header) >> 16) & 0xFFu)
+/** Flag of the header word of a log record that holds only the first arguments or the first
+ * characters of a string. */
+#define ADI_CLI_LOG_FLAG_TRUNCATED (1u << 24)
+
+/**
+ * Levels of deferred log records, matching the message macros.
+ */
+typedef enum
+{
+    /** INFO_MSG_RAW, printed without new line. */
+    ADI_CLI_LOG_LEVEL_INFO_RAW = 0u,
+    /** INFO_MSG. */
+    ADI_CLI_LOG_LEVEL_INFO,
+    /** WARN_MSG. */
+    ADI_CLI_LOG_LEVEL_WARN,
+    /** ERROR_MSG. */
+    ADI_CLI_LOG_LEVEL_ERROR,
+    /** DEBUG_MSG. */
+    ADI_CLI_LOG_LEVEL_DEBUG,
+    /** DEBUG_MSG_RAW, printed without new line. */
+    ADI_CLI_LOG_LEVEL_DEBUG_RAW,
+    /** Number of levels. */
+    ADI_CLI_LOG_NUM_LEVELS
+} ADI_CLI_LOG_LEVEL;
+
+/** Base of the format IDs of log records when pointers are wider than 32 bits. The host adds the
+ * format ID, as a signed 32-bit value, to the address of this symbol in the ELF file to find the
+ * format string. */
+extern const char adi_cli_LogFormatBase[];
+
+/**
+ * Status returned in the answer to a binary frame.
+ */
+typedef enum
+{
+    /** Command executed successfully. */
+    ADI_CLI_BINARY_STATUS_SUCCESS = 0u,
+    /** Command function returned an error. */
+    ADI_CLI_BINARY_STATUS_COMMAND_FAILED,
+    /** Command ID is not in the dispatch table. */
+    ADI_CLI_BINARY_STATUS_INVALID_COMMAND,
+    /** Arguments do not match the parameter list of the command. */
+    ADI_CLI_BINARY_STATUS_INVALID_ARGUMENTS,
+    /** CRC of the frame does not match. */
+    ADI_CLI_BINARY_STATUS_CRC_ERROR
+} ADI_CLI_BINARY_STATUS;
+
+/** Function pointer type for asynchronous scatter-gather transmit. */
+typedef int32_t (*ADI_CLI_TRANSMIT_VECTOR_ASYNC_FUNC)(void *, ADI_CLI_TX_SEGMENT *, uint32_t);
+
+/**
+ * Receive modes of the CLI service.
+ */
+typedef enum
+{
+    /** pfReceiveAsync is armed for one byte at a time. The transport calls
+     * #adi_cli_RxCallback after every byte. */
+    ADI_CLI_RX_MODE_BYTE = 0u,
+    /** pfReceiveAsync is armed with the contiguous free span of the receive buffer. The
+     * transport fills the span directly (for example by DMA with idle line detection) and
+     * calls #adi_cli_RxBlockCallback with the number of bytes received. */
+    ADI_CLI_RX_MODE_BLOCK
+} ADI_CLI_RX_MODE;
+
+/**
+ * Line editing output modes of the CLI service.
+ */
+typedef enum
+{
+    /** After an edit in the middle of the line, the rest of the line is written again between
+     * a cursor save and restore. Works with any ANSI terminal. */
+    ADI_CLI_EDIT_MODE_REDRAW = 0u,
+    /** Edits in the middle of the line use the insert and delete character sequences
+     * (ESC [ @ and ESC [ P) of VT102 and later terminals, so the terminal shifts the rest of
+     * the line and only the edited characters are sent. Suits slow or remote consoles. */
+    ADI_CLI_EDIT_MODE_VT100
+} ADI_CLI_EDIT_MODE;
+
 /**
  * CLI configuration structure.
  */
@@ -81,9 +261,97 @@ typedef struct
     ADI_CLI_RECEIVE_ASYNC_FUNC pfReceiveAsync;
     /** User-defined handle for callback context. */
     void *hUser;
+    /** Receive mode. */
+    ADI_CLI_RX_MODE rxMode;
+    /** Receive buffer. Set to NULL to use the default buffer carved from state memory. Must be
+     * a power of two in size when CIRC_BUFF_POW2 is defined. */
+    uint8_t *pRxBuffer;
+    /** Size of the receive buffer in bytes. */
+    uint32_t rxBufferSize;
+    /** Transmit buffer. It is split into numTxSegments segments that are filled and queued
+     * for transmission in turn. Set to NULL to use the default buffer carved from state
+     * memory. */
+    uint8_t *pTxBuffer;
+    /** Size of the transmit buffer in bytes. */
+    uint32_t txBufferSize;
+    /** Number of transmit segments, from 2 to #ADI_CLI_MAX_TX_SEGMENTS. Set to 0 for 2. */
+    uint32_t numTxSegments;
+    /** Optional function pointer for asynchronous scatter-gather transmission. When set, all
+     * queued segments are handed to the transport in one call. Set to NULL to transmit one
+     * segment at a time through pfTransmitAsync. */
+    ADI_CLI_TRANSMIT_VECTOR_ASYNC_FUNC pfTransmitVectorAsync;
+    /** Optional function pointer to calculate the CRC-16 of binary frames, for example
+     * adi_crc_CalculateCCITT16. Binary frames are not available when set to NULL. */
+    ADI_CLI_CALCULATE_CRC_FUNC pfCalculateCrc;
+    /** Line editing output mode. */
+    ADI_CLI_EDIT_MODE editMode;
+    /** Free bytes of the transmit segment being filled needed before a command that returned
+     * #CMD_IN_PROGRESS is called again. Set to 0 to wait for an empty segment. */
+    uint32_t resumeNumBytes;
+    /** Ring of deferred log records, see #adi_cli_Log. Requires pfCalculateCrc and transmit
+     * segments that hold a binary frame of the largest record, #ADI_CLI_BINARY_HEADER_NUM_BYTES +
+     * #ADI_CLI_BINARY_CRC_NUM_BYTES + 4 * (1 + #ADI_CLI_LOG_RECORD_HEADER_NUM_WORDS +
+     * APP_CFG_CLI_LOG_MAX_ARG_WORDS) bytes. Set to NULL to format messages when they are
+     * logged. */
+    uint32_t *pLogBuffer;
+    /** Number of words of the log ring, a power of two of at least
+     * #ADI_CLI_LOG_RECORD_HEADER_NUM_WORDS + APP_CFG_CLI_LOG_MAX_ARG_WORDS and at most
+     * #ADI_CLI_LOG_MAX_BUFFER_NUM_WORDS. */
+    uint32_t logBufferNumWords;
+    /** Dispatch table of the application. Its sorted index is built by #adi_cli_Init instead
+     * of on the first dispatch, and TAB completes its commands. Set to NULL to build the index on
+     * the first dispatch and complete from the table last dispatched. */
+    const Command *pDispatchTable;
+    /** Number of records of pDispatchTable, at most APP_CFG_CLI_MAX_DISPATCH_RECORDS. */
+    int32_t numDispatchRecords;
 
 } ADI_CLI_CONFIG;
 
+#ifdef ADI_CLI_DEFERRED_LOG
+/** Logs Info  Message as such without new line */
+#define INFO_MSG_RAW(...) adi_cli_LogMessage(ADI_CLI_LOG_LEVEL_INFO_RAW, __VA_ARGS__);
+/** Logs Info  Message */
+#define INFO_MSG(...) adi_cli_LogMessage(ADI_CLI_LOG_LEVEL_INFO, __VA_ARGS__);
+/** Logs warn message */
+#define WARN_MSG(...) adi_cli_LogMessage(ADI_CLI_LOG_LEVEL_WARN, __VA_ARGS__);
+/** Logs error message */
+#define ERROR_MSG(...) adi_cli_LogMessage(ADI_CLI_LOG_LEVEL_ERROR, __VA_ARGS__);
+/** Logs debug message */
+#ifdef ENABLE_DEBUG
+#define DEBUG_MSG(...) adi_cli_LogMessage(ADI_CLI_LOG_LEVEL_DEBUG, __VA_ARGS__);
+#else
+#define DEBUG_MSG(...)
+#endif
+/** Logs debug message as such without new line */
+#ifdef ENABLE_DEBUG
+#define DEBUG_MSG_RAW(...) adi_cli_LogMessage(ADI_CLI_LOG_LEVEL_DEBUG_RAW, __VA_ARGS__);
+#else
+#define DEBUG_MSG_RAW(...) NULL
+#endif
+
+/** Logs Info  Message to a CLI instance as such without new line */
+#define CLI_INFO_MSG_RAW(hCli, ...) adi_cli_Log((hCli), ADI_CLI_LOG_LEVEL_INFO_RAW, __VA_ARGS__);
+/** Logs Info  Message to a CLI instance */
+#define CLI_INFO_MSG(hCli, ...) adi_cli_Log((hCli), ADI_CLI_LOG_LEVEL_INFO, __VA_ARGS__);
+/** Logs warn message to a CLI instance */
+#define CLI_WARN_MSG(hCli, ...) adi_cli_Log((hCli), ADI_CLI_LOG_LEVEL_WARN, __VA_ARGS__);
+/** Logs error message to a CLI instance */
+#define CLI_ERROR_MSG(hCli, ...) adi_cli_Log((hCli), ADI_CLI_LOG_LEVEL_ERROR, __VA_ARGS__);
+/** Logs debug message to a CLI instance */
+#ifdef ENABLE_DEBUG
+#define CLI_DEBUG_MSG(hCli, ...) adi_cli_Log((hCli), ADI_CLI_LOG_LEVEL_DEBUG, __VA_ARGS__);
+#else
+#define CLI_DEBUG_MSG(hCli, ...)
+#endif
+/** Logs debug message to a CLI instance as such without new line */
+#ifdef ENABLE_DEBUG
+#define CLI_DEBUG_MSG_RAW(hCli, ...) adi_cli_Log((hCli), ADI_CLI_LOG_LEVEL_DEBUG_RAW, __VA_ARGS__);
+#else
+#define CLI_DEBUG_MSG_RAW(hCli, ...)
+#endif
+
+#else
+
 /** Prints Info  Message as such without new line */
 #define INFO_MSG_RAW(...) adi_cli_PrintMessage("RAW", __VA_ARGS__);
 /** Prints Info  Message */
@@ -105,6 +373,28 @@ typedef struct
 #define DEBUG_MSG_RAW(...) NULL
 #endif
 
+/** Prints Info  Message to a CLI instance as such without new line */
+#define CLI_INFO_MSG_RAW(hCli, ...) adi_cli_Print((hCli), "RAW", __VA_ARGS__);
+/** Prints Info  Message to a CLI instance */
+#define CLI_INFO_MSG(hCli, ...) adi_cli_Print((hCli), "", __VA_ARGS__);
+/** Prints warn message to a CLI instance */
+#define CLI_WARN_MSG(hCli, ...) adi_cli_Print((hCli), "Warn : ", __VA_ARGS__);
+/** Prints error message to a CLI instance */
+#define CLI_ERROR_MSG(hCli, ...) adi_cli_Print((hCli), "Error : ", __VA_ARGS__);
+/** Prints debug message to a CLI instance */
+#ifdef ENABLE_DEBUG
+#define CLI_DEBUG_MSG(hCli, ...) adi_cli_Print((hCli), "Debug : ", __VA_ARGS__);
+#else
+#define CLI_DEBUG_MSG(hCli, ...)
+#endif
+/** Prints debug message to a CLI instance as such without new line */
+#ifdef ENABLE_DEBUG
+#define CLI_DEBUG_MSG_RAW(hCli, ...) adi_cli_Print((hCli), "DBGRAW", __VA_ARGS__);
+#else
+#define CLI_DEBUG_MSG_RAW(hCli, ...)
+#endif
+#endif /* ADI_CLI_DEFERRED_LOG */
+
 /** @} */
 
 /** @defgroup CLIAPI Service API
@@ -115,12 +405,17 @@ typedef struct
 
 /**
  * @brief Creates and initializes the CLI service instance.
- * @details Allocates memory and sets up internal structures for the CLI service.
+ * @details Allocates memory and sets up internal structures for the CLI service. The instance is
+ * added to the list walked by the INFO_MSG family of macros, so this function must not be called
+ * concurrently with itself.
  *
  * @param[out] phCli           - Pointer to the CLI handle location.
  * @param[in]  pStateMemory    - Pointer to persistent state memory (must be 32-bit aligned).
- * @param[in]  stateMemorySize - Size of the state memory in bytes (minimum:
- *                                #ADI_CLI_STATE_MEM_NUM_BYTES).
+ * @param[in]  stateMemorySize - Size of the state memory in bytes. With
+ *                                #ADI_CLI_STATE_MEM_NUM_BYTES the default receive and transmit
+ *                                buffers are carved from it. With at least
+ *                                #ADI_CLI_STATE_MEM_BASE_NUM_BYTES the buffers must be provided
+ *                                through #ADI_CLI_CONFIG.
  * @param[in]  pTempMemory     - Pointer to temporary memory (must be 32-bit aligned).
  * @param[in]  tempMemorySize  - Size of the temporary memory in bytes (minimum:
  *                                #ADI_CLI_TEMP_MEM_NUM_BYTES).
@@ -135,10 +430,19 @@ ADI_CLI_STATUS adi_cli_Create(ADI_CLI_HANDLE *phCli, void *pStateMemory, uint32_
 
 /**
  * @brief Initializes the CLI Service and starts receiving data from the terminal.
- * @details This function must be called after creating the CLI instance with `adi_cli_Create()`
+ * @details This function must be called after creating the CLI instance with `adi_cli_Create()`.
+ * The RTOS mutex and event flags are created by the first call and kept by later calls.
  * @param[in]  hCli    - Handle to the CLI instance.
  * @param[in]  pConfig - Pointer to the CLI configuration structure.
  * @return     #ADI_CLI_STATUS_SUCCESS on success,
+ *             #ADI_CLI_STATUS_INSUFFICIENT_STATE_MEMORY if a buffer is neither provided nor
+ *             available from state memory,
+ *             #ADI_CLI_STATUS_INVALID_ARGUMENT if the log ring is not a power of two, too
+ *             small, too large or given without pfCalculateCrc, if the log ring is given with
+ *             transmit segments too small for a binary frame of the largest log record, or if
+ *             the dispatch table has more than APP_CFG_CLI_MAX_DISPATCH_RECORDS records,
+ *             #ADI_CLI_STATUS_INIT_FAILED if the RTOS could not create the mutex or event flags
+ *             of the handle,
  *             #ADI_CLI_STATUS_COMM_ERROR on communication error.
  */
 ADI_CLI_STATUS adi_cli_Init(ADI_CLI_HANDLE hCli, ADI_CLI_CONFIG *pConfig);
@@ -147,9 +451,12 @@ ADI_CLI_STATUS adi_cli_Init(ADI_CLI_HANDLE hCli, ADI_CLI_CONFIG *pConfig);
  * @brief Retrieves a command from the CLI input buffer.
  * @param[in] hCli Handle to the CLI instance.
  * @param[out] pCommand Pointer to the buffer where the command will be stored.
+ * @details While a command that returned #CMD_IN_PROGRESS is running, no input is read and the
+ * command is called again if the transmit segment has room, see ADI_CLI_CONFIG.resumeNumBytes.
  * @return  #ADI_CLI_STATUS_SUCCESS on success,
  *          #ADI_CLI_STATUS_NULL_PTR if hCli or pCommand is NULL,
- *          #ADI_CLI_STATUS_INVALID_COMMAND on invalid command.
+ *          #ADI_CLI_STATUS_INVALID_COMMAND on invalid command,
+ *          #ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS while a command is running.
  */
 ADI_CLI_STATUS adi_cli_GetCmd(ADI_CLI_HANDLE hCli, char *pCommand);
 
@@ -161,7 +468,9 @@ ADI_CLI_STATUS adi_cli_GetCmd(ADI_CLI_HANDLE hCli, char *pCommand);
  * @param[in] numRecords     - Number of commands in the dispatch table.
  * @return  #ADI_CLI_STATUS_SUCCESS on success,
  *          #ADI_CLI_STATUS_NULL_PTR if hCli, pCommand or pDispatchTable is NULL,
- *          #ADI_CLI_STATUS_INVALID_COMMAND on invalid command.
+ *          #ADI_CLI_STATUS_INVALID_COMMAND on invalid command,
+ *          #ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS if a command is still running, the command
+ *          is not dispatched.
  */
 ADI_CLI_STATUS adi_cli_Dispatch(ADI_CLI_HANDLE hCli, char *pCommand, const Command *pDispatchTable,
                                 int32_t numRecords);
@@ -176,9 +485,26 @@ ADI_CLI_STATUS adi_cli_Dispatch(ADI_CLI_HANDLE hCli, char *pCommand, const Comma
  */
 ADI_CLI_STATUS adi_cli_RxCallback(ADI_CLI_HANDLE hCli);
 
+/**
+ * @brief CLI block receive callback handler.
+ * @details Should be called by the user in #ADI_CLI_RX_MODE_BLOCK when the transport has
+ * finished a reception into the span given to pfReceiveAsync, either because the span is full
+ * or because the line went idle. The received bytes are made available to the CLI and the
+ * next free span is armed. If the receive buffer is full, reception resumes from
+ * #adi_cli_GetCmd once space is available.
+ * @param[in]  hCli     - Handle to the CLI instance.
+ * @param[in]  numBytes - Number of bytes written into the span.
+ * @return     #ADI_CLI_STATUS_SUCCESS on success,
+ *             #ADI_CLI_STATUS_NULL_PTR if hCli is NULL,
+ *             #ADI_CLI_STATUS_BUFFER_FULL if numBytes is more than the armed span,
+ *             #ADI_CLI_STATUS_COMM_ERROR on communication error.
+ */
+ADI_CLI_STATUS adi_cli_RxBlockCallback(ADI_CLI_HANDLE hCli, uint32_t numBytes);
+
 /**
  * @brief CLI transmit callback handler.
- * @details Should be called by the user when a transmit event occurs.
+ * @details Should be called by the user when a transmit event occurs. The completed segments
+ * are released and the next queued segments, if any, are transmitted.
  * @param[in]  hCli - Handle to the CLI instance.
  * @return     #ADI_CLI_STATUS_SUCCESS on success,
  *             #ADI_CLI_STATUS_NULL_PTR if hCli is NULL.
@@ -188,6 +514,9 @@ ADI_CLI_STATUS adi_cli_TxCallback(ADI_CLI_HANDLE hCli);
 
 /**
  * @brief Flushes the CLI message buffer, ensuring all pending messages are transmitted.
+ * @details The complete records of the log ring are moved to the segment being filled with
+ * #adi_cli_FlushLog. The segment is then queued for transmission if a free segment is available
+ * to continue filling, and transmission is started if the transport is idle.
  * @param[in] hCli - Handle to the CLI instance.
  * @return    #ADI_CLI_STATUS_SUCCESS on success,
  *            #ADI_CLI_STATUS_NULL_PTR if hCli is NULL,
@@ -213,14 +542,97 @@ ADI_CLI_STATUS adi_cli_DisplayPrompt(ADI_CLI_HANDLE hCli);
 ADI_CLI_STATUS adi_cli_NewLine(ADI_CLI_HANDLE hCli);
 
 /**
- * @details Stores the messages in the CLI buffer.
+ * @details Stores the messages in the buffer of each CLI instance set with
+ * #adi_cli_SetHandleTerminal.
  * @param[in] pMsgType - Type of message to be printed
  * @param[in] pFormat  - Format specifier for the message
- * @return status      - SUCCESS - 0
+ * @return status      - SUCCESS - 0, if any instance stored the message
  *                     - FAILURE - 1
  */
 int32_t adi_cli_PrintMessage(char *pMsgType, char *pFormat, ...);
 
+/**
+ * @brief Formats a message directly into the transmit buffer of a CLI instance.
+ * @details The message type is written as a prefix and a new line as a suffix, except for the
+ * "RAW" and "DBGRAW" types which are written as such. The message is formatted once into the
+ * free space of the transmit buffer. A message that does not fit completely is discarded.
+ * @param[in] hCli     - Handle to the CLI instance.
+ * @param[in] pMsgType - Type of message to be printed.
+ * @param[in] pFormat  - Format specifier for the message.
+ * @return  #ADI_CLI_STATUS_SUCCESS on success,
+ *          #ADI_CLI_STATUS_NULL_PTR if a pointer is NULL,
+ *          #ADI_CLI_STATUS_BUFFER_FULL if the message does not fit in the buffer.
+ */
+ADI_CLI_STATUS adi_cli_Print(ADI_CLI_HANDLE hCli, const char *pMsgType, const char *pFormat, ...);
+
+/**
+ * @brief Formats a message directly into the transmit buffer of a CLI instance.
+ * @details Same as #adi_cli_Print with the arguments given as a va_list.
+ * @param[in] hCli     - Handle to the CLI instance.
+ * @param[in] pMsgType - Type of message to be printed.
+ * @param[in] pFormat  - Format specifier for the message.
+ * @param[in] pArgs    - Arguments for the format specifier.
+ * @return  #ADI_CLI_STATUS_SUCCESS on success,
+ *          #ADI_CLI_STATUS_NULL_PTR if a pointer is NULL,
+ *          #ADI_CLI_STATUS_BUFFER_FULL if the message does not fit in the buffer.
+ */
+ADI_CLI_STATUS adi_cli_VPrint(ADI_CLI_HANDLE hCli, const char *pMsgType, const char *pFormat,
+                              va_list pArgs);
+
+/**
+ * @brief Stores a message in the log ring of a CLI instance without formatting it.
+ * @details The record holds the address of pFormat and the arguments, see Deferred Logging.
+ * pFormat must therefore be a string literal or otherwise stay in the firmware image. Only
+ * the types of the conversions are read from it. No lock is taken, so it may be called from
+ * interrupt context. Without ADI_CLI_CONFIG.pLogBuffer the message is printed as with
+ * #adi_cli_Print.
+ * @param[in] hCli     - Handle to the CLI instance.
+ * @param[in] level    - Level of the message.
+ * @param[in] pFormat  - Format specifier for the message.
+ * @return  #ADI_CLI_STATUS_SUCCESS on success,
+ *          #ADI_CLI_STATUS_NULL_PTR if a pointer is NULL,
+ *          #ADI_CLI_STATUS_INVALID_ARGUMENT if level is not an #ADI_CLI_LOG_LEVEL,
+ *          #ADI_CLI_STATUS_BUFFER_FULL if the record was dropped because the ring is full.
+ */
+ADI_CLI_STATUS adi_cli_Log(ADI_CLI_HANDLE hCli, ADI_CLI_LOG_LEVEL level, const char *pFormat,
+                           ...);
+
+/**
+ * @brief Stores a message in the log ring of a CLI instance without formatting it.
+ * @details Same as #adi_cli_Log with the arguments given as a va_list.
+ * @param[in] hCli     - Handle to the CLI instance.
+ * @param[in] level    - Level of the message.
+ * @param[in] pFormat  - Format specifier for the message.
+ * @param[in] pArgs    - Arguments for the format specifier.
+ * @return  #ADI_CLI_STATUS_SUCCESS on success,
+ *          #ADI_CLI_STATUS_NULL_PTR if a pointer is NULL,
+ *          #ADI_CLI_STATUS_INVALID_ARGUMENT if level is not an #ADI_CLI_LOG_LEVEL,
+ *          #ADI_CLI_STATUS_BUFFER_FULL if the record was dropped because the ring is full.
+ */
+ADI_CLI_STATUS adi_cli_VLog(ADI_CLI_HANDLE hCli, ADI_CLI_LOG_LEVEL level, const char *pFormat,
+                            va_list pArgs);
+
+/**
+ * @brief Stores a message in the log ring of each instance set with #adi_cli_SetHandleTerminal.
+ * @details Used by the INFO_MSG family of macros when ADI_CLI_DEFERRED_LOG is defined.
+ * @param[in] level    - Level of the message.
+ * @param[in] pFormat  - Format specifier for the message.
+ * @return  the first status of #adi_cli_Log other than #ADI_CLI_STATUS_SUCCESS,
+ *          #ADI_CLI_STATUS_NULL_PTR if no instance is set.
+ */
+ADI_CLI_STATUS adi_cli_LogMessage(ADI_CLI_LOG_LEVEL level, const char *pFormat, ...);
+
+/**
+ * @brief Moves the complete records of the log ring into binary frames with command ID
+ * #ADI_CLI_BINARY_LOG_ID in the transmit segment being filled.
+ * @details Called by #adi_cli_FlushMessages. Records that do not fit stay in the ring for the
+ * next call.
+ * @param[in] hCli - Handle to the CLI instance.
+ * @return  #ADI_CLI_STATUS_SUCCESS on success, also without log ring,
+ *          #ADI_CLI_STATUS_NULL_PTR if hCli is NULL.
+ */
+ADI_CLI_STATUS adi_cli_FlushLog(ADI_CLI_HANDLE hCli);
+
 /**
  * @brief Gets the number of characters waiting in the CLI receive buffer.
  * @param[in]  hCli      - Handle to the CLI instance.
@@ -232,10 +644,10 @@ int32_t adi_cli_PrintMessage(char *pMsgType, char *pFormat, ...);
 ADI_CLI_STATUS adi_cli_GetNumCharsWaiting(ADI_CLI_HANDLE hCli, int32_t *pNumChars);
 
 /**
- * @brief Sets the handle for the terminal interface.
- * @details This handle is required for storing messages in the CLI buffer. Before using message
- * macros such as INFO_MSG, WARN_MSG, or ERROR_MSG, the user must call this function to set the CLI
- * handle for terminal output.
+ * @brief Sets a CLI instance as a terminal interface.
+ * @details Message macros such as INFO_MSG, WARN_MSG, or ERROR_MSG print to every instance set
+ * here, each in its own buffer. Before using them, the user must call this function for at least
+ * one instance. The setting is kept in the instance and cleared by #adi_cli_Create.
  * @param[in]  hCli - Handle to the CLI instance.
  * @return     #ADI_CLI_STATUS_SUCCESS on success,
  *             #ADI_CLI_STATUS_NULL_PTR if hCli is NULL.
@@ -288,6 +700,84 @@ ADI_CLI_STATUS adi_cli_PutBuffer(ADI_CLI_HANDLE hCli, uint8_t *pData, uint32_t n
  */
 ADI_CLI_STATUS adi_cli_GetFreeMessageSpace(ADI_CLI_HANDLE hCli, uint32_t *pFreeSpace);
 
+/**
+ * @brief Gets the free space of the transmit segment being filled, so that data can be written
+ * to it in place instead of being copied with #adi_cli_PutBuffer.
+ * @details The space is valid until the next call that prints to or flushes the CLI. Call
+ * #adi_cli_FlushMessages to queue the segment and continue in the next one when the space is
+ * too small. If other threads print to the CLI, hold #adi_cli_Lock until the space is
+ * committed.
+ * @param[in]   hCli      - Handle to the CLI instance.
+ * @param[out]  ppData    - Pointer to store the start of the free space.
+ * @param[out]  pNumBytes - Pointer to store the number of free bytes.
+ * @return     #ADI_CLI_STATUS_SUCCESS on success,
+ *             #ADI_CLI_STATUS_NULL_PTR if a pointer is NULL.
+ */
+ADI_CLI_STATUS adi_cli_GetTxSpace(ADI_CLI_HANDLE hCli, uint8_t **ppData, uint32_t *pNumBytes);
+
+/**
+ * @brief Adds bytes written to the space from #adi_cli_GetTxSpace to the transmit segment.
+ * @param[in]  hCli     - Handle to the CLI instance.
+ * @param[in]  numBytes - Number of bytes written.
+ * @return     #ADI_CLI_STATUS_SUCCESS on success,
+ *             #ADI_CLI_STATUS_NULL_PTR if hCli is NULL,
+ *             #ADI_CLI_STATUS_BUFFER_FULL if numBytes is more than the free space.
+ */
+ADI_CLI_STATUS adi_cli_CommitTx(ADI_CLI_HANDLE hCli, uint32_t numBytes);
+
+/**
+ * @brief Completes a binary frame in the space from #adi_cli_GetTxSpace and adds it to the
+ * transmit segment.
+ * @details The data must be written #ADI_CLI_BINARY_HEADER_NUM_BYTES bytes after the start of
+ * the space. The header and the CRC are filled in, so the frame takes
+ * numBytes + #ADI_CLI_BINARY_HEADER_NUM_BYTES + #ADI_CLI_BINARY_CRC_NUM_BYTES bytes.
+ * @param[in]  hCli     - Handle to the CLI instance.
+ * @param[in]  cmdId    - Command ID of the frame.
+ * @param[in]  numBytes - Number of data bytes, at most 0xFFFE.
+ * @return     #ADI_CLI_STATUS_SUCCESS on success,
+ *             #ADI_CLI_STATUS_NULL_PTR if hCli or ADI_CLI_CONFIG.pfCalculateCrc is NULL,
+ *             #ADI_CLI_STATUS_INVALID_ARGUMENT if numBytes does not fit the length field,
+ *             #ADI_CLI_STATUS_BUFFER_FULL if the frame is larger than the free space.
+ */
+ADI_CLI_STATUS adi_cli_CommitBinaryFrame(ADI_CLI_HANDLE hCli, uint8_t cmdId, uint32_t numBytes);
+
+/**
+ * @brief Locks the transmit segments of the CLI against other threads.
+ * @details With CMSIS_OS2 defined every call that prints to or flushes the CLI takes a recursive
+ * mutex of the handle, so messages of several threads do not mix. Take it explicitly to keep a
+ * sequence of calls together, for example #adi_cli_GetTxSpace up to #adi_cli_CommitTx. Without
+ * CMSIS_OS2 nothing is locked.
+ * @param[in]  hCli - Handle to the CLI instance.
+ * @return     #ADI_CLI_STATUS_SUCCESS on success,
+ *             #ADI_CLI_STATUS_NULL_PTR if hCli is NULL.
+ */
+ADI_CLI_STATUS adi_cli_Lock(ADI_CLI_HANDLE hCli);
+
+/**
+ * @brief Releases the lock taken with #adi_cli_Lock.
+ * @param[in]  hCli - Handle to the CLI instance.
+ * @return     #ADI_CLI_STATUS_SUCCESS on success,
+ *             #ADI_CLI_STATUS_NULL_PTR if hCli is NULL.
+ */
+ADI_CLI_STATUS adi_cli_Unlock(ADI_CLI_HANDLE hCli);
+
+#ifdef CMSIS_OS2
+/**
+ * @brief Blocks the calling thread until a receive or transmit callback signals, instead of
+ * polling #adi_cli_GetNumCharsWaiting.
+ * @param[in]  hCli    - Handle to the CLI instance.
+ * @param[in]  events  - Events to wait for, #ADI_CLI_EVENT_RX and/or #ADI_CLI_EVENT_TX.
+ * @param[in]  timeout - Timeout in RTOS ticks, osWaitForever to wait without a timeout.
+ * @param[out] pEvents - Pointer to store the events that occurred, which are cleared, or 0 on
+ * timeout.
+ * @return     #ADI_CLI_STATUS_SUCCESS on an event or timeout,
+ *             #ADI_CLI_STATUS_NULL_PTR if hCli or pEvents is NULL,
+ *             #ADI_CLI_STATUS_COMM_ERROR if the event flags could not be waited for.
+ */
+ADI_CLI_STATUS adi_cli_WaitEvent(ADI_CLI_HANDLE hCli, uint32_t events, uint32_t timeout,
+                                 uint32_t *pEvents);
+#endif
+
 /**
  * @brief Gets the handle for dispatching internal commands.
  * @details This function returns a pointer to the CLI interface data structure used for dispatching
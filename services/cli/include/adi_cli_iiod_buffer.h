@@ -0,0 +1,197 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ *  @file        adi_cli_iiod_buffer.h
+ *  @brief       Buffer engine streaming the samples of an IIOD device.
+ *
+ * The acquisition writes raw samples in place into a ring provided by the application. A raw
+ * sample holds one int32_t per channel of the device, in the order of
+ * DeviceAttributes.channels. The channels enabled by the mask of the `open` command are packed
+ * in scan_index order according to their scanType, as expected by libiio, and streamed for
+ * `readbuf` as binary frames through the CLI transmit segments.
+ *
+ * Typical use:
+ * 1. `adi_cli_IiodBufferInit()` with the device and the ring.
+ * 2. `adi_cli_IiodBufferOpen()` with the channel mask of `open`.
+ * 3. The acquisition writes samples to the space from `adi_cli_IiodBufferGetWriteBlock()` and
+ *    calls `adi_cli_IiodBufferCommitWrite()`.
+ * 4. `adi_cli_IiodBufferRead()` with the bytes_count of `readbuf`, then
+ *    `adi_cli_IiodBufferStream()` until it returns #ADI_CLI_STATUS_SUCCESS.
+ * 5. `adi_cli_IiodBufferClose()` for `close`.
+ * @{
+ */
+
+#ifndef __ADI_CLI_IIOD_BUFFER_H__
+#define __ADI_CLI_IIOD_BUFFER_H__
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_cli.h"
+#include "adi_cli_iiod_xml.h"
+#include "adi_cli_status.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= D E F I N E S =============*/
+
+/** Maximum number of channels of a device, one per bit of the channel mask */
+#define ADI_CLI_IIOD_BUFFER_MAX_CHANNELS 32
+/** Maximum number of raw samples of the ring, so that the counts wrapping at twice the size fit
+ * 32 bits */
+#define ADI_CLI_IIOD_BUFFER_MAX_RING_SAMPLES 0x80000000u
+
+/*============= D A T A  T Y P E S =============*/
+
+/**
+ * @struct IioScanElement
+ * @brief Packing of one enabled channel, derived from its scanType.
+ */
+typedef struct
+{
+    /** Mask of the realbits of the raw sample */
+    uint32_t mask;
+    /** Offset of the channel in a packed sample */
+    uint16_t offset;
+    /** Index of the channel in a raw sample */
+    uint8_t channel;
+    /** Number of bytes of storage */
+    uint8_t numBytes;
+    /** Number of bits the value is shifted left in the storage */
+    uint8_t shift;
+    /** True if stored big endian */
+    bool isBigEndian;
+} IioScanElement;
+
+/**
+ * @struct IioBuffer
+ * @brief Structure holding the state of the buffer of an IIOD device.
+ */
+typedef struct
+{
+    /** Device whose channels are buffered */
+    DeviceAttributes *pDevice;
+    /** Ring of raw samples */
+    int32_t *pRing;
+    /** Number of raw samples of the ring */
+    uint32_t ringNumSamples;
+    /** Count of samples written, wrapping at 2 * ringNumSamples. Written only by the
+     * acquisition. */
+    volatile uint32_t head;
+    /** Count of samples streamed, wrapping at 2 * ringNumSamples. Written only by the stream. */
+    volatile uint32_t tail;
+    /** Enabled channels in scan_index order */
+    IioScanElement elements[ADI_CLI_IIOD_BUFFER_MAX_CHANNELS];
+    /** Number of enabled channels */
+    uint32_t numElements;
+    /** Number of bytes of a packed sample */
+    uint32_t sampleNumBytes;
+    /** Set when a packed sample has padding between channels */
+    bool hasPadding;
+    /** Set between #adi_cli_IiodBufferOpen and #adi_cli_IiodBufferClose */
+    bool isOpen;
+    /** Number of bytes of the current read still to be streamed */
+    uint32_t numBytesLeft;
+    /** Command ID of the data frames of the current read */
+    uint8_t cmdId;
+} IioBuffer;
+
+/*============= F U N C T I O N  P R O T O T Y P E S =============*/
+
+/**
+ * @brief Initialises the buffer of a device.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param pDevice - Pointer to the device attributes.
+ * @param pRing - Pointer to the ring, ringNumSamples * numChannel words.
+ * @param ringNumSamples - Number of raw samples of the ring, any size up to
+ * #ADI_CLI_IIOD_BUFFER_MAX_RING_SAMPLES.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_NULL_PTR if a pointer is NULL,
+ *         #ADI_CLI_STATUS_INVALID_ARGUMENT if the device has no channels or more than
+ *         #ADI_CLI_IIOD_BUFFER_MAX_CHANNELS, or the ring is empty or too large.
+ */
+ADI_CLI_STATUS adi_cli_IiodBufferInit(IioBuffer *pBuffer, DeviceAttributes *pDevice,
+                                      int32_t *pRing, uint32_t ringNumSamples);
+
+/**
+ * @brief Enables the channels of the mask of the `open` command and empties the ring.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param mask - Bit n enables channel n of DeviceAttributes.channels.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_NULL_PTR if pBuffer is NULL,
+ *         #ADI_CLI_STATUS_INVALID_ARGUMENT if no channel is enabled, an enabled channel has no
+ *         scan type, or a scan type does not fit 32 bits of storage in whole bytes.
+ */
+ADI_CLI_STATUS adi_cli_IiodBufferOpen(IioBuffer *pBuffer, uint32_t mask);
+
+/**
+ * @brief Stops the buffer. Samples committed afterwards are dropped.
+ * @param pBuffer - Pointer to the buffer state.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_NULL_PTR if pBuffer is NULL.
+ */
+ADI_CLI_STATUS adi_cli_IiodBufferClose(IioBuffer *pBuffer);
+
+/**
+ * @brief Gets the contiguous free space of the ring, for the acquisition to write raw samples
+ * in place.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param[out] ppSamples - Pointer to store the start of the space.
+ * @param[out] pNumSamples - Pointer to store the number of raw samples that fit.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_NULL_PTR if a pointer is NULL,
+ *         #ADI_CLI_STATUS_BUFFER_FULL if the ring is full or the buffer is not open.
+ */
+ADI_CLI_STATUS adi_cli_IiodBufferGetWriteBlock(IioBuffer *pBuffer, int32_t **ppSamples,
+                                               uint32_t *pNumSamples);
+
+/**
+ * @brief Adds samples written to the space from #adi_cli_IiodBufferGetWriteBlock to the ring.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param numSamples - Number of raw samples written.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_NULL_PTR if pBuffer is NULL,
+ *         #ADI_CLI_STATUS_BUFFER_FULL if numSamples is more than the free space.
+ */
+ADI_CLI_STATUS adi_cli_IiodBufferCommitWrite(IioBuffer *pBuffer, uint32_t numSamples);
+
+/**
+ * @brief Starts a read of the `readbuf` command. The number of bytes is rounded down to whole
+ * packed samples.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param numBytes - Number of bytes requested.
+ * @param cmdId - Command ID of the data frames, the index of `readbuf` in the dispatch table.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_NULL_PTR if pBuffer is NULL,
+ *         #ADI_CLI_STATUS_INVALID_COMMAND if the buffer is not open.
+ */
+ADI_CLI_STATUS adi_cli_IiodBufferRead(IioBuffer *pBuffer, uint32_t numBytes, uint8_t cmdId);
+
+/**
+ * @brief Packs the samples of the ring directly into the transmit segments of the CLI, one
+ * binary frame per segment, and queues them for transmission. Returns when the ring is empty or
+ * all segments are queued, so call it again, for example after #adi_cli_TxCallback or new
+ * samples, until the read completes.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param hCli - Handle to the CLI instance.
+ * @return #ADI_CLI_STATUS_SUCCESS when all bytes of the read are queued,
+ *         #ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS if bytes are left,
+ *         #ADI_CLI_STATUS_NULL_PTR if a pointer or ADI_CLI_CONFIG.pfCalculateCrc is NULL,
+ *         #ADI_CLI_STATUS_BUFFER_FULL if a transmit segment cannot hold one packed sample,
+ *         #ADI_CLI_STATUS_COMM_ERROR if the transmission could not be started.
+ */
+ADI_CLI_STATUS adi_cli_IiodBufferStream(IioBuffer *pBuffer, ADI_CLI_HANDLE hCli);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_CLI_IIOD_BUFFER_H__ */
+/**
+ * @}
+ */
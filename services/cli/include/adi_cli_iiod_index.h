@@ -0,0 +1,164 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ *  @file        adi_cli_iiod_index.h
+ *  @brief       Hashed lookup of the attributes addressed by IIOD read and write commands.
+ *
+ * The index is built once when the context is registered and maps (device, channel, attribute
+ * name) to the AttributeType, so a lookup hashes the names of the command instead of comparing
+ * them with every attribute of the device. Build it again after the attributes of the context
+ * change.
+ *
+ * `adi_cli_ReadIiodAttributes()` answers the `readmulti` command from the index, so that
+ * several attributes are read with one command and one response.
+ * @{
+ */
+
+#ifndef __ADI_CLI_IIOD_INDEX_H__
+#define __ADI_CLI_IIOD_INDEX_H__
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_cli.h"
+#include "adi_cli_iiod_xml.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= D E F I N E S =============*/
+
+/** Channel of the device attributes */
+#define IIOD_CHANNEL_DEVICE (-1)
+/** Channel of the debug attributes */
+#define IIOD_CHANNEL_DEBUG (-2)
+/** Channel of the buffer attributes */
+#define IIOD_CHANNEL_BUFFER (-3)
+
+/*============= D A T A  T Y P E S =============*/
+
+/**
+ * @struct IioAttrEntry
+ * @brief Slot of the index.
+ */
+typedef struct
+{
+    /** Attribute, NULL if the slot is empty */
+    AttributeType *pAttribute;
+    /** Hash of device index, channel and attribute name */
+    uint32_t hash;
+    /** Index of the channel in DeviceAttributes.channels, or one of IIOD_CHANNEL_DEVICE,
+     * IIOD_CHANNEL_DEBUG and IIOD_CHANNEL_BUFFER */
+    int16_t channel;
+    /** Index of the device in IioDesc.pDeviceParams */
+    uint16_t device;
+} IioAttrEntry;
+
+/**
+ * @struct IioAttrIndex
+ * @brief Structure holding the index of the attributes of a context.
+ */
+typedef struct
+{
+    /** Context indexed */
+    IioDesc *pIioDesc;
+    /** Slots, open addressing with linear probing */
+    IioAttrEntry *pEntries;
+    /** Number of slots, a power of two */
+    uint32_t numEntries;
+    /** Number of attributes of the context */
+    uint32_t numAttributes;
+} IioAttrIndex;
+
+/**
+ * @brief Function pointer type to read the value of an attribute.
+ * @param hUser - user handle given to #adi_cli_ReadIiodAttributes
+ * @param pEntry - slot of the attribute, with the AttributeType, device and channel
+ * @param pValue - buffer for the value, without terminating null character
+ * @param size - size of the buffer
+ * @return number of characters of the value or negative error code
+ */
+typedef int32_t (*IIOD_SHOW_FUNC)(void *hUser, IioAttrEntry *pEntry, char *pValue, uint32_t size);
+
+/*============= F U N C T I O N  P R O T O T Y P E S =============*/
+
+/**
+ * @brief Builds the index of all device, channel, debug and buffer attributes of a context.
+ * When an attribute name repeats within a device and channel, the first one is kept, as with
+ * a scan of the attribute array. The device IDs are set with #adi_cli_SetIiodDeviceIds, so
+ * commands find the devices before the XML is generated.
+ * @param pIioDesc - Pointer to the IIO description.
+ * @param pIndex - Pointer to the index.
+ * @param pEntries - Pointer to the slots.
+ * @param numEntries - Number of slots. Must be a power of two larger than the number of
+ * attributes, twice the number of attributes keeps the probes short.
+ * @return 0 in case of success or negative value otherwise. If there are not enough slots,
+ * numAttributes is set to the number of attributes of the context.
+ */
+int32_t adi_cli_BuildIiodIndex(IioDesc *pIioDesc, IioAttrIndex *pIndex, IioAttrEntry *pEntries,
+                               uint32_t numEntries);
+
+/**
+ * @brief Gets the channel of a channel id, for example 1 for "current1". The id is the channel
+ * type followed by the index of the channel in the device, as in the XML.
+ * @param pDeviceAttribute - Pointer to the device attributes.
+ * @param pChannelId - Channel id of the command.
+ * @param isOutput - True for an output channel.
+ * @param[out] pChannel - Pointer to store the index of the channel.
+ * @return 0 in case of success or negative value if there is no such channel.
+ */
+int32_t adi_cli_GetIiodChannel(DeviceAttributes *pDeviceAttribute, const char *pChannelId,
+                               bool isOutput, int32_t *pChannel);
+
+/**
+ * @brief Finds an attribute.
+ * @param pIndex - Pointer to the index.
+ * @param pDeviceId - Device id of the command.
+ * @param channel - Index of the channel, or one of IIOD_CHANNEL_DEVICE, IIOD_CHANNEL_DEBUG and
+ * IIOD_CHANNEL_BUFFER.
+ * @param pName - Attribute name of the command.
+ * @param[out] ppEntry - Pointer to store the slot of the attribute. The slot holds the
+ * AttributeType and the index of the device.
+ * @return 0 in case of success or negative value if there is no such attribute.
+ */
+int32_t adi_cli_FindIiodAttribute(IioAttrIndex *pIndex, const char *pDeviceId, int32_t channel,
+                                  const char *pName, IioAttrEntry **ppEntry);
+
+/**
+ * @brief Reads several attributes of a device and sends all values in one response.
+ * @details pAttrList holds the attributes separated by ',' or ';', each in the form of the
+ * arguments of `read` after the device:
+ *
+ * `<attribute>`, `DEBUG <attribute>`, `BUFFER <attribute>` or
+ * `INPUT|OUTPUT <channel> <attribute>`
+ *
+ * For each attribute the response holds, as the answer of `read`, a line with the number of
+ * characters of the value followed by the value and a new line, or only a line with the
+ * negative error code: -ENOENT if there is no such attribute, -EINVAL if the item is
+ * malformed, -ENOBUFS if the value does not fit the transmit segment, or the error of pfShow.
+ * The response is written in place into a single transmit segment and queued for transmission.
+ * @param pIndex - Pointer to the index.
+ * @param hCli - Handle to the CLI instance.
+ * @param pDeviceId - Device id of the command.
+ * @param pAttrList - List of attributes. It is modified while parsed.
+ * @param pfShow - Function reading the value of an attribute.
+ * @param hUser - User handle given to pfShow.
+ * @return 0 in case of success or negative value if the response does not fit the transmit
+ * segment or could not be sent.
+ */
+int32_t adi_cli_ReadIiodAttributes(IioAttrIndex *pIndex, ADI_CLI_HANDLE hCli,
+                                   const char *pDeviceId, char *pAttrList, IIOD_SHOW_FUNC pfShow,
+                                   void *hUser);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_CLI_IIOD_INDEX_H__ */
+/**
+ * @}
+ */
@@ -229,8 +229,11 @@ typedef struct
 {
     /** Pointer to the xml description */
     char *pXmlDesc;
-    /** Size of the xml description */
+    /** Size of the xml description, without the terminating null character */
     uint32_t xmlSize;
+    /** Set when pXmlDesc holds the xml of the current context. Cleared by
+     * #adi_cli_InvalidateIiodXml. */
+    bool isXmlValid;
     /** Pointer to the context attributes */
     CtxAttrType *pCtxAttribute;
     /** Number of context attributes */
@@ -242,12 +245,29 @@ typedef struct
 } IioDesc;
 
 /**
- * @brief Generates the XML for the IIO device.
+ * @brief Sets the device ID of each device of the context to "iio:device<index>", as written in
+ * the XML.
+ * @param pIioDesc - Pointer to the IIO description.
+ */
+void adi_cli_SetIiodDeviceIds(IioDesc *pIioDesc);
+
+/**
+ * @brief Generates the XML for the IIO device in a single pass. The XML is kept in pOutput, and
+ * later calls with the same buffer return immediately until #adi_cli_InvalidateIiodXml is called.
  * @param pIioDesc - Pointer to the IIO description.
  * @param pOutput - Pointer to the output buffer.
- * @return 0 in case of success or negative value otherwise.
+ * @param outputSize - Size of the output buffer, including the terminating null character.
+ * @return 0 in case of success or negative value otherwise. If the buffer is too small, xmlSize
+ * is set to the size of the XML, so the buffer required is xmlSize + 1 bytes.
+ */
+int32_t adi_cli_GenerateIiodXml(IioDesc *pIioDesc, char *pOutput, uint32_t outputSize);
+
+/**
+ * @brief Marks the XML as out of date, for example after devices, channels or attributes of the
+ * context are changed. The next #adi_cli_GenerateIiodXml generates it again.
+ * @param pIioDesc - Pointer to the IIO description.
  */
-int32_t adi_cli_GenerateIiodXml(IioDesc *pIioDesc, char *pOutput);
+void adi_cli_InvalidateIiodXml(IioDesc *pIioDesc);
 
 #ifdef __cplusplus
 }
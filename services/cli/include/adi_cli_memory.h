@@ -20,9 +20,14 @@
 extern "C" {
 #endif
 
-/** State memory required in bytes for the CLI service. Allocate a buffer aligned
+/** State memory required in bytes for the CLI service when the receive and transmit buffers
+ * are provided through #ADI_CLI_CONFIG. Allocate a buffer aligned to 32 bit boundary */
+#define ADI_CLI_STATE_MEM_BASE_NUM_BYTES sizeof(ADI_CLI_INFO)
+/** State memory required in bytes for the CLI service with the default receive
+ * (#RX_BUFFER_SIZE) and transmit (2 x #ADI_CLI_MAX_SIZE) buffers. Allocate a buffer aligned
  * to 32 bit boundary */
-#define ADI_CLI_STATE_MEM_NUM_BYTES sizeof(ADI_CLI_INFO)
+#define ADI_CLI_STATE_MEM_NUM_BYTES                                                                \
+    (ADI_CLI_STATE_MEM_BASE_NUM_BYTES + RX_BUFFER_SIZE + (2 * ADI_CLI_MAX_SIZE))
 /** Temporary memory required in bytes for the CLI service. Allocate a buffer aligned
  * to 32 bit boundary */
 #define ADI_CLI_TEMP_MEM_NUM_BYTES 0x2000
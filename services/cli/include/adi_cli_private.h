@@ -21,9 +21,10 @@ extern "C" {
 #include "adi_cli.h"
 #include "cli_dispatch.h"
 #include "cli_history.h"
+#include "cli_log.h"
 #include "cli_private.h"
 
-/** @brief Maximum size (in bytes) for CLI buffer */
+/** @brief Default size (in bytes) of each of the two CLI transmit buffers */
 #define ADI_CLI_MAX_SIZE (1024 * 10)
 
 /** @brief Maximum size (in bytes) for a message block */
@@ -32,26 +33,45 @@ extern "C" {
 /**
  * CLI information structure
  */
-typedef struct
+typedef struct ADI_CLI_INFO
 {
     /** command line interface instance */
     CLI_PRIVATE cliIfData;
-    /** ping buffer for the data transmission */
-    uint8_t cliBuffer0[ADI_CLI_MAX_SIZE];
-    /** pong buffer for the data transmission */
-    uint8_t cliBuffer1[ADI_CLI_MAX_SIZE];
-    /** pointer to the message string */
-    char *pMsgString;
-    /** pointer to the message string to copy */
-    char *pMsgStringToCopy;
+    /** Transmit segments. Segments from txTail up to txHead are queued or being transmitted,
+     * the segment at txHead is being filled. */
+    ADI_CLI_TX_SEGMENT txSegments[ADI_CLI_MAX_TX_SEGMENTS];
+    /** Segment descriptors handed to pfTransmitVectorAsync */
+    ADI_CLI_TX_SEGMENT txVector[ADI_CLI_MAX_TX_SEGMENTS];
+    /** Number of transmit segments */
+    uint32_t numTxSegments;
+    /** Count of queued segments, wrapping at 2 * numTxSegments. Written only by the producer. */
+    volatile uint32_t txHead;
+    /** Count of transmitted segments, wrapping at 2 * numTxSegments. Written only on transmit
+     * completion. */
+    volatile uint32_t txTail;
+    /** Number of segments in the transfer in progress */
+    volatile uint32_t txInFlight;
+    /** Receive buffer carved from state memory, NULL if state memory has no room for it */
+    uint8_t *pDefaultRxBuffer;
+    /** Transmit buffer carved from state memory, NULL if state memory has no room for it */
+    uint8_t *pDefaultTxBuffer;
     /** CLI configuration */
     ADI_CLI_CONFIG config;
     /** Tx completion flag */
-    int32_t isTxComplete;
+    volatile int32_t isTxComplete;
     /** Pointer to temporary memory buffer */
     uint8_t *pTempMemory;
     /** Size of memory in (bytes) given to store temporary data */
     uint32_t tempMemSize;
+    /** Event flags set by the receive and transmit callbacks when CMSIS_OS2 is defined */
+    ADI_RTOS_EVENT events;
+    /** Ring of deferred log records */
+    CLI_LOG_RING logRing;
+    /** Set by #adi_cli_SetHandleTerminal when the INFO_MSG family of macros prints to this
+     * instance */
+    volatile int32_t isTerminal;
+    /** Next instance created, NULL for the first one */
+    struct ADI_CLI_INFO *pNextInstance;
 } ADI_CLI_INFO;
 
 #ifdef __cplusplus
@@ -70,6 +70,10 @@ typedef enum
     ADI_CLI_STATUS_INVALID_COMMAND,
     /** Transmission in progress */
     ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS,
+    /** Argument is out of range or does not match the configuration */
+    ADI_CLI_STATUS_INVALID_ARGUMENT,
+    /** The RTOS objects of the handle could not be created */
+    ADI_CLI_STATUS_INIT_FAILED,
 } ADI_CLI_STATUS;
 
 /** @} */
@@ -20,6 +20,24 @@
 extern "C" {
 #endif
 
+/** @brief Maximum number of records in a dispatch table that is looked up through the sorted
+ * index. Sizes the index kept in the state memory of each instance, at one byte per record.
+ * Larger tables are searched linearly and cannot be given in ADI_CLI_CONFIG. */
+#ifndef APP_CFG_CLI_MAX_DISPATCH_RECORDS
+#define APP_CFG_CLI_MAX_DISPATCH_RECORDS (64)
+#endif
+#if (APP_CFG_CLI_MAX_DISPATCH_RECORDS > 256)
+#error "APP_CFG_CLI_MAX_DISPATCH_RECORDS must not exceed 256, the sorted index holds bytes"
+#endif
+/** @brief Maximum number of records in a dispatch table that is looked up through the sorted
+ * index */
+#define CLI_DISPATCH_MAX_RECORDS APP_CFG_CLI_MAX_DISPATCH_RECORDS
+
+/** @brief Return value of a command that has more output to send. The command is called again
+ * with the same #Args, each time the transmit segment has room, until it returns another value.
+ * Meanwhile no input is read. */
+#define CMD_IN_PROGRESS (INT32_MAX)
+
 /**
  * Holds parameter value
  */
@@ -38,6 +56,7 @@ typedef struct
 {
     int c;                                /**< arguments count value */
     PARAM v[APP_CFG_CLI_MAX_PARAM_COUNT]; /**< buffer to hold parameter values */
+    uint32_t resumeState; /**< progress of a command returning #CMD_IN_PROGRESS, 0 on first call */
 } Args;
 
 /**
@@ -98,10 +117,12 @@ typedef struct
     char *pCmdLower;
     /** pointer to store the command in lower case from dispatch table */
     char *pDispatchCmd;
-    /** pointer for the dispatch table */
+    /** pointer for the dispatch table described by sortedIndex */
     const Command *pDispatchTable;
-    /** number of records in dispatch table */
+    /** number of records in dispatch table described by sortedIndex */
     int32_t numDispatchRecords;
+    /** dispatch table record indices sorted by case insensitive command name */
+    uint8_t sortedIndex[CLI_DISPATCH_MAX_RECORDS];
     /** Holds a full set of parsed parameter values for passing to commands */
     Args sArgs;
 
@@ -112,8 +133,20 @@ typedef struct
 /** @brief UNHIDE command */
 #define NOHIDE false
 
+/**
+ * @brief Builds the sorted index of a dispatch table ahead of the first lookup.
+ * @param [in] pInfo		    - pointer to dispatch data
+ * @param [in] pDispatchTable	- pointer to dispatch table
+ * @param [in] numRecords	    - number of records in dispatch table
+ * @return 0 on success, 1 if the table has more than #CLI_DISPATCH_MAX_RECORDS records.
+ */
+int32_t DispatchRegisterTable(CLI_DISPATCH_DATA *pInfo, const Command *pDispatchTable,
+                              int32_t numRecords);
+
 /**
  * @brief Get matching dispatch table record.
+ * @details The case insensitive sorted index of the table is built on the first lookup in a
+ * table and reused until a different table is given.
  * \ref DispatchGetCommandDetails
  * @param [in] pInfo		    - pointer to dispatch data
  * @param [in] pCommandToken	- parsed user command in lowercase.
@@ -124,6 +157,31 @@ typedef struct
 const Command *DispatchGetCommandDetails(CLI_DISPATCH_DATA *pInfo, char *pCommandToken,
                                          const Command *pDispatchTable, int32_t numRecords);
 
+/**
+ * @brief Finds the records whose names start with a prefix, ignoring case.
+ * @details The records are adjacent in the sorted index, so they are found with two binary
+ * searches of the index and read with #DispatchGetSortedRecord. Tables larger than
+ * #CLI_DISPATCH_MAX_RECORDS have no sorted index and no records are found.
+ * @param [in] pInfo		    - pointer to dispatch data
+ * @param [in] pPrefix	        - prefix, needs no terminating null
+ * @param [in] prefixLen	    - number of characters of the prefix
+ * @param [in] pDispatchTable	- pointer to dispatch table, may be NULL
+ * @param [in] numRecords	    - number of records in dispatch table
+ * @param [out] pFirst	        - position of the first record in the sorted index
+ * @return number of records found, including hidden commands.
+ */
+int32_t DispatchFindPrefix(CLI_DISPATCH_DATA *pInfo, const char *pPrefix, uint32_t prefixLen,
+                           const Command *pDispatchTable, int32_t numRecords, int32_t *pFirst);
+
+/**
+ * @brief Gets a record of the table last given to #DispatchGetCommandDetails or
+ * #DispatchFindPrefix by its position in the sorted index.
+ * @param [in] pInfo		    - pointer to dispatch data
+ * @param [in] position	        - position in the sorted index
+ * @return const Command*       - pointer to dispatch table record.
+ */
+const Command *DispatchGetSortedRecord(CLI_DISPATCH_DATA *pInfo, int32_t position);
+
 #ifdef __cplusplus
 }
 #endif
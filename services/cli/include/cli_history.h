@@ -27,28 +27,35 @@ extern "C" {
 /** @brief module failure status */
 #define HISTORY_FAILURE (1)
 
-/** @brief maximum number of commands in history */
-#define HISTORY_DEPTH (16)
-/** @brief maximum size of an entry = (size(command) + size(parameters)) */
-#define HISTORY_ENTRY_LENGTH (APP_CFG_CLI_MAX_CMD_LENGTH + APP_CFG_CLI_MAX_PARAM_LENGTH)
-
-/** @brief details of a command and its parameters */
-typedef char HISTORY_DATA[HISTORY_ENTRY_LENGTH];
+/** @brief Size in bytes of the history ring. Each command takes its length plus
+ * #HISTORY_ENTRY_OVERHEAD bytes, so the ring holds as many commands as fit. */
+#ifndef APP_CFG_CLI_HISTORY_NUM_BYTES
+#define APP_CFG_CLI_HISTORY_NUM_BYTES (1024)
+#endif
+/** @brief Number of bytes stored with each command, its length before and after it */
+#define HISTORY_ENTRY_OVERHEAD (2)
+/** @brief Maximum length of a command in history, longer commands are truncated */
+#if (APP_CFG_CLI_MAX_CMD_LENGTH > 256)
+#define HISTORY_MAX_ENTRY_LENGTH (255)
+#else
+#define HISTORY_MAX_ENTRY_LENGTH (APP_CFG_CLI_MAX_CMD_LENGTH - 1)
+#endif
 
 /**
  * @brief  typedef to hold the history and pointers for managing
+ * @details Commands are packed in a byte ring as [length][characters][length] without
+ * terminating null character. The length after the command lets scrolling up step back to the
+ * previous command. The offsets are taken modulo the ring size, tailIndex is kept below it.
  */
 typedef struct CLI_HISTORY
 {
-    /** Array of commands stored in history */
-    HISTORY_DATA list[HISTORY_DEPTH];
-    /** Index to next available (empty) command */
+    /** Ring of commands stored in history */
+    uint8_t ring[APP_CFG_CLI_HISTORY_NUM_BYTES];
+    /** Offset of the next command to store */
     uint32_t headIndex;
-    /** Index to oldest existing (occupied) command */
+    /** Offset of the oldest command. If headIndex == tailIndex history is empty. */
     uint32_t tailIndex;
-    /* If ( H == T ) then history file is empty */
-    /* If ( H++ == T ) then history file is full */
-    /** Current position (history line now at prompt)*/
+    /** Offset of the command at the prompt, headIndex when on a new line */
     uint32_t curIndex;
 } CLI_HISTORY;
 
@@ -59,8 +66,8 @@ typedef struct
 {
     /** pointer to the history of commands issued. */
     CLI_HISTORY history;
-    /** pointer to the trimmed command */
-    char trimCommand[APP_CFG_CLI_MAX_CMD_LENGTH];
+    /** Command returned by scrolling, with terminating null character */
+    char trimCommand[HISTORY_MAX_ENTRY_LENGTH + 1];
 } CLI_HISTORY_DATA;
 
 /*========================== P R O T O T Y P E S ==========================*/
@@ -80,13 +87,13 @@ void HistoryInit(CLI_HISTORY_DATA *pHistory);
 
 /**
  * @brief Get a command line from the history file, moving up.
- * @return a command pointer
+ * @return a command pointer, valid until the next scroll
  */
 char *HistoryScrollUp(CLI_HISTORY_DATA *pHistory);
 
 /**
  * @brief Get a command line from the history file, moving down.
- * @return a command pointer
+ * @return a command pointer, valid until the next scroll
  **/
 char *HistoryScrollDown(CLI_HISTORY_DATA *pHistory);
 
@@ -0,0 +1,134 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file        cli_log.h
+ * @addtogroup ADI_CLI
+ * @brief       This file contains routines declared for deferred CLI logging
+ * @{
+ */
+
+#ifndef __CLI_LOG_H__
+#define __CLI_LOG_H__
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_cli.h"
+#include "app_cfg.h"
+#include <stdarg.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= D E F I N E S =============*/
+
+/** @brief Maximum number of argument words of a log record. Arguments after the limit are
+ * dropped and the record is flagged with #ADI_CLI_LOG_FLAG_TRUNCATED. */
+#ifndef APP_CFG_CLI_LOG_MAX_ARG_WORDS
+#define APP_CFG_CLI_LOG_MAX_ARG_WORDS (16)
+#endif
+/** @brief Maximum number of characters of a string argument copied to a log record */
+#ifndef APP_CFG_CLI_LOG_MAX_STRING_LENGTH
+#define APP_CFG_CLI_LOG_MAX_STRING_LENGTH (32)
+#endif
+/** @brief Number of words of the largest log record */
+#define CLI_LOG_MAX_RECORD_NUM_WORDS                                                               \
+    (ADI_CLI_LOG_RECORD_HEADER_NUM_WORDS + APP_CFG_CLI_LOG_MAX_ARG_WORDS)
+/** @brief Number of bytes of a binary frame of log records besides the records: header, count
+ * of dropped records and CRC */
+#define CLI_LOG_FRAME_OVERHEAD_NUM_BYTES                                                           \
+    (ADI_CLI_BINARY_HEADER_NUM_BYTES + sizeof(uint32_t) + ADI_CLI_BINARY_CRC_NUM_BYTES)
+/** @brief Minimum number of bytes of a transmit segment, so an empty segment takes the largest
+ * log record */
+#define CLI_LOG_MIN_SEGMENT_NUM_BYTES                                                              \
+    (CLI_LOG_FRAME_OVERHEAD_NUM_BYTES + (CLI_LOG_MAX_RECORD_NUM_WORDS * sizeof(uint32_t)))
+/** @brief Maximum number of words of the records of a binary frame, limited by its length
+ * field */
+#define CLI_LOG_FRAME_MAX_NUM_WORDS ((0xFFFEu / sizeof(uint32_t)) - 1u)
+/** @brief Level of the records padding the ring up to its end */
+#define CLI_LOG_LEVEL_PAD (0xFFu)
+/** @brief Gets the format ID of a format string, see #adi_cli_LogFormatBase */
+#if (UINTPTR_MAX > 0xFFFFFFFFu)
+#define CLI_LOG_FORMAT_ID(pFormat)                                                                 \
+    ((uint32_t)((uintptr_t)(pFormat) - (uintptr_t)adi_cli_LogFormatBase))
+#else
+#define CLI_LOG_FORMAT_ID(pFormat) ((uint32_t)(uintptr_t)(pFormat))
+#endif
+/** @brief Builds the header word of a log record */
+#define CLI_LOG_HEADER(numWords, level) ((uint32_t)(numWords) | ((uint32_t)(level) << 16))
+
+/**
+ * @brief  typedef of the ring holding the log records
+ * @details Records are reserved by moving reserveIndex forward, so interrupts and threads can
+ * log concurrently without a lock. The header word of a record is written last and a zero
+ * header marks a record that is reserved but not complete yet. The consumer clears the words it
+ * takes, so all words outside readIndex up to reserveIndex are zero. A record that does not fit
+ * before the end of the ring is preceded by a padding record up to the end. The indices run
+ * freely and are taken modulo numWords.
+ */
+typedef struct CLI_LOG_RING
+{
+    /** Words of the ring, NULL if deferred logging is not configured */
+    uint32_t *pBase;
+    /** Number of words of the ring, a power of two */
+    uint32_t numWords;
+    /** Count of words reserved by the producers */
+    volatile uint32_t reserveIndex;
+    /** Count of words taken by the consumer */
+    volatile uint32_t readIndex;
+    /** Number of records dropped because the ring was full */
+    volatile uint32_t numDropped;
+} CLI_LOG_RING;
+
+/*======= P U B L I C   P R O T O T Y P E S ========*/
+
+/**
+ * @brief Initialises the log ring.
+ * @param[in] pRing - pointer to the log ring.
+ * @param[in] pBase - words of the ring, cleared here.
+ * @param[in] numWords - number of words, a power of two.
+ */
+void CliLogInit(CLI_LOG_RING *pRing, uint32_t *pBase, uint32_t numWords);
+
+/**
+ * @brief Stores the format ID and the arguments of a message in the log ring.
+ * @details The format string is only scanned for the types of the arguments; it is not
+ * formatted. May be called from interrupt context.
+ * @param[in] pRing - pointer to the log ring.
+ * @param[in] level - level of the message, one of #ADI_CLI_LOG_LEVEL.
+ * @param[in] pFormat - format string of the message.
+ * @param[in] pArgs - arguments of the format string.
+ * @return 0 on success, 1 if the ring is full and the record was dropped.
+ */
+int32_t CliLogVWrite(CLI_LOG_RING *pRing, uint32_t level, const char *pFormat, va_list pArgs);
+
+/**
+ * @brief Takes the complete records from the log ring, skipping the padding records.
+ * @details Stops at the first record that is not complete yet or does not fit. Must not be
+ * called concurrently with itself.
+ * @param[in] pRing - pointer to the log ring.
+ * @param[out] pDest - destination of the records, need not be aligned.
+ * @param[in] maxNumWords - number of words that fit the destination.
+ * @return number of words copied.
+ */
+uint32_t CliLogRead(CLI_LOG_RING *pRing, uint8_t *pDest, uint32_t maxNumWords);
+
+/**
+ * @brief Gets the number of records dropped since the last call and clears it.
+ * @param[in] pRing - pointer to the log ring.
+ * @return number of records dropped.
+ */
+uint32_t CliLogTakeDropped(CLI_LOG_RING *pRing);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CLI_LOG_H__ */
+
+/**
+ * @}
+ */
@@ -14,9 +14,11 @@
 /*============= I N C L U D E S =============*/
 
 #include "adi_circ_buf.h"
+#include "adi_rtos.h"
 #include "app_cfg.h"
 #include "cli_dispatch.h"
 #include "cli_history.h"
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -25,7 +27,7 @@ extern "C" {
 #endif
 
 /*============= D E F I N E S =============*/
-/** @brief rx buffer size */
+/** @brief Default rx buffer size. Must be a power of two when CIRC_BUFF_POW2 is defined. */
 #define RX_BUFFER_SIZE 256
 /** @brief controlArrays index for Alert */
 #define CLI_CTRL_ALERT (0)
@@ -51,6 +53,10 @@ extern "C" {
 #define CLI_CTRL_RESTORE (10)
 /** @brief controlArrays index for save*/
 #define CLI_CTRL_SAVE (11)
+/** @brief controlArrays index for insert character */
+#define CLI_CTRL_INSERT (12)
+/** @brief controlArrays index for delete character */
+#define CLI_CTRL_DELETE (13)
 /** Number of calibration choices */
 #define CAL_NUM_CHOICES 11
 /** Number of gain channels */
@@ -61,6 +67,16 @@ extern "C" {
 #define COMP_NUM_CHOICES 8
 /** Number of echo modes*/
 #define NUM_ECHO_MODES 2
+/** Number of bytes of the binary frame length field */
+#define CLI_BINARY_LENGTH_NUM_BYTES (2)
+/** Number of bytes of the binary frame CRC field */
+#define CLI_BINARY_CRC_NUM_BYTES (2)
+/** Binary frame receive state waiting for the sync byte */
+#define CLI_BINARY_STATE_SYNC (0)
+/** Binary frame receive state reading the length field */
+#define CLI_BINARY_STATE_LENGTH (1)
+/** Binary frame receive state reading command ID, arguments and CRC */
+#define CLI_BINARY_STATE_BODY (2)
 /** Success */
 #define CMD_SUCCESS 0
 /** Faiure */
@@ -96,6 +112,8 @@ typedef struct
     uint8_t *pBufferToWrite;
     /** Number of bytes stored in the buffer */
     uint32_t bytesStored;
+    /** Size of the buffer in bytes */
+    uint32_t bufferSize;
 } BufferInfo;
 
 /**
@@ -107,12 +125,39 @@ typedef struct
     volatile ADI_CIRC_BUF *pRxBuff;
     /** byte index */
     uint8_t rxByte;
+    /** Block receive is waiting for space in the receive buffer */
+    volatile int32_t isRxStalled;
     /** Circular buffer for storing received data */
     volatile ADI_CIRC_BUF rxCircBuff;
-    /** rx buffer */
-    uint8_t rxBuff[RX_BUFFER_SIZE];
 } ADI_CLI_RX_DATA;
 
+/**
+ * Receive state of a binary frame. The frame, without the sync byte, is assembled in the command
+ * line buffer.
+ */
+typedef struct
+{
+    /** Function to calculate the frame CRC */
+    uint32_t (*pfCalculateCrc)(uint8_t *, uint32_t);
+    /** Receive state */
+    int32_t state;
+    /** Number of bytes received for the current state */
+    uint32_t numBytes;
+    /** Number of bytes expected for the current state */
+    uint32_t frameLength;
+    /** A frame with a valid CRC is waiting to be dispatched */
+    bool isFramePending;
+} CLI_BINARY_FRAME;
+
+/**
+ * Reentrant tokenizer state for splitting a command line in place
+ */
+typedef struct
+{
+    /** Next character to scan */
+    char *pNext;
+} CLI_TOKENIZER;
+
 /**
  * Holds parameter value
  */
@@ -134,16 +179,36 @@ typedef struct
     bool userIsTyping;
     /** Flag to indicate whether the control characters to be printed or not */
     bool displayCtrlChars;
+    /** Edits in the middle of the line use the terminal insert and delete character
+     * sequences instead of writing the rest of the line again */
+    bool useInsertDelete;
+    /** State variable for building ANSI escape sequences */
+    int32_t escSeqState;
+    /** Commands are received as binary frames instead of text lines */
+    bool binaryMode;
+    /** Binary frame receive state */
+    CLI_BINARY_FRAME binaryFrame;
     /** Holds current line buffers and pointers */
     EditLine editLine;
     /** Buffer info structure to hold current data buffer filling */
     BufferInfo bufferInfo;
+    /** Serialises the producers of bufferInfo when CMSIS_OS2 is defined */
+    ADI_RTOS_MUTEX txLock;
     /** CLI data */
     ADI_CLI_RX_DATA cliData;
     /** history data */
     CLI_HISTORY_DATA cliHistData;
     /** pointer to the dispatch data */
     CLI_DISPATCH_DATA cliDispatchData;
+    /** Dispatch table of the configuration completed by TAB, NULL to complete from the table
+     * of the last dispatch */
+    const Command *pCompleteTable;
+    /** Number of records of pCompleteTable */
+    int32_t numCompleteRecords;
+    /** Command that returned CMD_IN_PROGRESS, NULL if none */
+    const Command *pResumeRecord;
+    /** Command ID of the frame answered when the resumed command completes in binary mode */
+    uint8_t resumeCmdId;
 } CLI_PRIVATE;
 
 /*============= F U N C T I O N  P R O T O T Y P E S =============*/
@@ -158,6 +223,32 @@ typedef struct
  */
 int32_t CliGetCmd(CLI_PRIVATE *pInfo, char *pString);
 
+/**
+ * @brief Assembles a binary frame from the received bytes.
+ * @details Answers frames with a CRC error.
+ * @param[in] pInfo - pointer to CLI interface structure.
+ * @returns 0 when a frame is ready for #CliDispatchBinary, 1 otherwise.
+ */
+int32_t CliGetBinaryFrame(CLI_PRIVATE *pInfo);
+
+/**
+ * @brief Decodes the arguments of the pending binary frame, calls the command and answers the
+ * frame with the status.
+ * @param[in] pInfo          - pointer to CLI interface structure.
+ * @param[in] pDispatchTable - dispatch table indexed by the command ID.
+ * @param[in] numRecords     - number of records in the dispatch table.
+ * @return  0 - Success, 1 - Failed.
+ */
+int32_t CliDispatchBinary(CLI_PRIVATE *pInfo, const Command *pDispatchTable, int32_t numRecords);
+
+/**
+ * @brief Calls the command that returned #CMD_IN_PROGRESS again. When it completes, the frame is
+ * answered in binary mode, or the usage hint is printed if it failed in text mode.
+ * @param[in] pInfo - pointer to CLI interface structure, with pResumeRecord set.
+ * @return  return value of the command.
+ */
+int32_t CliResumeCommand(CLI_PRIVATE *pInfo);
+
 /**
  * @brief Defer printing of prompt until next keypress.
  * @param[in] pInfo - pointer to CLI interface structure.
@@ -195,6 +286,30 @@ int32_t CliPutChar(CLI_PRIVATE *pInfo, const char inputChar);
  */
 int32_t CliPutString(CLI_PRIVATE *pInfo, const char *pString);
 
+/**
+ * @brief Formats a message directly into the free space of the transmit buffer.
+ * @details The message type is written as a prefix and a new line as a suffix, except for the
+ * "RAW" and "DBGRAW" types which are written as such. A message that does not fit completely is
+ * discarded.
+ * @param[in] pInfo        - pointer to CLI interface structure.
+ * @param[in] pMsgType     - type of message.
+ * @param[in] pFormat      - format specifier for the message.
+ * @param[in] pArgs        - arguments for the format specifier.
+ * @return 0 on success, 1 if the message does not fit in the buffer.
+ */
+int32_t CliVPrintMessage(CLI_PRIVATE *pInfo, const char *pMsgType, const char *pFormat,
+                         va_list pArgs);
+
+/**
+ * @brief Formats a message directly into the free space of the transmit buffer.
+ * @details See \ref CliVPrintMessage.
+ * @param[in] pInfo        - pointer to CLI interface structure.
+ * @param[in] pMsgType     - type of message.
+ * @param[in] pFormat      - format specifier for the message.
+ * @return 0 on success, 1 if the message does not fit in the buffer.
+ */
+int32_t CliPrintMessage(CLI_PRIVATE *pInfo, const char *pMsgType, const char *pFormat, ...);
+
 /**
  * @brief Puts the buffer into the internal buffer.
  * @param[in] pInfo        - pointer to CLI interface structure.
@@ -260,6 +375,18 @@ int32_t CliExpertHelp(void *pInfo, const Command *pDispatchRecord, Args *pArgs,
  */
 int32_t CliCmdEcho(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int32_t numRecords);
 
+/**
+ * @brief Function for CLI "binary" command to switch to binary frames.
+ * @param[in] pInfo       - pointer to CLI interface structure. This is a void* to keep the
+ * CLI_PRIVATE handle private. Users should not access this structure directly. To invoke internal
+ * commands, use the GetHandleForDispatchCommands function to obtain a valid handle.
+ * @param[in] pDispatchRecord - pointer to the command record in the dispatch table.
+ * @param[in] pArgs       - pointer to command arguments storage.
+ * @param[in] numRecords  - number of records in the dispatch table.
+ * @return status 0 on Success
+ */
+int32_t CliCmdBinary(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int32_t numRecords);
+
 #ifdef ENABLE_X86_BUILD
 /**
  * @brief Function for CLI "exit" command to exit the CLI.
@@ -20,6 +20,12 @@
 extern "C" {
 #endif
 
+/** @brief Set to 1 to add the readmulti command to the dispatch table. The application must then
+ * implement CmdReadMulti. */
+#ifndef APP_CFG_IIOD_READMULTI
+#define APP_CFG_IIOD_READMULTI 0
+#endif
+
 /**
  * @brief Command to display help.
  * @param pArgs - pointer to command arguments storage.
@@ -118,6 +124,14 @@ int32_t CmdSetTrig(Args *pArgs);
  */
 int32_t CmdSet(Args *pArgs);
 
+/**
+ * @brief Command to read several attributes of a device in one response, see
+ * adi_cli_ReadIiodAttributes
+ * @param pArgs - pointer to command arguments storage.
+ * @return 0 in case of success or negative value otherwise.
+ */
+int32_t CmdReadMulti(Args *pArgs);
+
 /**
  * @brief Command dispatch table
  * Add commands table here with function description
@@ -148,6 +162,13 @@ static const Command dispatchTable[] = {
     // Isuue with the set command.
     {"set", "sss", CmdSet, NOHIDE, "Set the number of kernel buffers for the specified device",
      "<device> BUFFERS_COUNT <count>", NULL, NULL},
+#if (APP_CFG_IIOD_READMULTI == 1)
+    // Appended so that the command IDs of binary frames stay the same.
+    {"readmulti", "ss", CmdReadMulti, NOHIDE, "Read the values of several attributes",
+     "<device> \"<attribute>|DEBUG <attribute>|BUFFER <attribute>|INPUT|OUTPUT <channel> "
+     "<attribute>[,...]\"",
+     NULL, NULL},
+#endif
 };
 
 /**
@@ -35,6 +35,10 @@ static const InternalCommand internalDispatchTable[] = {
     {"exit", "", CliExit, NOHIDE, "Exits the CLI program", "", NULL, NULL},
 #endif /* ENABLE_X86_BUILD */
     {"echo", "s", CliCmdEcho, NOHIDE, "Enables or disables echo mode", "", NULL, NULL},
+    {"binary", "", CliCmdBinary, NOHIDE, "Switches to binary framed commands", "",
+     "\t  Commands are received as CRC protected binary frames until a frame with command ID "
+     "0xFF is received.\n\r",
+     NULL},
 };
 
 #ifdef __cplusplus
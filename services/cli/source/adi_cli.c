@@ -16,6 +16,7 @@
 #include "app_cfg.h"
 #include "cli_dispatch.h"
 #include "cli_history.h"
+#include "cli_log.h"
 #include "cli_private.h"
 #include "string.h"
 #include <stdarg.h>
@@ -25,8 +26,84 @@
 /**
  * @brief  Intialises the circular buffer used for receiving data.
  * @param[in] pInfo - pointer to CLI interface structure.
+ * @param[in] pBuffer - pointer to the receive buffer.
+ * @param[in] bufferSize - size of the receive buffer in bytes.
  */
-static void InitCircBuff(CLI_PRIVATE *pInfo);
+static void InitCircBuff(CLI_PRIVATE *pInfo, uint8_t *pBuffer, uint32_t bufferSize);
+
+/**
+ * @brief  Splits the transmit buffer into equally sized segments.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @param[in] pBuffer - pointer to the transmit buffer.
+ * @param[in] bufferSize - size of the transmit buffer in bytes.
+ * @param[in] numSegments - number of segments. 0 selects 2 segments.
+ */
+static void InitTxBuffers(ADI_CLI_INFO *pInfo, uint8_t *pBuffer, uint32_t bufferSize,
+                          uint32_t numSegments);
+
+/**
+ * @brief  Limits a number of transmit segments to 2 up to #ADI_CLI_MAX_TX_SEGMENTS.
+ * @param[in] numSegments - number of segments requested.
+ * @return number of segments used.
+ */
+static uint32_t GetNumTxSegments(uint32_t numSegments);
+
+/**
+ * @brief  Advances a transmit segment index, wrapping it at twice the number of segments.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @param[in] index - txHead or txTail.
+ * @param[in] numSegments - number of segments to advance by, at most numTxSegments.
+ * @return advanced index.
+ */
+static uint32_t AdvanceTxIndex(ADI_CLI_INFO *pInfo, uint32_t index, uint32_t numSegments);
+
+/**
+ * @brief  Gets the number of segments queued between two transmit segment indices.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @param[in] head - txHead.
+ * @param[in] tail - txTail.
+ * @return number of segments from tail up to head.
+ */
+static uint32_t GetNumTxQueued(ADI_CLI_INFO *pInfo, uint32_t head, uint32_t tail);
+
+/**
+ * @brief  Gets the segment of a transmit segment index.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @param[in] index - txHead or txTail, advanced or not.
+ * @return pointer to the segment.
+ */
+static ADI_CLI_TX_SEGMENT *GetTxSegment(ADI_CLI_INFO *pInfo, uint32_t index);
+
+/**
+ * @brief  Gets the size of the transmit segments #adi_cli_Init sets up for a configuration.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @param[in] pConfig - configuration given to #adi_cli_Init.
+ * @return number of bytes of each segment.
+ */
+static uint32_t GetTxSegmentSize(ADI_CLI_INFO *pInfo, ADI_CLI_CONFIG *pConfig);
+
+/**
+ * @brief  Starts transmission of the queued segments if the transport is idle.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @return 0 on success, transport error otherwise.
+ */
+static int32_t StartTransmit(ADI_CLI_INFO *pInfo);
+
+/**
+ * @brief  Arms the transport to receive into the contiguous free span of the receive buffer.
+ * Marks the reception as stalled if the buffer is full.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @return 0 on success, transport error otherwise.
+ */
+static int32_t ArmBlockReceive(ADI_CLI_INFO *pInfo);
+
+/**
+ * @brief  Checks whether the transmit segment being filled has room to resume a command that
+ * returned #CMD_IN_PROGRESS.
+ * @param[in] pInfo - pointer to CLI information structure.
+ * @return true if ADI_CLI_CONFIG.resumeNumBytes bytes are free, or the whole segment if 0.
+ */
+static bool HasResumeSpace(ADI_CLI_INFO *pInfo);
 
 /**
  * @brief  Allocates the temporary memory for CLI.
@@ -41,18 +118,33 @@ static void AllocateTempMem(ADI_CLI_INFO *pInfo);
 static void IntialiseStateData(ADI_CLI_INFO *pInfo);
 
 /**
- * @brief  Copies the message to the CLI buffer.
- * @param[in] pMessage - pointer to the message string.
- * @return 0 on success, 1 on failure.
+ * @brief Adds an instance to the list walked by the INFO_MSG family of macros.
+ * @details The instance is added only once, so creating it again keeps the list intact.
+ * @param[in] pInfo - pointer to CLI interface structure.
+ * @param[in] pNext - next instance of pInfo if it is already in the list.
+ * @param[in] isListed - 1 if pInfo is already in the list.
+ */
+static void AddInstance(ADI_CLI_INFO *pInfo, ADI_CLI_INFO *pNext, int32_t isListed);
+
+/**
+ * @brief Checks whether an instance is in the list of created instances.
+ * @param[in] pInfo - pointer to CLI interface structure.
+ * @return 1 if pInfo is in the list, 0 otherwise.
+ */
+static int32_t IsInstanceListed(ADI_CLI_INFO *pInfo);
+
+/**
+ * @brief  Most recently created instance, the head of the list of instances.
+ * The INFO_MSG family of macros prints to the instances of the list whose isTerminal is set by
+ * adi_cli_SetHandleTerminal. The list is only added to by adi_cli_Create.
  */
-static int32_t CopyToBuffer(char *pMessage);
+static ADI_CLI_INFO *pFirstInstance = NULL;
 
 /**
- * @brief  Handle for the terminal interface.
- * This is used for storing messages in the CLI buffer.
- * Before storing any messages, the user must call adi_cli_SetHandleTerminal to set this handle.
+ * @brief  Message types printed for the levels of #adi_cli_Log without log ring.
  */
-static ADI_CLI_HANDLE hTerminalHandle = NULL;
+static const char *const logMsgTypes[ADI_CLI_LOG_NUM_LEVELS] = {
+    "RAW", "", "Warn : ", "Error : ", "Debug : ", "DBGRAW"};
 
 ADI_CLI_STATUS adi_cli_Create(ADI_CLI_HANDLE *phCli, void *pStateMemory, uint32_t stateMemorySize,
                               void *pTempMemory, uint32_t tempMemorySize)
@@ -60,7 +152,9 @@ ADI_CLI_STATUS adi_cli_Create(ADI_CLI_HANDLE *phCli, void *pStateMemory, uint32_
 
     ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
     ADI_CLI_INFO *pInfo = NULL;
-    uint32_t reqSize = sizeof(ADI_CLI_INFO);
+    ADI_CLI_INFO *pNext = NULL;
+    int32_t isListed;
+    uint32_t reqSize = ADI_CLI_STATE_MEM_BASE_NUM_BYTES;
     uint32_t reqTempSize = ADI_CLI_TEMP_MEM_NUM_BYTES;
 
     /* Check the given pointers before we set their contents */
@@ -80,8 +174,22 @@ ADI_CLI_STATUS adi_cli_Create(ADI_CLI_HANDLE *phCli, void *pStateMemory, uint32_
         {
             pInfo = (ADI_CLI_INFO *)pStateMemory;
             *phCli = (ADI_CLI_HANDLE *)pInfo;
+            isListed = IsInstanceListed(pInfo);
+            if (isListed != 0)
+            {
+                pNext = pInfo->pNextInstance;
+            }
             memset(pInfo, 0, sizeof(ADI_CLI_INFO));
-            InitCircBuff(&pInfo->cliIfData);
+            AddInstance(pInfo, pNext, isListed);
+            if (stateMemorySize >= ADI_CLI_STATE_MEM_NUM_BYTES)
+            {
+                pInfo->pDefaultRxBuffer = (uint8_t *)pStateMemory + sizeof(ADI_CLI_INFO);
+                pInfo->pDefaultTxBuffer = pInfo->pDefaultRxBuffer + RX_BUFFER_SIZE;
+            }
+            InitCircBuff(&pInfo->cliIfData, pInfo->pDefaultRxBuffer,
+                         (pInfo->pDefaultRxBuffer != NULL) ? RX_BUFFER_SIZE : 0);
+            InitTxBuffers(pInfo, pInfo->pDefaultTxBuffer,
+                          (pInfo->pDefaultTxBuffer != NULL) ? (2 * ADI_CLI_MAX_SIZE) : 0, 0);
             IntialiseStateData(pInfo);
             if (tempMemorySize < reqTempSize)
             {
@@ -107,12 +215,75 @@ ADI_CLI_STATUS adi_cli_Init(ADI_CLI_HANDLE hCli, ADI_CLI_CONFIG *pConfig)
     {
         return ADI_CLI_STATUS_NULL_PTR;
     }
+    else if ((pConfig->pLogBuffer != NULL) &&
+             ((pConfig->pfCalculateCrc == NULL) ||
+              (pConfig->logBufferNumWords < CLI_LOG_MAX_RECORD_NUM_WORDS) ||
+              (pConfig->logBufferNumWords > ADI_CLI_LOG_MAX_BUFFER_NUM_WORDS) ||
+              ((pConfig->logBufferNumWords & (pConfig->logBufferNumWords - 1u)) != 0) ||
+              (GetTxSegmentSize(pInfo, pConfig) < CLI_LOG_MIN_SEGMENT_NUM_BYTES)))
+    {
+        return ADI_CLI_STATUS_INVALID_ARGUMENT;
+    }
+    else if ((pConfig->pDispatchTable != NULL) &&
+             (DispatchRegisterTable(&pInfo->cliIfData.cliDispatchData, pConfig->pDispatchTable,
+                                    pConfig->numDispatchRecords) != 0))
+    {
+        return ADI_CLI_STATUS_INVALID_ARGUMENT;
+    }
     else
     {
+        if (pConfig->pRxBuffer != NULL)
+        {
+            InitCircBuff(&pInfo->cliIfData, pConfig->pRxBuffer, pConfig->rxBufferSize);
+        }
+        else if (pInfo->pDefaultRxBuffer == NULL)
+        {
+            return ADI_CLI_STATUS_INSUFFICIENT_STATE_MEMORY;
+        }
+        if (pConfig->pTxBuffer != NULL)
+        {
+            InitTxBuffers(pInfo, pConfig->pTxBuffer, pConfig->txBufferSize,
+                          pConfig->numTxSegments);
+        }
+        else if (pInfo->pDefaultTxBuffer == NULL)
+        {
+            return ADI_CLI_STATUS_INSUFFICIENT_STATE_MEMORY;
+        }
+        else if (pConfig->numTxSegments != 0)
+        {
+            InitTxBuffers(pInfo, pInfo->pDefaultTxBuffer, 2 * ADI_CLI_MAX_SIZE,
+                          pConfig->numTxSegments);
+        }
         pConfig->hUser = pInfo;
         pInfo->config = *pConfig;
-        status = pInfo->config.pfReceiveAsync(pInfo->config.hUser,
-                                              (char *)&pInfo->cliIfData.cliData.rxByte, 1);
+        pInfo->cliIfData.binaryFrame.pfCalculateCrc = pConfig->pfCalculateCrc;
+        pInfo->cliIfData.useInsertDelete = (pConfig->editMode == ADI_CLI_EDIT_MODE_VT100);
+        pInfo->cliIfData.pCompleteTable = pConfig->pDispatchTable;
+        pInfo->cliIfData.numCompleteRecords = pConfig->numDispatchRecords;
+        /* Objects of an earlier adi_cli_Init may be held by another task, so keep them. */
+        if (ADI_RTOS_IS_CREATED(pInfo->cliIfData.txLock) == 0)
+        {
+            ADI_RTOS_MUTEX_NEW(pInfo->cliIfData.txLock);
+        }
+        if (ADI_RTOS_IS_CREATED(pInfo->events) == 0)
+        {
+            ADI_RTOS_EVENT_NEW(pInfo->events);
+        }
+        if ((ADI_RTOS_IS_CREATED(pInfo->cliIfData.txLock) == 0) ||
+            (ADI_RTOS_IS_CREATED(pInfo->events) == 0))
+        {
+            return ADI_CLI_STATUS_INIT_FAILED;
+        }
+        CliLogInit(&pInfo->logRing, pConfig->pLogBuffer, pConfig->logBufferNumWords);
+        if (pInfo->config.rxMode == ADI_CLI_RX_MODE_BLOCK)
+        {
+            status = ArmBlockReceive(pInfo);
+        }
+        else
+        {
+            status = pInfo->config.pfReceiveAsync(pInfo->config.hUser,
+                                                  (char *)&pInfo->cliIfData.cliData.rxByte, 1);
+        }
         if (status != 0)
         {
             cliStatus = ADI_CLI_STATUS_COMM_ERROR;
@@ -134,12 +305,32 @@ ADI_CLI_STATUS adi_cli_GetCmd(ADI_CLI_HANDLE hCli, char *pCommand)
     }
     else
     {
+        if (pInfo->cliIfData.cliData.isRxStalled)
+        {
+            if (ArmBlockReceive(pInfo) != 0)
+            {
+                return ADI_CLI_STATUS_COMM_ERROR;
+            }
+        }
         pTempCommand = &pInfo->cliIfData.cliString[0];
-        status = CliGetCmd(&pInfo->cliIfData, pTempCommand);
-        if (status != 0)
+        if (pInfo->cliIfData.pResumeRecord != NULL)
+        {
+            /* Input stays in the receive buffer until the command completes */
+            if (HasResumeSpace(pInfo))
+            {
+                CliResumeCommand(&pInfo->cliIfData);
+            }
+            status = ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS;
+        }
+        else if (CliGetCmd(&pInfo->cliIfData, pTempCommand) != 0)
         {
             status = ADI_CLI_STATUS_INVALID_COMMAND;
         }
+        else if (pInfo->cliIfData.binaryMode)
+        {
+            /* The frame stays in the command line buffer for adi_cli_Dispatch */
+            pCommand[0] = '\0';
+        }
         else
         {
             strcpy(pCommand, pTempCommand);
@@ -164,8 +355,20 @@ ADI_CLI_STATUS adi_cli_Dispatch(ADI_CLI_HANDLE hCli, char *pCommand, const Comma
     {
         pTrimCommand = pInfo->cliIfData.pCliTrimString;
         pInterfaceInfo = &pInfo->cliIfData;
-        TrimWhiteSpaces(pCommand, pTrimCommand);
-        status = CliParse(pInterfaceInfo, pTrimCommand, pDispatchTable, numRecords);
+        if (pInterfaceInfo->pResumeRecord != NULL)
+        {
+            /* The arguments of the command in progress live in the command buffers */
+            cliStatus = ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS;
+        }
+        else if (pInterfaceInfo->binaryFrame.isFramePending)
+        {
+            status = CliDispatchBinary(pInterfaceInfo, pDispatchTable, numRecords);
+        }
+        else
+        {
+            TrimWhiteSpaces(pCommand, pTrimCommand);
+            status = CliParse(pInterfaceInfo, pTrimCommand, pDispatchTable, numRecords);
+        }
         if (status != 0)
         {
             cliStatus = ADI_CLI_STATUS_INVALID_COMMAND;
@@ -193,6 +396,30 @@ ADI_CLI_STATUS adi_cli_RxCallback(ADI_CLI_HANDLE hCli)
         {
             cliStatus = ADI_CLI_STATUS_COMM_ERROR;
         }
+        ADI_RTOS_EVENT_SET(pInfo->events, ADI_CLI_EVENT_RX);
+    }
+    return cliStatus;
+}
+
+ADI_CLI_STATUS adi_cli_RxBlockCallback(ADI_CLI_HANDLE hCli, uint32_t numBytes)
+{
+    ADI_CLI_STATUS cliStatus = ADI_CLI_STATUS_SUCCESS;
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    if (hCli == NULL)
+    {
+        cliStatus = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        if (ADICircBufCommitWrite(pInfo->cliIfData.cliData.pRxBuff, numBytes) != 0)
+        {
+            cliStatus = ADI_CLI_STATUS_BUFFER_FULL;
+        }
+        if (ArmBlockReceive(pInfo) != 0)
+        {
+            cliStatus = ADI_CLI_STATUS_COMM_ERROR;
+        }
+        ADI_RTOS_EVENT_SET(pInfo->events, ADI_CLI_EVENT_RX);
     }
     return cliStatus;
 }
@@ -207,7 +434,14 @@ ADI_CLI_STATUS adi_cli_TxCallback(ADI_CLI_HANDLE hCli)
     }
     else
     {
+        pInfo->txTail = AdvanceTxIndex(pInfo, pInfo->txTail, pInfo->txInFlight);
+        pInfo->txInFlight = 0;
         pInfo->isTxComplete = 1;
+        if (StartTransmit(pInfo) != 0)
+        {
+            status = ADI_CLI_STATUS_COMM_ERROR;
+        }
+        ADI_RTOS_EVENT_SET(pInfo->events, ADI_CLI_EVENT_TX);
     }
     return status;
 }
@@ -215,38 +449,38 @@ ADI_CLI_STATUS adi_cli_TxCallback(ADI_CLI_HANDLE hCli)
 ADI_CLI_STATUS adi_cli_FlushMessages(ADI_CLI_HANDLE hCli)
 {
     ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
-    static int32_t bufId = 0;
     ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    BufferInfo *pBufferInfo;
+    uint32_t head;
     if (hCli == NULL)
     {
         return ADI_CLI_STATUS_NULL_PTR;
     }
     else
     {
-        /* Do not flush until previous transfer is complete*/
-        if ((pInfo->cliIfData.bufferInfo.bytesStored > 0) && (pInfo->isTxComplete == true))
+        pBufferInfo = &pInfo->cliIfData.bufferInfo;
+        ADI_RTOS_LOCK(pInfo->cliIfData.txLock);
+        adi_cli_FlushLog(hCli);
+        head = pInfo->txHead;
+        /* Queue the segment being filled if there is a free segment to continue filling */
+        if ((pBufferInfo->bytesStored > 0) &&
+            ((GetNumTxQueued(pInfo, head, pInfo->txTail) + 1u) < pInfo->numTxSegments))
         {
-            pInfo->isTxComplete = false;
-            status = pInfo->config.pfTransmitAsync(pInfo->config.hUser,
-                                                   pInfo->cliIfData.bufferInfo.pBufferToWrite,
-                                                   pInfo->cliIfData.bufferInfo.bytesStored);
-
-            if (bufId == 0)
-            {
-                pInfo->cliIfData.bufferInfo.pBufferToWrite = pInfo->cliBuffer1;
-            }
-            else
-            {
-                pInfo->cliIfData.bufferInfo.pBufferToWrite = pInfo->cliBuffer0;
-            }
-            // Toggle the bufID
-            bufId ^= 0x1;
-            pInfo->cliIfData.bufferInfo.bytesStored = 0;
+            GetTxSegment(pInfo, head)->numBytes = pBufferInfo->bytesStored;
+            head = AdvanceTxIndex(pInfo, head, 1);
+            pBufferInfo->pBufferToWrite = GetTxSegment(pInfo, head)->pData;
+            pBufferInfo->bytesStored = 0;
+            ADI_CIRC_BUF_STORE_INDEX(&pInfo->txHead, head);
         }
-        if ((pInfo->isTxComplete == false) || (pInfo->cliIfData.bufferInfo.bytesStored > 0))
+        if (StartTransmit(pInfo) != 0)
+        {
+            status = ADI_CLI_STATUS_COMM_ERROR;
+        }
+        else if ((pInfo->txTail != pInfo->txHead) || (pBufferInfo->bytesStored > 0))
         {
             status = ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS;
         }
+        ADI_RTOS_UNLOCK(pInfo->cliIfData.txLock);
     }
     return status;
 }
@@ -288,35 +522,161 @@ ADI_CLI_STATUS adi_cli_NewLine(ADI_CLI_HANDLE hCli)
 __attribute__((__format__(__printf__, 2, 0))) int32_t adi_cli_PrintMessage(char *pMsgType,
                                                                            char *pFormat, ...)
 {
-    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hTerminalHandle;
-    int32_t status = 0;
-    int32_t ret = 0;
+    ADI_CLI_INFO *pInfo;
+    int32_t status = 1;
+    int32_t isPrinted = 0;
+    va_list pArgs;
+    for (pInfo = pFirstInstance; pInfo != NULL; pInfo = pInfo->pNextInstance)
+    {
+        if (pInfo->isTerminal != 0)
+        {
+            va_start(pArgs, pFormat);
+            if (CliVPrintMessage(&pInfo->cliIfData, pMsgType, pFormat, pArgs) == 0)
+            {
+                isPrinted = 1;
+            }
+            va_end(pArgs);
+        }
+    }
+    if (isPrinted != 0)
+    {
+        status = 0;
+    }
+
+    return status;
+}
+
+__attribute__((__format__(__printf__, 3, 0))) ADI_CLI_STATUS
+adi_cli_Print(ADI_CLI_HANDLE hCli, const char *pMsgType, const char *pFormat, ...)
+{
+    ADI_CLI_STATUS status;
     va_list pArgs;
     va_start(pArgs, pFormat);
-    vsnprintf(pInfo->pMsgString, ADI_CLI_MAX_MSG_SIZE, pFormat, pArgs);
+    status = adi_cli_VPrint(hCli, pMsgType, pFormat, pArgs);
+    va_end(pArgs);
+    return status;
+}
 
-    if ((strcmp(pMsgType, "RAW") == 0) || (strcmp(pMsgType, "DBGRAW") == 0))
+__attribute__((__format__(__printf__, 3, 0))) ADI_CLI_STATUS
+adi_cli_VPrint(ADI_CLI_HANDLE hCli, const char *pMsgType, const char *pFormat, va_list pArgs)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    if (hCli == NULL || pMsgType == NULL || pFormat == NULL)
     {
-        va_end(pArgs);
-        /* Just print the message as such*/
-        status = CopyToBuffer(pInfo->pMsgString);
+        status = ADI_CLI_STATUS_NULL_PTR;
     }
-    else
+    else if (CliVPrintMessage(&pInfo->cliIfData, pMsgType, pFormat, pArgs) != 0)
     {
-        ret = snprintf(pInfo->pMsgStringToCopy, ADI_CLI_MAX_MSG_SIZE, "%s\n\r", pInfo->pMsgString);
-        va_end(pArgs);
-        if (ret >= 0)
-        {
+        status = ADI_CLI_STATUS_BUFFER_FULL;
+    }
+    return status;
+}
+
+__attribute__((__format__(__printf__, 3, 0))) ADI_CLI_STATUS
+adi_cli_Log(ADI_CLI_HANDLE hCli, ADI_CLI_LOG_LEVEL level, const char *pFormat, ...)
+{
+    ADI_CLI_STATUS status;
+    va_list pArgs;
+    va_start(pArgs, pFormat);
+    status = adi_cli_VLog(hCli, level, pFormat, pArgs);
+    va_end(pArgs);
+    return status;
+}
 
-            CopyToBuffer(pMsgType);
-            status = CopyToBuffer(pInfo->pMsgStringToCopy);
+__attribute__((__format__(__printf__, 2, 0))) ADI_CLI_STATUS
+adi_cli_LogMessage(ADI_CLI_LOG_LEVEL level, const char *pFormat, ...)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_NULL_PTR;
+    ADI_CLI_STATUS instanceStatus;
+    ADI_CLI_INFO *pInfo;
+    va_list pArgs;
+    for (pInfo = pFirstInstance; pInfo != NULL; pInfo = pInfo->pNextInstance)
+    {
+        if (pInfo->isTerminal != 0)
+        {
+            va_start(pArgs, pFormat);
+            instanceStatus = adi_cli_VLog(pInfo, level, pFormat, pArgs);
+            va_end(pArgs);
+            if ((status == ADI_CLI_STATUS_NULL_PTR) || (status == ADI_CLI_STATUS_SUCCESS))
+            {
+                status = instanceStatus;
+            }
         }
-        else
+    }
+    return status;
+}
+
+__attribute__((__format__(__printf__, 3, 0))) ADI_CLI_STATUS
+adi_cli_VLog(ADI_CLI_HANDLE hCli, ADI_CLI_LOG_LEVEL level, const char *pFormat, va_list pArgs)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    if (hCli == NULL || pFormat == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else if ((uint32_t)level >= (uint32_t)ADI_CLI_LOG_NUM_LEVELS)
+    {
+        status = ADI_CLI_STATUS_INVALID_ARGUMENT;
+    }
+    else if (pInfo->logRing.pBase == NULL)
+    {
+        if (CliVPrintMessage(&pInfo->cliIfData, logMsgTypes[level], pFormat, pArgs) != 0)
         {
-            status = 1;
+            status = ADI_CLI_STATUS_BUFFER_FULL;
         }
     }
+    else if (CliLogVWrite(&pInfo->logRing, (uint32_t)level, pFormat, pArgs) != 0)
+    {
+        status = ADI_CLI_STATUS_BUFFER_FULL;
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_FlushLog(ADI_CLI_HANDLE hCli)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    BufferInfo *pBufferInfo;
+    uint8_t *pData;
+    uint32_t numFreeBytes;
+    uint32_t maxNumWords;
+    uint32_t numWords;
+    uint32_t numDropped;
+    if (hCli == NULL)
+    {
+        return ADI_CLI_STATUS_NULL_PTR;
+    }
 
+    pBufferInfo = &pInfo->cliIfData.bufferInfo;
+    ADI_RTOS_LOCK(pInfo->cliIfData.txLock);
+    while ((pInfo->logRing.pBase != NULL) && (status == ADI_CLI_STATUS_SUCCESS))
+    {
+        numFreeBytes = pBufferInfo->bufferSize - pBufferInfo->bytesStored;
+        if (numFreeBytes < CLI_LOG_FRAME_OVERHEAD_NUM_BYTES)
+        {
+            break;
+        }
+        /* The frame starts with the count of dropped records */
+        maxNumWords = (numFreeBytes - CLI_LOG_FRAME_OVERHEAD_NUM_BYTES) / sizeof(uint32_t);
+        if (maxNumWords > CLI_LOG_FRAME_MAX_NUM_WORDS)
+        {
+            maxNumWords = CLI_LOG_FRAME_MAX_NUM_WORDS;
+        }
+        pData = &pBufferInfo->pBufferToWrite[pBufferInfo->bytesStored +
+                                             ADI_CLI_BINARY_HEADER_NUM_BYTES];
+        numWords = CliLogRead(&pInfo->logRing, &pData[sizeof(uint32_t)], maxNumWords);
+        numDropped = CliLogTakeDropped(&pInfo->logRing);
+        if ((numWords == 0) && (numDropped == 0))
+        {
+            break;
+        }
+        memcpy(pData, &numDropped, sizeof(uint32_t));
+        status = adi_cli_CommitBinaryFrame(hCli, ADI_CLI_BINARY_LOG_ID,
+                                           (numWords + 1) * sizeof(uint32_t));
+    }
+    ADI_RTOS_UNLOCK(pInfo->cliIfData.txLock);
     return status;
 }
 
@@ -351,7 +711,7 @@ ADI_CLI_STATUS adi_cli_SetHandleTerminal(ADI_CLI_HANDLE hCli)
     }
     else
     {
-        hTerminalHandle = hCli;
+        ((ADI_CLI_INFO *)hCli)->isTerminal = 1;
     }
     return status;
 }
@@ -447,7 +807,154 @@ ADI_CLI_STATUS adi_cli_GetFreeMessageSpace(ADI_CLI_HANDLE hCli, uint32_t *pFreeS
     }
     else
     {
-        *pFreeSpace = ADI_CLI_MAX_SIZE - pInfo->cliIfData.bufferInfo.bytesStored;
+        *pFreeSpace =
+            pInfo->cliIfData.bufferInfo.bufferSize - pInfo->cliIfData.bufferInfo.bytesStored;
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_GetTxSpace(ADI_CLI_HANDLE hCli, uint8_t **ppData, uint32_t *pNumBytes)
+{
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    BufferInfo *pBufferInfo;
+    if (hCli == NULL || ppData == NULL || pNumBytes == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        pBufferInfo = &pInfo->cliIfData.bufferInfo;
+        *ppData = &pBufferInfo->pBufferToWrite[pBufferInfo->bytesStored];
+        *pNumBytes = pBufferInfo->bufferSize - pBufferInfo->bytesStored;
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_CommitTx(ADI_CLI_HANDLE hCli, uint32_t numBytes)
+{
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    BufferInfo *pBufferInfo;
+    if (hCli == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        pBufferInfo = &pInfo->cliIfData.bufferInfo;
+        ADI_RTOS_LOCK(pInfo->cliIfData.txLock);
+        if (numBytes > pBufferInfo->bufferSize - pBufferInfo->bytesStored)
+        {
+            status = ADI_CLI_STATUS_BUFFER_FULL;
+        }
+        else
+        {
+            pBufferInfo->bytesStored += numBytes;
+        }
+        ADI_RTOS_UNLOCK(pInfo->cliIfData.txLock);
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_Lock(ADI_CLI_HANDLE hCli)
+{
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    if (hCli == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->cliIfData.txLock);
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_Unlock(ADI_CLI_HANDLE hCli)
+{
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    if (hCli == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_UNLOCK(pInfo->cliIfData.txLock);
+    }
+    return status;
+}
+
+#ifdef CMSIS_OS2
+ADI_CLI_STATUS adi_cli_WaitEvent(ADI_CLI_HANDLE hCli, uint32_t events, uint32_t timeout,
+                                 uint32_t *pEvents)
+{
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    uint32_t flags;
+    if (hCli == NULL || pEvents == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        flags = osEventFlagsWait(pInfo->events, events, osFlagsWaitAny, timeout);
+        *pEvents = flags;
+        /* Error codes have the most significant bit set */
+        if ((flags & osFlagsError) != 0)
+        {
+            *pEvents = 0;
+            if (flags != (uint32_t)osFlagsErrorTimeout)
+            {
+                status = ADI_CLI_STATUS_COMM_ERROR;
+            }
+        }
+    }
+    return status;
+}
+#endif
+
+ADI_CLI_STATUS adi_cli_CommitBinaryFrame(ADI_CLI_HANDLE hCli, uint8_t cmdId, uint32_t numBytes)
+{
+    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hCli;
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    BufferInfo *pBufferInfo;
+    uint8_t *pFrame;
+    uint32_t length = numBytes + 1;
+    uint16_t crc;
+    if (hCli == NULL || pInfo->config.pfCalculateCrc == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else if (length > 0xFFFFu)
+    {
+        status = ADI_CLI_STATUS_INVALID_ARGUMENT;
+    }
+    else
+    {
+        pBufferInfo = &pInfo->cliIfData.bufferInfo;
+        ADI_RTOS_LOCK(pInfo->cliIfData.txLock);
+        if (ADI_CLI_BINARY_HEADER_NUM_BYTES + numBytes + ADI_CLI_BINARY_CRC_NUM_BYTES >
+            pBufferInfo->bufferSize - pBufferInfo->bytesStored)
+        {
+            status = ADI_CLI_STATUS_BUFFER_FULL;
+        }
+        else
+        {
+            pFrame = &pBufferInfo->pBufferToWrite[pBufferInfo->bytesStored];
+            pFrame[0] = ADI_CLI_BINARY_SYNC;
+            pFrame[1] = (uint8_t)length;
+            pFrame[2] = (uint8_t)(length >> 8);
+            pFrame[3] = cmdId;
+            crc = (uint16_t)pInfo->config.pfCalculateCrc(&pFrame[1], length + 2);
+            pFrame[ADI_CLI_BINARY_HEADER_NUM_BYTES + numBytes] = (uint8_t)crc;
+            pFrame[ADI_CLI_BINARY_HEADER_NUM_BYTES + numBytes + 1] = (uint8_t)(crc >> 8);
+            pBufferInfo->bytesStored +=
+                ADI_CLI_BINARY_HEADER_NUM_BYTES + numBytes + ADI_CLI_BINARY_CRC_NUM_BYTES;
+        }
+        ADI_RTOS_UNLOCK(pInfo->cliIfData.txLock);
     }
     return status;
 }
@@ -462,40 +969,180 @@ void *GetHandleForDispatchCommands(ADI_CLI_HANDLE hCli)
     return &pInfo->cliIfData;
 }
 
-static void InitCircBuff(CLI_PRIVATE *pInfo)
+static void InitCircBuff(CLI_PRIVATE *pInfo, uint8_t *pBuffer, uint32_t bufferSize)
 {
     ADI_CLI_RX_DATA *pCliData = &pInfo->cliData;
 
     // Initialize Receive Buffer
     pCliData->pRxBuff = &pCliData->rxCircBuff;
-    pCliData->pRxBuff->pBase = (uint8_t *)&pCliData->rxBuff[0];
-    pCliData->pRxBuff->nSize = RX_BUFFER_SIZE;
+    pCliData->pRxBuff->pBase = pBuffer;
+    pCliData->pRxBuff->nSize = bufferSize;
     pCliData->pRxBuff->nReadIndex = 0;
     pCliData->pRxBuff->nWriteIndex = 0;
 }
 
-int32_t CopyToBuffer(char *pMessage)
+static void InitTxBuffers(ADI_CLI_INFO *pInfo, uint8_t *pBuffer, uint32_t bufferSize,
+                          uint32_t numSegments)
+{
+    uint32_t i;
+    uint32_t segmentSize;
+
+    numSegments = GetNumTxSegments(numSegments);
+    segmentSize = bufferSize / numSegments;
+
+    for (i = 0; i < numSegments; i++)
+    {
+        pInfo->txSegments[i].pData = (pBuffer != NULL) ? &pBuffer[i * segmentSize] : NULL;
+        pInfo->txSegments[i].numBytes = 0;
+    }
+    pInfo->numTxSegments = numSegments;
+    pInfo->txHead = 0;
+    pInfo->txTail = 0;
+    pInfo->txInFlight = 0;
+    pInfo->cliIfData.bufferInfo.pBufferToWrite = pInfo->txSegments[0].pData;
+    pInfo->cliIfData.bufferInfo.bufferSize = segmentSize;
+    pInfo->cliIfData.bufferInfo.bytesStored = 0;
+}
+
+static uint32_t GetNumTxSegments(uint32_t numSegments)
+{
+    if (numSegments < 2)
+    {
+        numSegments = 2;
+    }
+    if (numSegments > ADI_CLI_MAX_TX_SEGMENTS)
+    {
+        numSegments = ADI_CLI_MAX_TX_SEGMENTS;
+    }
+
+    return numSegments;
+}
+
+static uint32_t GetTxSegmentSize(ADI_CLI_INFO *pInfo, ADI_CLI_CONFIG *pConfig)
+{
+    /* Without a transmit buffer the segments set up by adi_cli_Create are kept */
+    uint32_t segmentSize = pInfo->cliIfData.bufferInfo.bufferSize;
+
+    if (pConfig->pTxBuffer != NULL)
+    {
+        segmentSize = pConfig->txBufferSize / GetNumTxSegments(pConfig->numTxSegments);
+    }
+    else if ((pInfo->pDefaultTxBuffer == NULL) || (pConfig->numTxSegments != 0))
+    {
+        /* The missing default buffer is reported as insufficient state memory */
+        segmentSize = (2 * ADI_CLI_MAX_SIZE) / GetNumTxSegments(pConfig->numTxSegments);
+    }
+
+    return segmentSize;
+}
+
+static uint32_t AdvanceTxIndex(ADI_CLI_INFO *pInfo, uint32_t index, uint32_t numSegments)
+{
+    /* Wrapping at twice the number of segments tells a full queue from an empty one for any
+     * number of segments */
+    index += numSegments;
+    if (index >= (2u * pInfo->numTxSegments))
+    {
+        index -= 2u * pInfo->numTxSegments;
+    }
+
+    return index;
+}
+
+static uint32_t GetNumTxQueued(ADI_CLI_INFO *pInfo, uint32_t head, uint32_t tail)
+{
+    uint32_t numQueued = head - tail;
+
+    if (head < tail)
+    {
+        numQueued += 2u * pInfo->numTxSegments;
+    }
+
+    return numQueued;
+}
+
+static ADI_CLI_TX_SEGMENT *GetTxSegment(ADI_CLI_INFO *pInfo, uint32_t index)
+{
+    if (index >= pInfo->numTxSegments)
+    {
+        index -= pInfo->numTxSegments;
+    }
+
+    return &pInfo->txSegments[index];
+}
+
+static int32_t StartTransmit(ADI_CLI_INFO *pInfo)
+{
+    int32_t status = 0;
+    uint32_t tail = pInfo->txTail;
+    uint32_t numQueued = GetNumTxQueued(pInfo, ADI_CIRC_BUF_LOAD_INDEX(&pInfo->txHead), tail);
+    uint32_t i;
+    ADI_CLI_TX_SEGMENT *pSegment;
+
+    if ((pInfo->isTxComplete == true) && (numQueued > 0))
+    {
+        pInfo->isTxComplete = false;
+        if (pInfo->config.pfTransmitVectorAsync != NULL)
+        {
+            for (i = 0; i < numQueued; i++)
+            {
+                pInfo->txVector[i] = *GetTxSegment(pInfo, AdvanceTxIndex(pInfo, tail, i));
+            }
+            pInfo->txInFlight = numQueued;
+            status = pInfo->config.pfTransmitVectorAsync(pInfo->config.hUser, pInfo->txVector,
+                                                         numQueued);
+        }
+        else
+        {
+            pSegment = GetTxSegment(pInfo, tail);
+            pInfo->txInFlight = 1;
+            status = pInfo->config.pfTransmitAsync(pInfo->config.hUser, pSegment->pData,
+                                                   pSegment->numBytes);
+        }
+        if (status != 0)
+        {
+            /* Leave the segments queued so that the next flush retries them */
+            pInfo->txInFlight = 0;
+            pInfo->isTxComplete = true;
+        }
+    }
+
+    return status;
+}
+
+static int32_t ArmBlockReceive(ADI_CLI_INFO *pInfo)
 {
-    ADI_CLI_INFO *pInfo = (ADI_CLI_INFO *)hTerminalHandle;
-    uint8_t *pBufferToWrite = pInfo->cliIfData.bufferInfo.pBufferToWrite;
-    int32_t space = (int32_t)(ADI_CLI_MAX_SIZE - pInfo->cliIfData.bufferInfo.bytesStored - 1);
-    int32_t bytesToWrite = (int32_t)strlen(pMessage);
     int32_t status = 0;
+    ADI_CLI_RX_DATA *pCliData = &pInfo->cliIfData.cliData;
+    uint8_t *pRegion;
+    uint32_t numBytes;
 
-    if (space >= bytesToWrite)
+    if (ADICircBufGetWriteRegion(pCliData->pRxBuff, &pRegion, &numBytes) == 0)
     {
-        memcpy(&pBufferToWrite[pInfo->cliIfData.bufferInfo.bytesStored], pMessage,
-               (size_t)bytesToWrite);
-        pInfo->cliIfData.bufferInfo.bytesStored += (uint32_t)bytesToWrite;
+        pCliData->isRxStalled = false;
+        status = pInfo->config.pfReceiveAsync(pInfo->config.hUser, (char *)pRegion, numBytes);
     }
     else
     {
-        status = 1;
+        pCliData->isRxStalled = true;
     }
 
     return status;
 }
 
+static bool HasResumeSpace(ADI_CLI_INFO *pInfo)
+{
+    BufferInfo *pBufferInfo = &pInfo->cliIfData.bufferInfo;
+    uint32_t numBytes = pInfo->config.resumeNumBytes;
+
+    if ((numBytes == 0) || (numBytes > pBufferInfo->bufferSize))
+    {
+        numBytes = pBufferInfo->bufferSize;
+    }
+
+    return (pBufferInfo->bufferSize - pBufferInfo->bytesStored) >= numBytes;
+}
+
 static void IntialiseStateData(ADI_CLI_INFO *pInfo)
 {
     pInfo->cliIfData.echo = true;
@@ -504,8 +1151,6 @@ static void IntialiseStateData(ADI_CLI_INFO *pInfo)
     pInfo->cliIfData.userIsTyping = false;
     pInfo->cliIfData.displayCtrlChars = true;
     pInfo->isTxComplete = 1;
-    pInfo->cliIfData.bufferInfo.bytesStored = 0;
-    pInfo->cliIfData.bufferInfo.pBufferToWrite = &pInfo->cliBuffer0[0];
 }
 
 static void AllocateTempMem(ADI_CLI_INFO *pInfo)
@@ -515,9 +1160,31 @@ static void AllocateTempMem(ADI_CLI_INFO *pInfo)
         (char *)&pInfo->pTempMemory[1 * APP_CFG_CLI_MAX_CMD_LENGTH];
     pInfo->cliIfData.pCliTrimString = (char *)&pInfo->pTempMemory[2 * APP_CFG_CLI_MAX_CMD_LENGTH];
     pInfo->cliIfData.pCliPrintString = (char *)&pInfo->pTempMemory[3 * APP_CFG_CLI_MAX_CMD_LENGTH];
-    pInfo->pMsgString = (char *)&pInfo->pTempMemory[4 * APP_CFG_CLI_MAX_CMD_LENGTH];
-    pInfo->pMsgStringToCopy =
-        (char *)&pInfo->pTempMemory[(5 * APP_CFG_CLI_MAX_CMD_LENGTH) + ADI_CLI_MAX_MSG_SIZE];
+}
+
+static int32_t IsInstanceListed(ADI_CLI_INFO *pInfo)
+{
+    ADI_CLI_INFO *pListed = pFirstInstance;
+    while ((pListed != NULL) && (pListed != pInfo))
+    {
+        pListed = pListed->pNextInstance;
+    }
+
+    return (pListed != NULL) ? 1 : 0;
+}
+
+static void AddInstance(ADI_CLI_INFO *pInfo, ADI_CLI_INFO *pNext, int32_t isListed)
+{
+    if (isListed != 0)
+    {
+        pInfo->pNextInstance = pNext;
+    }
+    else
+    {
+        /* Link the instance before publishing it, so a concurrent print walks a complete list */
+        pInfo->pNextInstance = pFirstInstance;
+        pFirstInstance = pInfo;
+    }
 }
 
 /**
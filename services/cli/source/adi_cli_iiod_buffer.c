@@ -0,0 +1,508 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file adi_cli_iiod_buffer.c
+ * @brief Buffer engine for the open, readbuf and close commands of IIOD.
+ *
+ * Packed samples follow the layout libiio expects for a buffer: the enabled channels in
+ * scan_index order, each aligned to its own storage size, holding the value masked to realbits
+ * and shifted left by shift. Samples are never copied between the ring and the transmit
+ * segments, they are packed straight from the ring into the segment being filled.
+ * @{
+ */
+
+/*============= I N C L U D E S =============*/
+#include "adi_cli_iiod_buffer.h"
+#include "adi_circ_buf.h"
+#include "adi_cli.h"
+#include "adi_cli_iiod_xml.h"
+#include "adi_cli_status.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*============= D E F I N E S =============*/
+
+/** Number of bytes a binary frame adds to the data */
+#define IIOD_BUFFER_FRAME_OVERHEAD_NUM_BYTES                                                       \
+    (ADI_CLI_BINARY_HEADER_NUM_BYTES + ADI_CLI_BINARY_CRC_NUM_BYTES)
+/** Maximum number of data bytes of a binary frame, one byte of the length is the command ID */
+#define IIOD_BUFFER_MAX_FRAME_NUM_BYTES 0xFFFEu
+
+/*============= F U N C T I O N  P R O T O T Y P E S =============*/
+
+/**
+ * @brief Gets the packing of a channel from its scan type.
+ * @param pChannel - Pointer to the channel.
+ * @param channel - Index of the channel in a raw sample.
+ * @param[out] pElement - Pointer to the packing.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_INVALID_ARGUMENT if the scan type is missing or not supported.
+ */
+static ADI_CLI_STATUS IiodBufferGetElement(ChannelParams *pChannel, uint8_t channel,
+                                           IioScanElement *pElement);
+
+/**
+ * @brief Gets the number of samples of the next data frame.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param numFreeBytes - Number of free bytes of the transmit segment.
+ * @param numSamples - Number of samples in the ring.
+ * @return Number of samples that fit, 0 if not even one does.
+ */
+static uint32_t IiodBufferGetFrameNumSamples(IioBuffer *pBuffer, uint32_t numFreeBytes,
+                                             uint32_t numSamples);
+
+/**
+ * @brief Gets space for the next data frame, queueing the segment being filled when it is too
+ * small.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param hCli - Handle to the CLI instance.
+ * @param numSamples - Number of samples in the ring.
+ * @param[out] ppData - Pointer to store the start of the frame.
+ * @param[out] pNumFrameSamples - Pointer to store the number of samples of the frame, 0 when
+ * the segments are all queued.
+ * @return #ADI_CLI_STATUS_SUCCESS on success,
+ *         #ADI_CLI_STATUS_BUFFER_FULL if an empty segment cannot hold one sample,
+ *         #ADI_CLI_STATUS_COMM_ERROR if the transmission could not be started.
+ */
+static ADI_CLI_STATUS IiodBufferGetFrame(IioBuffer *pBuffer, ADI_CLI_HANDLE hCli,
+                                         uint32_t numSamples, uint8_t **ppData,
+                                         uint32_t *pNumFrameSamples);
+
+/**
+ * @brief Advances the head or tail of the ring, wrapping it at twice the size of the ring.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param index - Head or tail.
+ * @param numSamples - Number of samples to advance by, at most ringNumSamples.
+ * @return Advanced index.
+ */
+static uint32_t IiodBufferAdvance(IioBuffer *pBuffer, uint32_t index, uint32_t numSamples);
+
+/**
+ * @brief Gets the number of samples from the tail up to the head of the ring.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param head - Head of the ring.
+ * @param tail - Tail of the ring.
+ * @return Number of samples in the ring.
+ */
+static uint32_t IiodBufferGetNumSamples(IioBuffer *pBuffer, uint32_t head, uint32_t tail);
+
+/**
+ * @brief Gets the sample of the ring at the head or tail.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param index - Head or tail.
+ * @return Index of the sample in the ring.
+ */
+static uint32_t IiodBufferGetOffset(IioBuffer *pBuffer, uint32_t index);
+
+/**
+ * @brief Packs samples from the tail of the ring.
+ * @param pBuffer - Pointer to the buffer state.
+ * @param pDst - Pointer to the packed samples.
+ * @param numSamples - Number of samples to pack.
+ */
+static void IiodBufferPack(IioBuffer *pBuffer, uint8_t *pDst, uint32_t numSamples);
+
+/*============= F U N C T I O N S =============*/
+
+ADI_CLI_STATUS adi_cli_IiodBufferInit(IioBuffer *pBuffer, DeviceAttributes *pDevice,
+                                      int32_t *pRing, uint32_t ringNumSamples)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    if ((pBuffer == NULL) || (pDevice == NULL) || (pRing == NULL) ||
+        (pDevice->channels == NULL))
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else if ((pDevice->numChannel == 0) ||
+             (pDevice->numChannel > ADI_CLI_IIOD_BUFFER_MAX_CHANNELS) || (ringNumSamples == 0) ||
+             (ringNumSamples > ADI_CLI_IIOD_BUFFER_MAX_RING_SAMPLES))
+    {
+        status = ADI_CLI_STATUS_INVALID_ARGUMENT;
+    }
+    else
+    {
+        memset(pBuffer, 0, sizeof(IioBuffer));
+        pBuffer->pDevice = pDevice;
+        pBuffer->pRing = pRing;
+        pBuffer->ringNumSamples = ringNumSamples;
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_IiodBufferOpen(IioBuffer *pBuffer, uint32_t mask)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    ChannelParams *pChannels;
+    IioScanElement element;
+    uint32_t numElements = 0;
+    uint32_t offset = 0;
+    uint32_t i;
+    uint32_t j;
+
+    if (pBuffer == NULL)
+    {
+        return ADI_CLI_STATUS_NULL_PTR;
+    }
+
+    pBuffer->isOpen = false;
+    pBuffer->numBytesLeft = 0;
+    pChannels = pBuffer->pDevice->channels;
+    for (i = 0; (status == ADI_CLI_STATUS_SUCCESS) && (i < pBuffer->pDevice->numChannel); i++)
+    {
+        if ((mask & (1u << i)) != 0)
+        {
+            status = IiodBufferGetElement(&pChannels[i], (uint8_t)i, &element);
+        }
+        if (((mask & (1u << i)) != 0) && (status == ADI_CLI_STATUS_SUCCESS))
+        {
+            // Insertion in scan_index order, the masks hold few channels.
+            j = numElements;
+            while ((j > 0) && (pChannels[pBuffer->elements[j - 1].channel].scan_index >
+                               pChannels[i].scan_index))
+            {
+                pBuffer->elements[j] = pBuffer->elements[j - 1];
+                j--;
+            }
+            pBuffer->elements[j] = element;
+            numElements++;
+        }
+    }
+    if ((status == ADI_CLI_STATUS_SUCCESS) && (numElements == 0))
+    {
+        status = ADI_CLI_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (status == ADI_CLI_STATUS_SUCCESS)
+    {
+        pBuffer->hasPadding = false;
+        for (i = 0; i < numElements; i++)
+        {
+            if ((offset % pBuffer->elements[i].numBytes) != 0)
+            {
+                offset += pBuffer->elements[i].numBytes - (offset % pBuffer->elements[i].numBytes);
+                pBuffer->hasPadding = true;
+            }
+            pBuffer->elements[i].offset = (uint16_t)offset;
+            offset += pBuffer->elements[i].numBytes;
+        }
+        pBuffer->numElements = numElements;
+        pBuffer->sampleNumBytes = offset;
+        pBuffer->head = 0;
+        pBuffer->tail = 0;
+        pBuffer->isOpen = true;
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_IiodBufferClose(IioBuffer *pBuffer)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    if (pBuffer == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        pBuffer->isOpen = false;
+        pBuffer->numBytesLeft = 0;
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_IiodBufferGetWriteBlock(IioBuffer *pBuffer, int32_t **ppSamples,
+                                               uint32_t *pNumSamples)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    uint32_t head;
+    uint32_t numFree;
+    uint32_t numToEnd;
+
+    if ((pBuffer == NULL) || (ppSamples == NULL) || (pNumSamples == NULL))
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else
+    {
+        head = pBuffer->head;
+        numFree = pBuffer->ringNumSamples -
+                  IiodBufferGetNumSamples(pBuffer, head, ADI_CIRC_BUF_LOAD_INDEX(&pBuffer->tail));
+        numToEnd = pBuffer->ringNumSamples - IiodBufferGetOffset(pBuffer, head);
+        *pNumSamples = (numFree < numToEnd) ? numFree : numToEnd;
+        *ppSamples =
+            &pBuffer->pRing[IiodBufferGetOffset(pBuffer, head) * pBuffer->pDevice->numChannel];
+        if ((pBuffer->isOpen == false) || (numFree == 0))
+        {
+            *pNumSamples = 0;
+            status = ADI_CLI_STATUS_BUFFER_FULL;
+        }
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_IiodBufferCommitWrite(IioBuffer *pBuffer, uint32_t numSamples)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    uint32_t head;
+
+    if (pBuffer == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else if (pBuffer->isOpen == true)
+    {
+        head = pBuffer->head;
+        if (numSamples >
+            pBuffer->ringNumSamples -
+                IiodBufferGetNumSamples(pBuffer, head, ADI_CIRC_BUF_LOAD_INDEX(&pBuffer->tail)))
+        {
+            status = ADI_CLI_STATUS_BUFFER_FULL;
+        }
+        else
+        {
+            ADI_CIRC_BUF_STORE_INDEX(&pBuffer->head, IiodBufferAdvance(pBuffer, head, numSamples));
+        }
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_IiodBufferRead(IioBuffer *pBuffer, uint32_t numBytes, uint8_t cmdId)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    if (pBuffer == NULL)
+    {
+        status = ADI_CLI_STATUS_NULL_PTR;
+    }
+    else if (pBuffer->isOpen == false)
+    {
+        status = ADI_CLI_STATUS_INVALID_COMMAND;
+    }
+    else
+    {
+        pBuffer->numBytesLeft = numBytes - (numBytes % pBuffer->sampleNumBytes);
+        pBuffer->cmdId = cmdId;
+    }
+    return status;
+}
+
+ADI_CLI_STATUS adi_cli_IiodBufferStream(IioBuffer *pBuffer, ADI_CLI_HANDLE hCli)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    ADI_CLI_STATUS flushStatus;
+    uint8_t *pData = NULL;
+    uint32_t numSamples = 1;
+    uint32_t numFrameSamples = 1;
+    uint32_t numBytes;
+
+    if ((pBuffer == NULL) || (hCli == NULL))
+    {
+        return ADI_CLI_STATUS_NULL_PTR;
+    }
+
+    while ((status == ADI_CLI_STATUS_SUCCESS) && (pBuffer->numBytesLeft > 0) &&
+           (numSamples > 0) && (numFrameSamples > 0))
+    {
+        numSamples = IiodBufferGetNumSamples(pBuffer, ADI_CIRC_BUF_LOAD_INDEX(&pBuffer->head),
+                                             pBuffer->tail);
+        if (numSamples > 0)
+        {
+            status = IiodBufferGetFrame(pBuffer, hCli, numSamples, &pData, &numFrameSamples);
+        }
+        if ((status == ADI_CLI_STATUS_SUCCESS) && (numSamples > 0) && (numFrameSamples > 0))
+        {
+            numBytes = numFrameSamples * pBuffer->sampleNumBytes;
+            IiodBufferPack(pBuffer, &pData[ADI_CLI_BINARY_HEADER_NUM_BYTES], numFrameSamples);
+            status = adi_cli_CommitBinaryFrame(hCli, pBuffer->cmdId, numBytes);
+            if (status == ADI_CLI_STATUS_SUCCESS)
+            {
+                ADI_CIRC_BUF_STORE_INDEX(&pBuffer->tail,
+                                         IiodBufferAdvance(pBuffer, pBuffer->tail,
+                                                           numFrameSamples));
+                pBuffer->numBytesLeft -= numBytes;
+            }
+        }
+    }
+
+    if (status == ADI_CLI_STATUS_SUCCESS)
+    {
+        // Queue the last frames without waiting for the segment to fill.
+        flushStatus = adi_cli_FlushMessages(hCli);
+        if (flushStatus == ADI_CLI_STATUS_COMM_ERROR)
+        {
+            status = flushStatus;
+        }
+        else if (pBuffer->numBytesLeft > 0)
+        {
+            status = ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS;
+        }
+    }
+    return status;
+}
+
+static ADI_CLI_STATUS IiodBufferGetElement(ChannelParams *pChannel, uint8_t channel,
+                                           IioScanElement *pElement)
+{
+    ADI_CLI_STATUS status = ADI_CLI_STATUS_SUCCESS;
+    scanType *pScanType = pChannel->pScanType;
+
+    if ((pScanType == NULL) || (pScanType->realbits == 0) || (pScanType->storagebits == 0) ||
+        (pScanType->storagebits > 32) || ((pScanType->storagebits % 8) != 0) ||
+        (pScanType->realbits + pScanType->shift > pScanType->storagebits))
+    {
+        status = ADI_CLI_STATUS_INVALID_ARGUMENT;
+    }
+    else
+    {
+        pElement->mask =
+            (pScanType->realbits >= 32) ? 0xFFFFFFFFu : ((1u << pScanType->realbits) - 1u);
+        pElement->offset = 0;
+        pElement->channel = channel;
+        pElement->numBytes = pScanType->storagebits / 8;
+        pElement->shift = pScanType->shift;
+        pElement->isBigEndian = pScanType->isBigEndian;
+    }
+    return status;
+}
+
+static uint32_t IiodBufferGetFrameNumSamples(IioBuffer *pBuffer, uint32_t numFreeBytes,
+                                             uint32_t numSamples)
+{
+    uint32_t numFrameSamples = 0;
+    uint32_t maxNumBytes;
+
+    if (numFreeBytes > IIOD_BUFFER_FRAME_OVERHEAD_NUM_BYTES)
+    {
+        maxNumBytes = numFreeBytes - IIOD_BUFFER_FRAME_OVERHEAD_NUM_BYTES;
+        if (maxNumBytes > IIOD_BUFFER_MAX_FRAME_NUM_BYTES)
+        {
+            maxNumBytes = IIOD_BUFFER_MAX_FRAME_NUM_BYTES;
+        }
+        if (maxNumBytes > pBuffer->numBytesLeft)
+        {
+            maxNumBytes = pBuffer->numBytesLeft;
+        }
+        numFrameSamples = maxNumBytes / pBuffer->sampleNumBytes;
+        if (numFrameSamples > numSamples)
+        {
+            numFrameSamples = numSamples;
+        }
+    }
+    return numFrameSamples;
+}
+
+static ADI_CLI_STATUS IiodBufferGetFrame(IioBuffer *pBuffer, ADI_CLI_HANDLE hCli,
+                                         uint32_t numSamples, uint8_t **ppData,
+                                         uint32_t *pNumFrameSamples)
+{
+    ADI_CLI_STATUS status;
+    bool isIdle;
+    uint32_t numFreeBytes = 0;
+
+    status = adi_cli_GetTxSpace(hCli, ppData, &numFreeBytes);
+    *pNumFrameSamples = IiodBufferGetFrameNumSamples(pBuffer, numFreeBytes, numSamples);
+    if ((status == ADI_CLI_STATUS_SUCCESS) && (*pNumFrameSamples == 0))
+    {
+        status = adi_cli_FlushMessages(hCli);
+        isIdle = (status == ADI_CLI_STATUS_SUCCESS);
+        if ((status == ADI_CLI_STATUS_SUCCESS) ||
+            (status == ADI_CLI_STATUS_TRANSMISSION_IN_PROGRESS))
+        {
+            status = adi_cli_GetTxSpace(hCli, ppData, &numFreeBytes);
+            *pNumFrameSamples = IiodBufferGetFrameNumSamples(pBuffer, numFreeBytes, numSamples);
+            // With nothing left to transmit the segment is empty, so a sample never fits.
+            if ((*pNumFrameSamples == 0) && isIdle)
+            {
+                status = ADI_CLI_STATUS_BUFFER_FULL;
+            }
+        }
+    }
+    return status;
+}
+
+static uint32_t IiodBufferAdvance(IioBuffer *pBuffer, uint32_t index, uint32_t numSamples)
+{
+    // Wrapping at twice the size tells a full ring from an empty one for any size of the ring.
+    index += numSamples;
+    if (index >= (2u * pBuffer->ringNumSamples))
+    {
+        index -= 2u * pBuffer->ringNumSamples;
+    }
+    return index;
+}
+
+static uint32_t IiodBufferGetNumSamples(IioBuffer *pBuffer, uint32_t head, uint32_t tail)
+{
+    uint32_t numSamples = head - tail;
+
+    if (head < tail)
+    {
+        numSamples += 2u * pBuffer->ringNumSamples;
+    }
+    return numSamples;
+}
+
+static uint32_t IiodBufferGetOffset(IioBuffer *pBuffer, uint32_t index)
+{
+    if (index >= pBuffer->ringNumSamples)
+    {
+        index -= pBuffer->ringNumSamples;
+    }
+    return index;
+}
+
+static void IiodBufferPack(IioBuffer *pBuffer, uint8_t *pDst, uint32_t numSamples)
+{
+    uint32_t index = IiodBufferGetOffset(pBuffer, pBuffer->tail);
+    uint32_t numChannels = pBuffer->pDevice->numChannel;
+    IioScanElement *pElement;
+    int32_t *pRaw;
+    uint8_t *pOut;
+    uint32_t value;
+    uint32_t i;
+    uint32_t n;
+
+    while (numSamples > 0)
+    {
+        pRaw = &pBuffer->pRing[index * numChannels];
+        if (pBuffer->hasPadding)
+        {
+            memset(pDst, 0, pBuffer->sampleNumBytes);
+        }
+        for (i = 0; i < pBuffer->numElements; i++)
+        {
+            pElement = &pBuffer->elements[i];
+            value = ((uint32_t)pRaw[pElement->channel] & pElement->mask) << pElement->shift;
+            pOut = &pDst[pElement->offset];
+            if (pElement->isBigEndian)
+            {
+                for (n = pElement->numBytes; n > 0; n--)
+                {
+                    pOut[n - 1] = (uint8_t)value;
+                    value >>= 8;
+                }
+            }
+            else
+            {
+                for (n = 0; n < pElement->numBytes; n++)
+                {
+                    pOut[n] = (uint8_t)value;
+                    value >>= 8;
+                }
+            }
+        }
+        pDst += pBuffer->sampleNumBytes;
+        index++;
+        if (index == pBuffer->ringNumSamples)
+        {
+            index = 0;
+        }
+        numSamples--;
+    }
+}
+
+/**
+ * @}
+ */
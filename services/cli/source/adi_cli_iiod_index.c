@@ -0,0 +1,495 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file adi_cli_iiod_index.c
+ * @brief Hash index of the attributes of an IIO context.
+ *
+ * The key of an attribute is the device index, the channel and the attribute name, hashed with
+ * FNV-1a. Slots keep the full hash so that most mismatches are rejected without comparing
+ * names.
+ * @{
+ */
+
+/*============= I N C L U D E S =============*/
+#include "adi_cli_iiod_index.h"
+#include "adi_cli.h"
+#include "adi_cli_iiod_xml.h"
+#include "adi_cli_status.h"
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*============= D E F I N E S =============*/
+
+/** FNV-1a offset basis */
+#define IIOD_INDEX_FNV_OFFSET 2166136261u
+/** FNV-1a prime */
+#define IIOD_INDEX_FNV_PRIME 16777619u
+/** Number of characters of the longest length line of a value, "-2147483648\n" */
+#define IIOD_READ_LENGTH_NUM_CHARS 12
+/** Maximum number of words of an item of the attribute list */
+#define IIOD_READ_MAX_ITEM_WORDS 3
+
+/*============= L O C A L  F U N C T I O N S =============*/
+
+/**
+ * @brief Hashes the key of an attribute.
+ * @param device - index of the device
+ * @param channel - channel of the attribute
+ * @param pName - attribute name
+ * @return hash of the key
+ */
+static uint32_t IiodIndexHash(uint32_t device, int32_t channel, const char *pName);
+
+/**
+ * @brief Gets the index of the device of a device id.
+ * @param pIioDesc - pointer to the IIO description
+ * @param pDeviceId - device id of the command
+ * @return index of the device, numDevices if there is no such device
+ */
+static uint32_t IiodIndexFindDevice(IioDesc *pIioDesc, const char *pDeviceId);
+
+/**
+ * @brief Finds an attribute of a device given by its index.
+ * @param pIndex - pointer to the index
+ * @param device - index of the device
+ * @param channel - channel of the attribute
+ * @param pName - attribute name
+ * @param[out] ppEntry - pointer to store the slot of the attribute
+ * @return 0 in case of success or -1 if there is no such attribute
+ */
+static int32_t IiodIndexFind(IioAttrIndex *pIndex, uint32_t device, int32_t channel,
+                             const char *pName, IioAttrEntry **ppEntry);
+
+/**
+ * @brief Adds the attributes of an array to the index, or only counts them.
+ * @param pIndex - pointer to the index
+ * @param device - index of the device
+ * @param channel - channel of the attributes
+ * @param pAttributes - NULL terminated attribute array, may be NULL
+ * @param isCounting - true to only count the attributes
+ * @return number of attributes of the array
+ */
+static uint32_t IiodIndexAddAttributes(IioAttrIndex *pIndex, uint16_t device, int32_t channel,
+                                       AttributeType *pAttributes, bool isCounting);
+
+/**
+ * @brief Adds all attributes of the context to the index, or only counts them.
+ * @param pIndex - pointer to the index
+ * @param isCounting - true to only count the attributes
+ * @return number of attributes of the context
+ */
+static uint32_t IiodIndexAddContext(IioAttrIndex *pIndex, bool isCounting);
+
+/**
+ * @brief Finds the attribute of an item of the attribute list of readmulti.
+ * @param pIndex - pointer to the index
+ * @param device - index of the device
+ * @param pItem - item, split into words in place
+ * @param[out] ppEntry - pointer to store the slot of the attribute
+ * @return 0 in case of success, -EINVAL if the item is malformed or -ENOENT if there is no
+ * such attribute
+ */
+static int32_t IiodReadFindItem(IioAttrIndex *pIndex, uint32_t device, char *pItem,
+                                IioAttrEntry **ppEntry);
+
+/**
+ * @brief Writes the answer of one attribute.
+ * @param pDst - start of the answer
+ * @param size - number of characters available
+ * @param pEntry - slot of the attribute, NULL if status is an error
+ * @param status - error code of the item
+ * @param pfShow - function reading the value
+ * @param hUser - user handle given to pfShow
+ * @return number of characters of the answer, 0 if not even the error code fits
+ */
+static uint32_t IiodReadWriteAnswer(char *pDst, uint32_t size, IioAttrEntry *pEntry,
+                                    int32_t status, IIOD_SHOW_FUNC pfShow, void *hUser);
+
+/*============= C O D E =============*/
+
+int32_t adi_cli_BuildIiodIndex(IioDesc *pIioDesc, IioAttrIndex *pIndex, IioAttrEntry *pEntries,
+                               uint32_t numEntries)
+{
+    int32_t status = 0;
+
+    if ((pIioDesc == NULL) || (pIndex == NULL) || (pEntries == NULL))
+    {
+        return -1;
+    }
+
+    // The commands address devices by id, so the ids must be set before the first command.
+    adi_cli_SetIiodDeviceIds(pIioDesc);
+    pIndex->pIioDesc = pIioDesc;
+    pIndex->pEntries = pEntries;
+    pIndex->numEntries = numEntries;
+    pIndex->numAttributes = IiodIndexAddContext(pIndex, true);
+    // One slot stays empty to end the probes of missing attributes.
+    if ((numEntries == 0) || ((numEntries & (numEntries - 1)) != 0) ||
+        (pIndex->numAttributes >= numEntries))
+    {
+        pIndex->numEntries = 0;
+        status = -1;
+    }
+    else
+    {
+        memset(pEntries, 0, numEntries * sizeof(IioAttrEntry));
+        IiodIndexAddContext(pIndex, false);
+    }
+    return status;
+}
+
+int32_t adi_cli_GetIiodChannel(DeviceAttributes *pDeviceAttribute, const char *pChannelId,
+                               bool isOutput, int32_t *pChannel)
+{
+    int32_t status = -1;
+    const char *pDigits;
+    const char *pEnd;
+    const char *pTypeName;
+    ChannelParams *pChannelParams;
+    uint32_t channel = 0;
+
+    if ((pDeviceAttribute == NULL) || (pChannelId == NULL) || (pChannel == NULL) ||
+        (pDeviceAttribute->channels == NULL))
+    {
+        return -1;
+    }
+
+    pEnd = pChannelId + strlen(pChannelId);
+    pDigits = pEnd;
+    while ((pDigits > pChannelId) && (pDigits[-1] >= '0') && (pDigits[-1] <= '9'))
+    {
+        pDigits--;
+    }
+    // The XML writes the index without leading zeros, and numChannel is 16 bits.
+    if ((pDigits == pEnd) || (pEnd - pDigits > 5) || ((pDigits[0] == '0') && (pEnd - pDigits > 1)))
+    {
+        return -1;
+    }
+    for (pEnd = pDigits; *pEnd != '\0'; pEnd++)
+    {
+        channel = (channel * 10) + (uint32_t)(*pEnd - '0');
+    }
+
+    if (channel < pDeviceAttribute->numChannel)
+    {
+        pChannelParams = &pDeviceAttribute->channels[channel];
+        pTypeName = ChannelTypeName[pChannelParams->channelType];
+        if ((pChannelParams->ch_out == isOutput) &&
+            (strlen(pTypeName) == (size_t)(pDigits - pChannelId)) &&
+            (strncmp(pChannelId, pTypeName, (size_t)(pDigits - pChannelId)) == 0))
+        {
+            *pChannel = (int32_t)channel;
+            status = 0;
+        }
+    }
+    return status;
+}
+
+int32_t adi_cli_FindIiodAttribute(IioAttrIndex *pIndex, const char *pDeviceId, int32_t channel,
+                                  const char *pName, IioAttrEntry **ppEntry)
+{
+    if ((pIndex == NULL) || (pDeviceId == NULL) || (pName == NULL) || (ppEntry == NULL) ||
+        (pIndex->numEntries == 0))
+    {
+        return -1;
+    }
+
+    return IiodIndexFind(pIndex, IiodIndexFindDevice(pIndex->pIioDesc, pDeviceId), channel,
+                         pName, ppEntry);
+}
+
+int32_t adi_cli_ReadIiodAttributes(IioAttrIndex *pIndex, ADI_CLI_HANDLE hCli,
+                                   const char *pDeviceId, char *pAttrList, IIOD_SHOW_FUNC pfShow,
+                                   void *hUser)
+{
+    int32_t status = 0;
+    IioDesc *pIioDesc;
+    IioAttrEntry *pEntry;
+    char *pItem;
+    char *pNext;
+    uint8_t *pData = NULL;
+    uint32_t numFreeBytes = 0;
+    uint32_t length = 0;
+    uint32_t device;
+    uint32_t answerLength;
+    int32_t itemStatus;
+
+    if ((pIndex == NULL) || (hCli == NULL) || (pDeviceId == NULL) || (pAttrList == NULL) ||
+        (pfShow == NULL) || (pIndex->pIioDesc == NULL))
+    {
+        return -1;
+    }
+
+    pIioDesc = pIndex->pIioDesc;
+    device = IiodIndexFindDevice(pIioDesc, pDeviceId);
+
+    // Start from an empty segment when the one being filled is too small for the answers.
+    if ((adi_cli_GetTxSpace(hCli, &pData, &numFreeBytes) == ADI_CLI_STATUS_SUCCESS) &&
+        (numFreeBytes < 2 * IIOD_READ_LENGTH_NUM_CHARS))
+    {
+        if (adi_cli_FlushMessages(hCli) == ADI_CLI_STATUS_COMM_ERROR)
+        {
+            status = -1;
+        }
+        adi_cli_GetTxSpace(hCli, &pData, &numFreeBytes);
+    }
+
+    for (pItem = pAttrList; (status == 0) && (pItem != NULL); pItem = pNext)
+    {
+        pNext = strpbrk(pItem, ",;");
+        if (pNext != NULL)
+        {
+            *pNext++ = '\0';
+        }
+        // Empty items, for example after a trailing separator, have no answer.
+        if (pItem[strspn(pItem, " ")] == '\0')
+        {
+            continue;
+        }
+        pEntry = NULL;
+        itemStatus = -ENOENT;
+        if (device < pIioDesc->numDevices)
+        {
+            itemStatus = IiodReadFindItem(pIndex, device, pItem, &pEntry);
+        }
+        answerLength = IiodReadWriteAnswer((char *)&pData[length], numFreeBytes - length, pEntry,
+                                           itemStatus, pfShow, hUser);
+        // A response with answers missing would be misread, so none is sent.
+        if (answerLength == 0)
+        {
+            status = -1;
+        }
+        length += answerLength;
+    }
+
+    if ((status == 0) && ((adi_cli_CommitTx(hCli, length) != ADI_CLI_STATUS_SUCCESS) ||
+                          (adi_cli_FlushMessages(hCli) == ADI_CLI_STATUS_COMM_ERROR)))
+    {
+        status = -1;
+    }
+    return status;
+}
+
+static uint32_t IiodIndexHash(uint32_t device, int32_t channel, const char *pName)
+{
+    uint32_t hash = IIOD_INDEX_FNV_OFFSET;
+
+    hash = (hash ^ (uint8_t)device) * IIOD_INDEX_FNV_PRIME;
+    hash = (hash ^ (uint8_t)(device >> 8)) * IIOD_INDEX_FNV_PRIME;
+    hash = (hash ^ (uint8_t)channel) * IIOD_INDEX_FNV_PRIME;
+    hash = (hash ^ (uint8_t)((uint32_t)channel >> 8)) * IIOD_INDEX_FNV_PRIME;
+    while (*pName != '\0')
+    {
+        hash = (hash ^ (uint8_t)*pName++) * IIOD_INDEX_FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint32_t IiodIndexFindDevice(IioDesc *pIioDesc, const char *pDeviceId)
+{
+    uint32_t device = 0;
+
+    // Contexts have few devices, the attributes are the ones worth hashing.
+    while ((pIioDesc->pDeviceParams != NULL) && (device < pIioDesc->numDevices) &&
+           (strcmp(pIioDesc->pDeviceParams[device].deviceId, pDeviceId) != 0))
+    {
+        device++;
+    }
+    return (pIioDesc->pDeviceParams != NULL) ? device : pIioDesc->numDevices;
+}
+
+static int32_t IiodIndexFind(IioAttrIndex *pIndex, uint32_t device, int32_t channel,
+                             const char *pName, IioAttrEntry **ppEntry)
+{
+    int32_t status = -1;
+    IioAttrEntry *pEntry;
+    uint32_t hash = IiodIndexHash(device, channel, pName);
+    uint32_t slot = hash & (pIndex->numEntries - 1);
+
+    pEntry = &pIndex->pEntries[slot];
+    while ((status != 0) && (pEntry->pAttribute != NULL))
+    {
+        if ((pEntry->hash == hash) && (pEntry->device == device) && (pEntry->channel == channel) &&
+            (strcmp(pEntry->pAttribute->pName, pName) == 0))
+        {
+            *ppEntry = pEntry;
+            status = 0;
+        }
+        else
+        {
+            slot = (slot + 1) & (pIndex->numEntries - 1);
+            pEntry = &pIndex->pEntries[slot];
+        }
+    }
+    return status;
+}
+
+static uint32_t IiodIndexAddAttributes(IioAttrIndex *pIndex, uint16_t device, int32_t channel,
+                                       AttributeType *pAttributes, bool isCounting)
+{
+    const char *pName;
+    IioAttrEntry *pEntry;
+    uint32_t numAttributes = 0;
+    uint32_t hash;
+    uint32_t slot;
+    bool isDuplicate;
+
+    for (; (pAttributes != NULL) && (pAttributes[numAttributes].pName != NULL); numAttributes++)
+    {
+        if (isCounting)
+        {
+            continue;
+        }
+        pName = pAttributes[numAttributes].pName;
+        hash = IiodIndexHash(device, channel, pName);
+        slot = hash & (pIndex->numEntries - 1);
+        pEntry = &pIndex->pEntries[slot];
+        isDuplicate = false;
+        while ((isDuplicate == false) && (pEntry->pAttribute != NULL))
+        {
+            isDuplicate = (pEntry->hash == hash) && (pEntry->device == device) &&
+                          (pEntry->channel == channel) &&
+                          (strcmp(pEntry->pAttribute->pName, pName) == 0);
+            slot = (slot + 1) & (pIndex->numEntries - 1);
+            pEntry = &pIndex->pEntries[slot];
+        }
+        if (isDuplicate == false)
+        {
+            pEntry->pAttribute = &pAttributes[numAttributes];
+            pEntry->hash = hash;
+            pEntry->channel = (int16_t)channel;
+            pEntry->device = device;
+        }
+    }
+    return numAttributes;
+}
+
+static uint32_t IiodIndexAddContext(IioAttrIndex *pIndex, bool isCounting)
+{
+    IioDesc *pIioDesc = pIndex->pIioDesc;
+    DeviceAttributes *pDeviceAttribute;
+    uint32_t numAttributes = 0;
+    uint16_t device;
+    uint16_t j;
+
+    for (device = 0; (pIioDesc->pDeviceParams != NULL) && (device < pIioDesc->numDevices);
+         device++)
+    {
+        pDeviceAttribute = pIioDesc->pDeviceParams[device].pDeviceAttribute;
+        if (pDeviceAttribute == NULL)
+        {
+            continue;
+        }
+        for (j = 0; (pDeviceAttribute->channels != NULL) && (j < pDeviceAttribute->numChannel);
+             j++)
+        {
+            numAttributes += IiodIndexAddAttributes(pIndex, device, j,
+                                                    pDeviceAttribute->channels[j].pAttributes,
+                                                    isCounting);
+        }
+        numAttributes += IiodIndexAddAttributes(pIndex, device, IIOD_CHANNEL_DEVICE,
+                                                pDeviceAttribute->pAttributes, isCounting);
+        numAttributes += IiodIndexAddAttributes(pIndex, device, IIOD_CHANNEL_DEBUG,
+                                                pDeviceAttribute->pDebugAttributes, isCounting);
+        numAttributes += IiodIndexAddAttributes(pIndex, device, IIOD_CHANNEL_BUFFER,
+                                                pDeviceAttribute->pBufferAttributes, isCounting);
+    }
+    return numAttributes;
+}
+
+static int32_t IiodReadFindItem(IioAttrIndex *pIndex, uint32_t device, char *pItem,
+                                IioAttrEntry **ppEntry)
+{
+    int32_t status = 0;
+    DeviceAttributes *pDeviceAttribute;
+    char *pWords[IIOD_READ_MAX_ITEM_WORDS + 1];
+    uint32_t numWords = 0;
+    int32_t channel = IIOD_CHANNEL_DEVICE;
+
+    while ((*pItem != '\0') && (numWords <= IIOD_READ_MAX_ITEM_WORDS))
+    {
+        while (*pItem == ' ')
+        {
+            *pItem++ = '\0';
+        }
+        if (*pItem != '\0')
+        {
+            pWords[numWords++] = pItem;
+        }
+        while ((*pItem != ' ') && (*pItem != '\0'))
+        {
+            pItem++;
+        }
+    }
+
+    if ((numWords == 2) && (strcmp(pWords[0], "DEBUG") == 0))
+    {
+        channel = IIOD_CHANNEL_DEBUG;
+    }
+    else if ((numWords == 2) && (strcmp(pWords[0], "BUFFER") == 0))
+    {
+        channel = IIOD_CHANNEL_BUFFER;
+    }
+    else if ((numWords == 3) &&
+             ((strcmp(pWords[0], "INPUT") == 0) || (strcmp(pWords[0], "OUTPUT") == 0)))
+    {
+        pDeviceAttribute = pIndex->pIioDesc->pDeviceParams[device].pDeviceAttribute;
+        if (adi_cli_GetIiodChannel(pDeviceAttribute, pWords[1], pWords[0][0] == 'O', &channel) !=
+            0)
+        {
+            status = -ENOENT;
+        }
+    }
+    else if (numWords != 1)
+    {
+        status = -EINVAL;
+    }
+
+    if ((status == 0) &&
+        (IiodIndexFind(pIndex, device, channel, pWords[numWords - 1], ppEntry) != 0))
+    {
+        status = -ENOENT;
+    }
+    return status;
+}
+
+static uint32_t IiodReadWriteAnswer(char *pDst, uint32_t size, IioAttrEntry *pEntry,
+                                    int32_t status, IIOD_SHOW_FUNC pfShow, void *hUser)
+{
+    uint32_t length = 0;
+    int32_t numChars;
+
+    if (size <= IIOD_READ_LENGTH_NUM_CHARS)
+    {
+        return 0;
+    }
+    // The value is read behind room for its length line and moved next to it afterwards.
+    if (status == 0)
+    {
+        status = pfShow(hUser, pEntry, &pDst[IIOD_READ_LENGTH_NUM_CHARS],
+                        size - IIOD_READ_LENGTH_NUM_CHARS - 1);
+        if (status >= (int32_t)(size - IIOD_READ_LENGTH_NUM_CHARS - 1))
+        {
+            status = -ENOBUFS;
+        }
+    }
+    numChars = snprintf(pDst, IIOD_READ_LENGTH_NUM_CHARS, "%ld\n", (long)status);
+    length = (uint32_t)numChars;
+    if (status > 0)
+    {
+        memmove(&pDst[length], &pDst[IIOD_READ_LENGTH_NUM_CHARS], (size_t)status);
+        length += (uint32_t)status;
+        pDst[length++] = '\n';
+    }
+    return length;
+}
+
+/**
+ * @}
+ */
@@ -27,15 +27,11 @@
 #include <string.h>
 /*============= D E F I N E S =============*/
 
-/** Macro to get the maximum value between two numbers */
-#define MAX_VALUE(x, y) (((x) > (y)) ? (x) : (y))
-/** Macro for the xml buffer size */
-#define XML_DESC_BUFFER_SIZE 8000
+/** Number of characters of the longest decimal int32_t, with sign */
+#define XML_INT_NUM_CHARS 11
 
 /*============= D A T A =============*/
 
-static char dummybuffer[XML_DESC_BUFFER_SIZE];
-
 /** Macro to convert a number to a string */
 #define NO_OS_TOSTRING(x) #x
 
@@ -68,166 +64,282 @@ static char headerEnd[] = "</context>";
 
 /*============= L O C A L  F U N C T I O N S =============*/
 
-/*
- * Initialize the xml file for the IIO device.
- * @param desc - pointer to the IIO descriptor
- * @param pOutput - pointer to the output buffer
- * @return 0 in case of success or negative value otherwise.
+/**
+ * @brief Bounded writer of the xml. Characters beyond size are counted but not written, so
+ * the required size is known after a single pass.
  */
-static int32_t InitXml(IioDesc *pDesc, char *pOutput);
+typedef struct
+{
+    /** Output buffer */
+    char *pDst;
+    /** Size of the output buffer */
+    uint32_t size;
+    /** Number of characters of the xml so far */
+    uint32_t length;
+} XmlWriter;
 
-/*
- * Add device attributes into pDst. If size is 0, no data will be written to pDst but size will be
- * returned.
- * @param pDeviceAttribute - pointer to the device attributes
- * @param pName - name of the device
- * @param pDeviceId - id of the device
- * @param pDst - pointer to the buffer where the xml will be written
- * @param size - size of the buffer
- * @return size of the xml
+/**
+ * @brief Appends a string to the xml.
+ * @param pWriter - pointer to the writer
+ * @param pStr - string to append
+ */
+static void XmlAppend(XmlWriter *pWriter, const char *pStr);
+
+/**
+ * @brief Appends a signed decimal number to the xml.
+ * @param pWriter - pointer to the writer
+ * @param value - number to append
+ */
+static void XmlAppendInt(XmlWriter *pWriter, int32_t value);
+
+/**
+ * @brief Appends a single character to the xml.
+ * @param pWriter - pointer to the writer
+ * @param c - character to append
+ */
+static void XmlAppendChar(XmlWriter *pWriter, char c);
+
+/**
+ * @brief Appends an element that has only a name attribute, for example
+ * <attribute name="x" />.
+ * @param pWriter - pointer to the writer
+ * @param pElement - element with the opening bracket and the name attribute up to its value,
+ * for example "<attribute name=\""
+ * @param pName - value of the name attribute
+ */
+static void XmlAppendNamed(XmlWriter *pWriter, const char *pElement, const char *pName);
+
+/**
+ * @brief Appends the names of a NULL terminated attribute array as elements.
+ * @param pWriter - pointer to the writer
+ * @param pElement - element up to the value of the name attribute
+ * @param pAttributes - attribute array, may be NULL
+ */
+static void XmlAppendAttributes(XmlWriter *pWriter, const char *pElement,
+                                AttributeType *pAttributes);
+
+/**
+ * @brief Add a device and its channels and attributes to the xml.
+ * @param pWriter - pointer to the writer
+ * @param pDeviceParams - pointer to the device parameters
  */
-static uint32_t AddDeviceXml(DeviceAttributes *pDeviceAttribute, char *pName, char *pDeviceId,
-                             uint32_t size, char *pDst);
+static void AddDeviceXml(XmlWriter *pWriter, DeviceParams *pDeviceParams);
 
-/*
- * Add channel attributes into pDst. If size is 0, no data will be written to pDst but size will be
- * returned.
+/**
+ * @brief Add the channels of a device to the xml.
+ * @param pWriter - pointer to the writer
  * @param pDeviceAttribute - pointer to the device attributes
- * @param size - size of the buffer
- * @param pDst - pointer to the buffer where the xml will be written
- * @return size of the xml
  */
-static uint32_t AddChannelXml(DeviceAttributes *pDeviceAttribute, uint32_t size, int32_t *pIndex,
-                              char *pDst);
+static void AddChannelXml(XmlWriter *pWriter, DeviceAttributes *pDeviceAttribute);
 
 /**
- * @brief Add context attributes into xml string buffer.
- * @param desc - IIo descriptor.
- * @param buff - xml buffer.
- * @param size - size of buffer
- * @return 0 in case of success or negative value otherwise.
+ * @brief Add context attributes to the xml.
+ * @param pWriter - pointer to the writer
+ * @param pDesc - IIO descriptor.
  */
-static uint32_t AddCtxAttributeXml(IioDesc *pDesc, char *pBuff, uint32_t size);
+static void AddCtxAttributeXml(XmlWriter *pWriter, IioDesc *pDesc);
 
 /*============= C O D E =============*/
 
-int32_t adi_cli_GenerateIiodXml(IioDesc *pIioDesc, char *pOutput)
+int32_t adi_cli_GenerateIiodXml(IioDesc *pIioDesc, char *pOutput, uint32_t outputSize)
 {
-    int32_t status;
+    int32_t status = 0;
     uint32_t i;
+    XmlWriter writer;
+
+    if ((pIioDesc == NULL) || (pOutput == NULL))
+    {
+        return -1;
+    }
+    // The context has not changed since the xml was generated into this buffer.
+    if ((pIioDesc->isXmlValid == true) && (pIioDesc->pXmlDesc == pOutput))
+    {
+        return 0;
+    }
+
+    adi_cli_SetIiodDeviceIds(pIioDesc);
+
+    writer.pDst = pOutput;
+    writer.size = outputSize;
+    writer.length = 0;
+    XmlAppend(&writer, header);
+    AddCtxAttributeXml(&writer, pIioDesc);
     for (i = 0; i < pIioDesc->numDevices; i++)
     {
-        snprintf(pIioDesc->pDeviceParams->deviceId, sizeof(pIioDesc->pDeviceParams->deviceId),
-                 "iio:device%" PRIu32 "", i);
+        AddDeviceXml(&writer, &pIioDesc->pDeviceParams[i]);
     }
-    status = InitXml(pIioDesc, pOutput);
+    XmlAppend(&writer, headerEnd);
 
+    pIioDesc->pXmlDesc = pOutput;
+    pIioDesc->xmlSize = writer.length;
+    if (writer.length < outputSize)
+    {
+        pOutput[writer.length] = '\0';
+        pIioDesc->isXmlValid = true;
+    }
+    else
+    {
+        // xmlSize tells the caller the size of the buffer required.
+        if (outputSize > 0)
+        {
+            pOutput[outputSize - 1] = '\0';
+        }
+        pIioDesc->isXmlValid = false;
+        status = -1;
+    }
     return status;
 }
 
-uint32_t AddDeviceXml(DeviceAttributes *pDeviceAttribute, char *pName, char *pDeviceId,
-                      uint32_t size, char *pDst)
+void adi_cli_SetIiodDeviceIds(IioDesc *pIioDesc)
 {
-    int32_t i, j, n;
-    if ((int32_t)size == -1)
+    uint32_t i;
+
+    for (i = 0; (pIioDesc != NULL) && (pIioDesc->pDeviceParams != NULL) &&
+                (i < pIioDesc->numDevices);
+         i++)
     {
-        n = 0;
+        snprintf(pIioDesc->pDeviceParams[i].deviceId, sizeof(pIioDesc->pDeviceParams[i].deviceId),
+                 "iio:device%" PRIu32 "", i);
     }
-    else
+}
+
+void adi_cli_InvalidateIiodXml(IioDesc *pIioDesc)
+{
+    if (pIioDesc != NULL)
     {
-        n = size;
+        pIioDesc->isXmlValid = false;
     }
+}
 
-    if (pDst == NULL)
+void XmlAppend(XmlWriter *pWriter, const char *pStr)
+{
+    uint32_t length = (uint32_t)strlen(pStr);
+    uint32_t numCopy = 0;
+    if (pWriter->length < pWriter->size)
     {
-        /* Set dummy value for buff. It is used only for counting */
-        pDst = dummybuffer;
+        numCopy = pWriter->size - pWriter->length;
+        if (numCopy > length)
+        {
+            numCopy = length;
+        }
+        memcpy(&pWriter->pDst[pWriter->length], pStr, numCopy);
     }
+    pWriter->length += length;
+}
 
-    i = 0;
+void XmlAppendChar(XmlWriter *pWriter, char c)
+{
+    if (pWriter->length < pWriter->size)
+    {
+        pWriter->pDst[pWriter->length] = c;
+    }
+    pWriter->length++;
+}
 
-    i +=
-        snprintf(pDst + i, MAX_VALUE(n - i, 0), "<device id=\"%s\" name=\"%s\">", pDeviceId, pName);
+void XmlAppendInt(XmlWriter *pWriter, int32_t value)
+{
+    char digits[XML_INT_NUM_CHARS + 1];
+    uint32_t magnitude = (value < 0) ? (0u - (uint32_t)value) : (uint32_t)value;
+    int32_t i = XML_INT_NUM_CHARS;
 
-    /** Write channels */
-    if (pDeviceAttribute->channels)
+    digits[i] = '\0';
+    do
     {
-        AddChannelXml(pDeviceAttribute, size, &i, pDst);
-        /** Write device attributes */
-        if (pDeviceAttribute->pAttributes)
-        {
-            for (j = 0; pDeviceAttribute->pAttributes[j].pName; j++)
-            {
-                i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "<attribute name=\"%s\" />",
-                              pDeviceAttribute->pAttributes[j].pName);
-            }
-        }
+        digits[--i] = (char)('0' + (magnitude % 10u));
+        magnitude /= 10u;
+    } while (magnitude > 0);
+    if (value < 0)
+    {
+        digits[--i] = '-';
+    }
+    XmlAppend(pWriter, &digits[i]);
+}
 
-        /** Write debug attributes */
-        if (pDeviceAttribute->pDebugAttributes)
+void XmlAppendNamed(XmlWriter *pWriter, const char *pElement, const char *pName)
+{
+    XmlAppend(pWriter, pElement);
+    XmlAppend(pWriter, pName);
+    XmlAppend(pWriter, "\" />");
+}
+
+void XmlAppendAttributes(XmlWriter *pWriter, const char *pElement, AttributeType *pAttributes)
+{
+    int32_t j;
+    if (pAttributes)
+    {
+        for (j = 0; pAttributes[j].pName; j++)
         {
-            for (j = 0; pDeviceAttribute->pDebugAttributes[j].pName; j++)
-            {
-                i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "<debug-attribute name=\"%s\" />",
-                              pDeviceAttribute->pDebugAttributes[j].pName);
-            }
+            XmlAppendNamed(pWriter, pElement, pAttributes[j].pName);
         }
+    }
+}
 
+void AddDeviceXml(XmlWriter *pWriter, DeviceParams *pDeviceParams)
+{
+    DeviceAttributes *pDeviceAttribute = pDeviceParams->pDeviceAttribute;
+
+    XmlAppend(pWriter, "<device id=\"");
+    XmlAppend(pWriter, pDeviceParams->deviceId);
+    XmlAppend(pWriter, "\" name=\"");
+    XmlAppend(pWriter, pDeviceParams->pName);
+    XmlAppend(pWriter, "\">");
+
+    /** Write channels */
+    if (pDeviceAttribute->channels)
+    {
+        AddChannelXml(pWriter, pDeviceAttribute);
+        /** Write device attributes */
+        XmlAppendAttributes(pWriter, "<attribute name=\"", pDeviceAttribute->pAttributes);
+        /** Write debug attributes */
+        XmlAppendAttributes(pWriter, "<debug-attribute name=\"",
+                            pDeviceAttribute->pDebugAttributes);
         if (pDeviceAttribute->debugRegRWEnable)
         {
-            i += snprintf(pDst + i, MAX_VALUE(n - i, 0),
-                          "<debug-attribute name=\"" REG_ACCESS_ATTRIBUTE "\" />");
+            XmlAppend(pWriter, "<debug-attribute name=\"" REG_ACCESS_ATTRIBUTE "\" />");
         }
-
         /** Write buffer attributes */
-        if (pDeviceAttribute->pBufferAttributes)
-        {
-            for (j = 0; pDeviceAttribute->pBufferAttributes[j].pName; j++)
-            {
-                i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "<buffer-attribute name=\"%s\" />",
-                              pDeviceAttribute->pBufferAttributes[j].pName);
-            }
-        }
-
-        i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "</device>");
+        XmlAppendAttributes(pWriter, "<buffer-attribute name=\"",
+                            pDeviceAttribute->pBufferAttributes);
+        XmlAppend(pWriter, "</device>");
     }
-
-    return i;
 }
 
-uint32_t AddChannelXml(DeviceAttributes *pDeviceAttribute, uint32_t size, int32_t *pIndex,
-                       char *pDst)
+void AddChannelXml(XmlWriter *pWriter, DeviceAttributes *pDeviceAttribute)
 {
-    int32_t i, j, k, n;
+    int32_t j, k;
     AttributeType *pAttribute;
     ChannelParams *pChannel;
-    if ((int32_t)size == -1)
-    {
-        n = 0;
-    }
-    else
-    {
-        n = size;
-    }
-    i = *pIndex;
+    scanType *pScanType;
+
     for (j = 0; j < pDeviceAttribute->numChannel; j++)
     {
         pChannel = &pDeviceAttribute->channels[j];
-        i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "<channel id=\"%s%ld\"",
-                      ChannelTypeName[pChannel->channelType], j);
+        XmlAppend(pWriter, "<channel id=\"");
+        XmlAppend(pWriter, ChannelTypeName[pChannel->channelType]);
+        XmlAppendInt(pWriter, j);
+        XmlAppendChar(pWriter, '"');
         if (pChannel->pName)
-            i += snprintf(pDst + i, MAX_VALUE(n - i, 0), " name=\"%s\"", pChannel->pName);
-        i += snprintf(pDst + i, MAX_VALUE(n - i, 0), " type=\"%s\" >",
-                      pChannel->ch_out ? "output" : "input");
+        {
+            XmlAppend(pWriter, " name=\"");
+            XmlAppend(pWriter, pChannel->pName);
+            XmlAppendChar(pWriter, '"');
+        }
+        XmlAppend(pWriter, pChannel->ch_out ? " type=\"output\" >" : " type=\"input\" >");
 
-        if (pChannel->pScanType)
+        pScanType = pChannel->pScanType;
+        if (pScanType)
         {
-            i += snprintf(pDst + i, MAX_VALUE(n - i, 0),
-                          "<scan-element index=\"%d\""
-                          " format=\"%s:%c%d/%d>>%d\" />",
-                          pChannel->scan_index, pChannel->pScanType->isBigEndian ? "be" : "le",
-                          pChannel->pScanType->sign, pChannel->pScanType->realbits,
-                          pChannel->pScanType->storagebits, pChannel->pScanType->shift);
+            // <scan-element index="%d" format="%s:%c%d/%d>>%d" />
+            XmlAppend(pWriter, "<scan-element index=\"");
+            XmlAppendInt(pWriter, pChannel->scan_index);
+            XmlAppend(pWriter, pScanType->isBigEndian ? "\" format=\"be:" : "\" format=\"le:");
+            XmlAppendChar(pWriter, pScanType->sign);
+            XmlAppendInt(pWriter, pScanType->realbits);
+            XmlAppendChar(pWriter, '/');
+            XmlAppendInt(pWriter, pScanType->storagebits);
+            XmlAppend(pWriter, ">>");
+            XmlAppendInt(pWriter, pScanType->shift);
+            XmlAppend(pWriter, "\" />");
         }
 
         /* Write channel attributes */
@@ -236,101 +348,42 @@ uint32_t AddChannelXml(DeviceAttributes *pDeviceAttribute, uint32_t size, int32_
             for (k = 0; pChannel->pAttributes[k].pName; k++)
             {
                 pAttribute = &pChannel->pAttributes[k];
-                i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "<attribute name=\"%s\" ",
-                              pAttribute->pName);
-                switch (pAttribute->shared)
+                XmlAppend(pWriter, "<attribute name=\"");
+                XmlAppend(pWriter, pAttribute->pName);
+                XmlAppend(pWriter, "\" ");
+                if (pAttribute->shared == IIO_SHARED_BY_TYPE)
                 {
-                case IIO_SHARED_BY_TYPE:
-                    i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "filename=\"%s_%s%ld_%s\"",
-                                  pChannel->ch_out ? "out" : "in",
-                                  ChannelTypeName[pChannel->channelType], j, pAttribute->pName);
-                    break;
-                case IIO_SHARED_BY_ALL:
-                case IIO_SEPARATE:
-                case IIO_SHARED_BY_DIR:
-                    break;
+                    // filename="%s_%s%ld_%s"
+                    XmlAppend(pWriter, pChannel->ch_out ? "filename=\"out_" : "filename=\"in_");
+                    XmlAppend(pWriter, ChannelTypeName[pChannel->channelType]);
+                    XmlAppendInt(pWriter, j);
+                    XmlAppendChar(pWriter, '_');
+                    XmlAppend(pWriter, pAttribute->pName);
+                    XmlAppendChar(pWriter, '"');
                 }
-                i += snprintf(pDst + i, MAX_VALUE(n - i, 0), " />");
+                XmlAppend(pWriter, " />");
             }
         }
-        i += snprintf(pDst + i, MAX_VALUE(n - i, 0), "</channel>");
+        XmlAppend(pWriter, "</channel>");
     }
-    *pIndex = i;
-    return 0;
 }
-uint32_t AddCtxAttributeXml(IioDesc *pDesc, char *pBuff, uint32_t size)
-{
-    CtxAttrType *pAttr;
-    int32_t i;
-    int32_t j;
-    int32_t n;
 
-    if ((int32_t)size == -1)
-    {
-        n = 0;
-    }
-    else
-    {
-        n = size;
-    }
-    if (pBuff == NULL)
-    {
-        /* Set dummy value for buff. It is used only for counting */
-        pBuff = dummybuffer;
-    }
-    i = 0;
+void AddCtxAttributeXml(XmlWriter *pWriter, IioDesc *pDesc)
+{
+    CtxAttrType *pAttr = pDesc->pCtxAttribute;
+    uint32_t j;
 
-    pAttr = pDesc->pCtxAttribute;
     if (pAttr)
     {
-        for (j = 0; j < (int32_t)pDesc->numCtxAttribute; j++)
+        for (j = 0; j < pDesc->numCtxAttribute; j++)
         {
-            i += snprintf(pBuff + i, MAX_VALUE(n - i, 0), "<context-attribute name=\"%s\" ",
-                          pAttr[j].name);
-
-            i += snprintf(pBuff + i, MAX_VALUE(n - i, 0), "value=\"%s\" />", pAttr[j].value);
+            XmlAppend(pWriter, "<context-attribute name=\"");
+            XmlAppend(pWriter, pAttr[j].name);
+            XmlAppend(pWriter, "\" value=\"");
+            XmlAppend(pWriter, pAttr[j].value);
+            XmlAppend(pWriter, "\" />");
         }
     }
-
-    return i;
-}
-
-int32_t InitXml(IioDesc *pDesc, char *pOutput)
-{
-    uint32_t i, size, of;
-
-    /* -2 because of the 0 character */
-    size = sizeof(header) + sizeof(headerEnd) - 2;
-
-    // Counts the number of characters to be written in the xml buffer
-    size += AddCtxAttributeXml(pDesc, NULL, -1);
-    for (i = 0; i < pDesc->numDevices; i++)
-    {
-        size += AddDeviceXml(pDesc->pDeviceParams->pDeviceAttribute,
-                             (char *)pDesc->pDeviceParams->pName, pDesc->pDeviceParams->deviceId,
-                             -1, NULL);
-    }
-
-    pDesc->pXmlDesc = pOutput;
-    if (!pDesc->pXmlDesc)
-    {
-        return -1;
-    }
-
-    pDesc->xmlSize = size;
-
-    strcpy(pDesc->pXmlDesc, header);
-    of = sizeof(header) - 1;
-    of += AddCtxAttributeXml(pDesc, pDesc->pXmlDesc + of, size - of);
-    for (i = 0; i < pDesc->numDevices; i++)
-    {
-        of += AddDeviceXml(pDesc->pDeviceParams->pDeviceAttribute,
-                           (char *)pDesc->pDeviceParams->pName, pDesc->pDeviceParams->deviceId,
-                           size - of, pDesc->pXmlDesc + of);
-    }
-    strcpy(pDesc->pXmlDesc + of, headerEnd);
-
-    return 0;
 }
 
 /**
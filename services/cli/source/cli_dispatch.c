@@ -12,6 +12,7 @@
 #include "cli_dispatch.h"
 #include "adi_cli_utility.h"
 #include "app_cfg.h"
+#include <ctype.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -19,10 +20,187 @@
 
 /*========================== D A T A T Y P E S ==========================*/
 
+/**
+ * @brief Compares at most maxLen characters of two strings ignoring case.
+ * @param [in] pA     - first string
+ * @param [in] pB     - second string
+ * @param [in] maxLen - maximum number of characters compared
+ * @return negative, zero or positive if pA is less than, equal to or greater than pB.
+ */
+static int32_t DispatchCompareNoCase(const char *pA, const char *pB, uint32_t maxLen);
+
+/**
+ * @brief Searches the sorted index for the first record whose name, truncated to maxLen
+ * characters, is not less than (or, if isUpper, greater than) the token.
+ * @param [in] pInfo		    - pointer to dispatch data
+ * @param [in] pToken	        - token, needs no terminating null within maxLen characters
+ * @param [in] maxLen	        - number of characters compared
+ * @param [in] isUpper	        - search the upper instead of the lower bound
+ * @return position in the sorted index, numDispatchRecords if there is none.
+ */
+static int32_t DispatchSearchBound(CLI_DISPATCH_DATA *pInfo, const char *pToken, uint32_t maxLen,
+                                   bool isUpper);
+
+/**
+ * @brief Builds the sorted index of a dispatch table.
+ * @param [in] pInfo		    - pointer to dispatch data
+ * @param [in] pDispatchTable	- pointer to dispatch table
+ * @param [in] numRecords	    - number of records in dispatch table
+ */
+static void DispatchBuildIndex(CLI_DISPATCH_DATA *pInfo, const Command *pDispatchTable,
+                               int32_t numRecords);
+
+/**
+ * @brief Searches the dispatch table linearly.
+ * @param [in] pInfo		    - pointer to dispatch data
+ * @param [in] pCommandToken	- parsed user command.
+ * @param [in] pDispatchTable	- pointer to dispatch table
+ * @param [in] numRecords	    - number of records in dispatch table
+ * @return const Command*       - pointer to dispatch table record.
+ */
+static const Command *DispatchSearchLinear(CLI_DISPATCH_DATA *pInfo, char *pCommandToken,
+                                           const Command *pDispatchTable, int32_t numRecords);
+
 /*========================== C O D E ==========================*/
 
+int32_t DispatchRegisterTable(CLI_DISPATCH_DATA *pInfo, const Command *pDispatchTable,
+                              int32_t numRecords)
+{
+    int32_t status = 1;
+
+    if ((numRecords >= 0) && (numRecords <= CLI_DISPATCH_MAX_RECORDS))
+    {
+        DispatchBuildIndex(pInfo, pDispatchTable, numRecords);
+        status = 0;
+    }
+
+    return status;
+}
+
 const Command *DispatchGetCommandDetails(CLI_DISPATCH_DATA *pInfo, char *pCommandToken,
                                          const Command *pDispatchTable, int32_t numRecords)
+{
+    int32_t position;
+    const Command *pDispatchRecord = NULL;
+
+    if (numRecords > CLI_DISPATCH_MAX_RECORDS)
+    {
+        return DispatchSearchLinear(pInfo, pCommandToken, pDispatchTable, numRecords);
+    }
+
+    if ((pInfo->pDispatchTable != pDispatchTable) || (pInfo->numDispatchRecords != numRecords))
+    {
+        DispatchBuildIndex(pInfo, pDispatchTable, numRecords);
+    }
+
+    position = DispatchSearchBound(pInfo, pCommandToken, UINT32_MAX, false);
+    if ((position < numRecords) &&
+        (DispatchCompareNoCase(pDispatchTable[pInfo->sortedIndex[position]].pName, pCommandToken,
+                               UINT32_MAX) == 0))
+    {
+        pDispatchRecord = &pDispatchTable[pInfo->sortedIndex[position]];
+    }
+
+    return pDispatchRecord;
+}
+
+int32_t DispatchFindPrefix(CLI_DISPATCH_DATA *pInfo, const char *pPrefix, uint32_t prefixLen,
+                           const Command *pDispatchTable, int32_t numRecords, int32_t *pFirst)
+{
+    int32_t numMatches = 0;
+
+    *pFirst = 0;
+    if ((pDispatchTable != NULL) && (numRecords <= CLI_DISPATCH_MAX_RECORDS))
+    {
+        if ((pInfo->pDispatchTable != pDispatchTable) || (pInfo->numDispatchRecords != numRecords))
+        {
+            DispatchBuildIndex(pInfo, pDispatchTable, numRecords);
+        }
+        /* Names starting with the prefix are adjacent in the sorted index */
+        *pFirst = DispatchSearchBound(pInfo, pPrefix, prefixLen, false);
+        numMatches = DispatchSearchBound(pInfo, pPrefix, prefixLen, true) - *pFirst;
+    }
+
+    return numMatches;
+}
+
+const Command *DispatchGetSortedRecord(CLI_DISPATCH_DATA *pInfo, int32_t position)
+{
+    return &pInfo->pDispatchTable[pInfo->sortedIndex[position]];
+}
+
+static int32_t DispatchCompareNoCase(const char *pA, const char *pB, uint32_t maxLen)
+{
+    int32_t a = 0;
+    int32_t b = 0;
+
+    while (maxLen > 0)
+    {
+        a = tolower((unsigned char)*pA++);
+        b = tolower((unsigned char)*pB++);
+        if ((a != b) || (a == '\0'))
+        {
+            break;
+        }
+        maxLen--;
+    }
+
+    return a - b;
+}
+
+static int32_t DispatchSearchBound(CLI_DISPATCH_DATA *pInfo, const char *pToken, uint32_t maxLen,
+                                   bool isUpper)
+{
+    int32_t low = 0;
+    int32_t high = pInfo->numDispatchRecords;
+    int32_t mid;
+    int32_t compare;
+
+    while (low < high)
+    {
+        mid = low + ((high - low) / 2);
+        compare = DispatchCompareNoCase(pInfo->pDispatchTable[pInfo->sortedIndex[mid]].pName,
+                                        pToken, maxLen);
+        if ((compare < 0) || (isUpper && (compare == 0)))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+static void DispatchBuildIndex(CLI_DISPATCH_DATA *pInfo, const Command *pDispatchTable,
+                               int32_t numRecords)
+{
+    int32_t i;
+    int32_t j;
+    uint8_t index;
+
+    /* Stable insertion sort, so that the first of duplicate names is found as in a linear
+     * search. Runs once per table. */
+    for (i = 0; i < numRecords; i++)
+    {
+        index = (uint8_t)i;
+        j = i;
+        while ((j > 0) && (DispatchCompareNoCase(pDispatchTable[pInfo->sortedIndex[j - 1]].pName,
+                                                 pDispatchTable[index].pName, UINT32_MAX) > 0))
+        {
+            pInfo->sortedIndex[j] = pInfo->sortedIndex[j - 1];
+            j--;
+        }
+        pInfo->sortedIndex[j] = index;
+    }
+    pInfo->pDispatchTable = pDispatchTable;
+    pInfo->numDispatchRecords = numRecords;
+}
+
+static const Command *DispatchSearchLinear(CLI_DISPATCH_DATA *pInfo, char *pCommandToken,
+                                           const Command *pDispatchTable, int32_t numRecords)
 {
     int32_t i;
     const Command *pDispatchRecord = NULL;
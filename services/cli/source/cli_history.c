@@ -19,100 +19,178 @@
 
 /*========================== P R O T O T Y P E S ==========================*/
 
+/**
+ * @brief Copies characters out of the history ring.
+ * @param[in] pHistory	- pointer to the history
+ * @param[in] offset	- offset of the first character
+ * @param[in] length	- number of characters
+ * @param[out] pDst	    - destination
+ */
+static void HistoryRingRead(CLI_HISTORY *pHistory, uint32_t offset, uint32_t length, char *pDst);
+
+/**
+ * @brief Copies characters into the history ring.
+ * @param[in] pHistory	- pointer to the history
+ * @param[in] offset	- offset of the first character
+ * @param[in] length	- number of characters
+ * @param[in] pSrc	    - source
+ */
+static void HistoryRingWrite(CLI_HISTORY *pHistory, uint32_t offset, uint32_t length,
+                             const char *pSrc);
+
 /**
  * @brief Check for duplicate command at head of history file.
+ * @param[in] pHistory	- pointer to the history
  * @param[in] pCommand	- pointer to command
+ * @param[in] length	- length of the command
  * @return status - true or false
  */
-static bool HistoryCheckForDuplicate(CLI_HISTORY_DATA *pHistory, const char *pCommand);
+static bool HistoryCheckForDuplicate(CLI_HISTORY *pHistory, const char *pCommand,
+                                     uint32_t length);
+
+/**
+ * @brief Copies the command at an offset to the scroll buffer.
+ * @param[in] pInfo	    - pointer to the history data
+ * @param[in] offset	- offset of the command
+ * @return pointer to the command
+ */
+static char *HistoryGetCommand(CLI_HISTORY_DATA *pInfo, uint32_t offset);
 
 /*==========================  D E F I N I T I O N S ==========================*/
 
-static bool HistoryCheckForDuplicate(CLI_HISTORY_DATA *pInfo, const char *pCommand)
+static void HistoryRingRead(CLI_HISTORY *pHistory, uint32_t offset, uint32_t length, char *pDst)
 {
-    uint32_t recentIndex;
-    bool status = false;
-    CLI_HISTORY *pHistory = &pInfo->history;
+    uint32_t index = offset % APP_CFG_CLI_HISTORY_NUM_BYTES;
+    uint32_t numToEnd = APP_CFG_CLI_HISTORY_NUM_BYTES - index;
+
+    if (length <= numToEnd)
+    {
+        memcpy(pDst, &pHistory->ring[index], length);
+    }
+    else
+    {
+        memcpy(pDst, &pHistory->ring[index], numToEnd);
+        memcpy(&pDst[numToEnd], &pHistory->ring[0], length - numToEnd);
+    }
+}
 
-    /* If history file is empty then not a duplicate */
-    if (pHistory->headIndex != pHistory->tailIndex)
+static void HistoryRingWrite(CLI_HISTORY *pHistory, uint32_t offset, uint32_t length,
+                             const char *pSrc)
+{
+    uint32_t index = offset % APP_CFG_CLI_HISTORY_NUM_BYTES;
+    uint32_t numToEnd = APP_CFG_CLI_HISTORY_NUM_BYTES - index;
+
+    if (length <= numToEnd)
+    {
+        memcpy(&pHistory->ring[index], pSrc, length);
+    }
+    else
     {
-        /* Get index of most recent command line history */
-        recentIndex = pHistory->headIndex - 1;
-        recentIndex = (recentIndex < HISTORY_DEPTH ? recentIndex : HISTORY_DEPTH - 1);
+        memcpy(&pHistory->ring[index], pSrc, numToEnd);
+        memcpy(&pHistory->ring[0], &pSrc[numToEnd], length - numToEnd);
+    }
+}
 
-        /* Compare the pCommand with history command and return true if match */
-        if (strncmp(pCommand, pHistory->list[recentIndex], APP_CFG_CLI_MAX_CMD_LENGTH) == 0)
+static bool HistoryCheckForDuplicate(CLI_HISTORY *pHistory, const char *pCommand,
+                                     uint32_t length)
+{
+    bool status = false;
+    uint32_t offset;
+    uint32_t i;
+
+    /* If history file is empty then not a duplicate. The length of the most recent command
+     * rejects most candidates without comparing characters. */
+    if ((pHistory->headIndex != pHistory->tailIndex) &&
+        (pHistory->ring[(pHistory->headIndex - 1) % APP_CFG_CLI_HISTORY_NUM_BYTES] == length))
+    {
+        offset = pHistory->headIndex - 1 - length;
+        status = true;
+        for (i = 0; (status == true) && (i < length); i++)
         {
-            status = true;
+            status = (pHistory->ring[(offset + i) % APP_CFG_CLI_HISTORY_NUM_BYTES] ==
+                      (uint8_t)pCommand[i]);
         }
     }
-    /* pCommand is not same as immediate command history */
     return status;
 }
 
+static char *HistoryGetCommand(CLI_HISTORY_DATA *pInfo, uint32_t offset)
+{
+    CLI_HISTORY *pHistory = &pInfo->history;
+    uint32_t length = pHistory->ring[offset % APP_CFG_CLI_HISTORY_NUM_BYTES];
+
+    HistoryRingRead(pHistory, offset + 1, length, &pInfo->trimCommand[0]);
+    pInfo->trimCommand[length] = '\0';
+    return &pInfo->trimCommand[0];
+}
+
 int32_t HistoryAppend(CLI_HISTORY_DATA *pInfo, const char *pCommand)
 {
-    size_t commandSize = 0;
-    /** Controls pointer adjustment */
-    int32_t control = 0;
-    /** API return status */
-    int32_t status = HISTORY_SUCCESS;
+    const char *pEnd;
+    uint32_t length;
+    uint8_t lengthByte;
     CLI_HISTORY *pHistory = &pInfo->history;
 
-    /* Trim leading and trailing whitespace, return if empty string */
-    commandSize = TrimWhiteSpaces(pCommand, &pInfo->trimCommand[0]);
+    /* Trim leading and trailing whitespace in place, return if empty string */
+    while (isspace((unsigned char)*pCommand))
+    {
+        pCommand++;
+    }
+    pEnd = pCommand + StrnLen(pCommand, HISTORY_MAX_ENTRY_LENGTH);
+    while ((pEnd > pCommand) && isspace((unsigned char)pEnd[-1]))
+    {
+        pEnd--;
+    }
+    length = (uint32_t)(pEnd - pCommand);
+    if (length > HISTORY_MAX_ENTRY_LENGTH)
+    {
+        length = HISTORY_MAX_ENTRY_LENGTH;
+    }
+    if (length > APP_CFG_CLI_HISTORY_NUM_BYTES - HISTORY_ENTRY_OVERHEAD)
+    {
+        length = APP_CFG_CLI_HISTORY_NUM_BYTES - HISTORY_ENTRY_OVERHEAD;
+    }
 
-    if (commandSize != 0)
+    if (length != 0)
     {
         /* Check if candidate is duplicate with most recent command history */
-        if (HistoryCheckForDuplicate(pInfo, &pInfo->trimCommand[0]) == true)
-        {
-            /* Push pointer p to h because this candidate may have been
-             * an up arrow (which lifted curIndex)
-             */
-            pHistory->curIndex = pHistory->headIndex;
-            control = 1;
-        }
-        else
+        if (HistoryCheckForDuplicate(pHistory, pCommand, length) == false)
         {
-            /* Copy the command to head and update counter for that line */
-            StrCopy(&pInfo->trimCommand[0], HISTORY_ENTRY_LENGTH,
-                    pHistory->list[pHistory->headIndex]);
-        }
-        if (!control)
-        {
-            /* Increment head pointer and see if tail should follow */
-            pHistory->headIndex++;
-            pHistory->headIndex = (pHistory->headIndex < HISTORY_DEPTH ? pHistory->headIndex : 0);
-            pHistory->curIndex = pHistory->headIndex;
-            if (pHistory->headIndex == pHistory->tailIndex)
+            /* Drop the oldest commands until the new one fits */
+            while (pHistory->headIndex + length + HISTORY_ENTRY_OVERHEAD - pHistory->tailIndex >
+                   APP_CFG_CLI_HISTORY_NUM_BYTES)
+            {
+                pHistory->tailIndex +=
+                    pHistory->ring[pHistory->tailIndex % APP_CFG_CLI_HISTORY_NUM_BYTES] +
+                    HISTORY_ENTRY_OVERHEAD;
+            }
+            lengthByte = (uint8_t)length;
+            HistoryRingWrite(pHistory, pHistory->headIndex, 1, (const char *)&lengthByte);
+            HistoryRingWrite(pHistory, pHistory->headIndex + 1, length, pCommand);
+            HistoryRingWrite(pHistory, pHistory->headIndex + 1 + length, 1,
+                             (const char *)&lengthByte);
+            pHistory->headIndex += length + HISTORY_ENTRY_OVERHEAD;
+            /* Keep the offsets small so that they never wrap around 32 bits */
+            if (pHistory->tailIndex >= APP_CFG_CLI_HISTORY_NUM_BYTES)
             {
-                pHistory->tailIndex++;
-                pHistory->tailIndex =
-                    (pHistory->tailIndex < HISTORY_DEPTH ? pHistory->tailIndex : 0);
+                pHistory->tailIndex -= APP_CFG_CLI_HISTORY_NUM_BYTES;
+                pHistory->headIndex -= APP_CFG_CLI_HISTORY_NUM_BYTES;
             }
         }
+        /* Push pointer p to h because this candidate may have been
+         * an up arrow (which lifted curIndex)
+         */
+        pHistory->curIndex = pHistory->headIndex;
     }
-    return status;
+    return HISTORY_SUCCESS;
 }
 
 void HistoryInit(CLI_HISTORY_DATA *pInfo)
 {
-    int32_t i = 0;
-    int32_t j = 0;
     CLI_HISTORY *pHistory = &pInfo->history;
     pHistory->headIndex = 0;
     pHistory->tailIndex = 0;
-
-    /* Iteratively clearing all the 16 command elements in the list */
-    for (i = 0; i < HISTORY_DEPTH; i++)
-    {
-        for (j = 0; j < APP_CFG_CLI_MAX_PARAM_LENGTH; j++)
-        {
-            pHistory->list[i][j] = '\0';
-        }
-    }
+    pHistory->curIndex = 0;
 }
 
 char *HistoryScrollUp(CLI_HISTORY_DATA *pInfo)
@@ -124,13 +202,11 @@ char *HistoryScrollUp(CLI_HISTORY_DATA *pInfo)
      */
     if (pHistory->curIndex != pHistory->tailIndex)
     {
-        /* Move pointer back one position, modulo */
-        pHistory->curIndex--;
-        pHistory->curIndex =
-            (pHistory->curIndex >= HISTORY_DEPTH ? HISTORY_DEPTH - 1 : pHistory->curIndex);
-
-        /* Return pointer to this command string */
-        pCommand = (char *)&pHistory->list[pHistory->curIndex];
+        /* Step back over the previous command using the length stored after it */
+        pHistory->curIndex -=
+            pHistory->ring[(pHistory->curIndex - 1) % APP_CFG_CLI_HISTORY_NUM_BYTES] +
+            HISTORY_ENTRY_OVERHEAD;
+        pCommand = HistoryGetCommand(pInfo, pHistory->curIndex);
     }
 
     return pCommand;
@@ -143,17 +219,17 @@ char *HistoryScrollDown(CLI_HISTORY_DATA *pInfo)
     /* Commands available/non-empty history list */
     if (pHistory->curIndex != pHistory->headIndex)
     {
-
-        /* Increment curIndex and if it points to head,
+        /* Step over the current command and if it points to head,
          * then no subsequent commands, return null,
          * otherwise return current index command
          */
-        pHistory->curIndex++;
-        pHistory->curIndex = (pHistory->curIndex < HISTORY_DEPTH ? pHistory->curIndex : 0);
+        pHistory->curIndex +=
+            pHistory->ring[pHistory->curIndex % APP_CFG_CLI_HISTORY_NUM_BYTES] +
+            HISTORY_ENTRY_OVERHEAD;
         if (pHistory->curIndex != pHistory->headIndex)
         {
             /* pointer is now on valid history line, return point to it */
-            pCommand = (char *)&pHistory->list[pHistory->curIndex];
+            pCommand = HistoryGetCommand(pInfo, pHistory->curIndex);
         }
     }
     return pCommand;
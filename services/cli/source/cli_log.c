@@ -0,0 +1,429 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     cli_log.c
+ * @brief    This file contains definitions of the ring of deferred log records
+ * @{
+ */
+
+/*==========================  I N C L U D E S   ==========================*/
+#include "cli_log.h"
+#include "adi_circ_buf.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/*==========================  D E F I N E S   ==========================*/
+
+/** @brief Replacement of a NULL string argument */
+#define CLI_LOG_NULL_STRING "(null)"
+
+/*========================== D A T A  T Y P E S ==========================*/
+
+const char adi_cli_LogFormatBase[] = "";
+
+/**
+ * @brief Argument words of the record being written
+ */
+typedef struct
+{
+    /** Argument words */
+    uint32_t *pWords;
+    /** Number of words stored */
+    uint32_t numWords;
+    /** Set once an argument did not fit */
+    bool isFull;
+    /** Set if a string argument was shortened */
+    bool isStringTruncated;
+} CLI_LOG_ARGS;
+
+/*========================== P R O T O T Y P E S ==========================*/
+
+/**
+ * @brief Appends a value to the argument words.
+ * @param[in] pArgs	    - argument words
+ * @param[in] pValue	- value
+ * @param[in] numBytes	- number of bytes of the value, a multiple of 4
+ */
+static void LogPutValue(CLI_LOG_ARGS *pArgs, const void *pValue, uint32_t numBytes);
+
+/**
+ * @brief Appends a string to the argument words as its length followed by its characters.
+ * @param[in] pArgs	    - argument words
+ * @param[in] pString	- string, may be NULL
+ * @param[in] precision	- maximum number of characters of the conversion, negative if none
+ */
+static void LogPutString(CLI_LOG_ARGS *pArgs, const char *pString, int32_t precision);
+
+/**
+ * @brief Stores the arguments of a format string as argument words.
+ * @param[in] pArgs	    - argument words
+ * @param[in] pFormat	- format string, scanned for the types of the arguments
+ * @param[in] pVaArgs	- arguments of the format string
+ */
+static void LogPackArgs(CLI_LOG_ARGS *pArgs, const char *pFormat, va_list pVaArgs);
+
+/**
+ * @brief Reserves the words of a record, padding the ring up to its end if needed.
+ * @param[in] pRing	        - pointer to the log ring
+ * @param[in] numWords	    - number of words of the record
+ * @param[out] pPosition	- position of the record in the ring
+ * @return 0 on success, 1 if the ring is full
+ */
+static int32_t LogReserve(CLI_LOG_RING *pRing, uint32_t numWords, uint32_t *pPosition);
+
+/**
+ * @brief Atomically replaces the reserve index if it still holds the expected value.
+ * @param[in] pRing	        - pointer to the log ring
+ * @param[in,out] pExpected	- expected value, updated to the current value on failure
+ * @param[in] value	        - new value
+ * @return true if the index was replaced
+ */
+static bool LogCompareExchange(CLI_LOG_RING *pRing, uint32_t *pExpected, uint32_t value);
+
+/*==========================  D E F I N I T I O N S ==========================*/
+
+void CliLogInit(CLI_LOG_RING *pRing, uint32_t *pBase, uint32_t numWords)
+{
+    pRing->pBase = pBase;
+    pRing->numWords = numWords;
+    pRing->reserveIndex = 0;
+    pRing->readIndex = 0;
+    pRing->numDropped = 0;
+    if (pBase != NULL)
+    {
+        memset(pBase, 0, numWords * sizeof(uint32_t));
+    }
+}
+
+int32_t CliLogVWrite(CLI_LOG_RING *pRing, uint32_t level, const char *pFormat, va_list pArgs)
+{
+    int32_t status = 0;
+    uint32_t record[CLI_LOG_MAX_RECORD_NUM_WORDS];
+    CLI_LOG_ARGS args = {&record[ADI_CLI_LOG_RECORD_HEADER_NUM_WORDS], 0, false, false};
+    uint32_t numWords;
+    uint32_t header;
+    uint32_t position;
+
+    LogPackArgs(&args, pFormat, pArgs);
+    numWords = ADI_CLI_LOG_RECORD_HEADER_NUM_WORDS + args.numWords;
+    header = CLI_LOG_HEADER(numWords, level);
+    if (args.isFull || args.isStringTruncated)
+    {
+        header |= ADI_CLI_LOG_FLAG_TRUNCATED;
+    }
+    record[1] = CLI_LOG_FORMAT_ID(pFormat);
+
+    if (LogReserve(pRing, numWords, &position) != 0)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __atomic_fetch_add(&pRing->numDropped, 1u, __ATOMIC_RELAXED);
+#else
+        pRing->numDropped++;
+#endif
+        status = 1;
+    }
+    else
+    {
+        memcpy(&pRing->pBase[position + 1], &record[1], (numWords - 1) * sizeof(uint32_t));
+        /* The header publishes the record to the consumer */
+        ADI_CIRC_BUF_STORE_INDEX(&pRing->pBase[position], header);
+    }
+    return status;
+}
+
+uint32_t CliLogRead(CLI_LOG_RING *pRing, uint8_t *pDest, uint32_t maxNumWords)
+{
+    uint32_t numWordsCopied = 0;
+    uint32_t readIndex = pRing->readIndex;
+    uint32_t position;
+    uint32_t header;
+    uint32_t numWords;
+
+    while (readIndex != ADI_CIRC_BUF_LOAD_INDEX(&pRing->reserveIndex))
+    {
+        position = readIndex & (pRing->numWords - 1u);
+        header = ADI_CIRC_BUF_LOAD_INDEX(&pRing->pBase[position]);
+        numWords = ADI_CLI_LOG_HEADER_NUM_WORDS(header);
+        if (numWords == 0)
+        {
+            /* Reserved by a producer that has not completed the record yet */
+            break;
+        }
+        if (ADI_CLI_LOG_HEADER_LEVEL(header) != CLI_LOG_LEVEL_PAD)
+        {
+            if (numWordsCopied + numWords > maxNumWords)
+            {
+                break;
+            }
+            memcpy(&pDest[numWordsCopied * sizeof(uint32_t)], &pRing->pBase[position],
+                   numWords * sizeof(uint32_t));
+            numWordsCopied += numWords;
+        }
+        memset(&pRing->pBase[position], 0, numWords * sizeof(uint32_t));
+        readIndex += numWords;
+        ADI_CIRC_BUF_STORE_INDEX(&pRing->readIndex, readIndex);
+    }
+    return numWordsCopied;
+}
+
+uint32_t CliLogTakeDropped(CLI_LOG_RING *pRing)
+{
+    uint32_t numDropped;
+#if defined(__GNUC__) || defined(__clang__)
+    numDropped = __atomic_exchange_n(&pRing->numDropped, 0u, __ATOMIC_RELAXED);
+#else
+    numDropped = pRing->numDropped;
+    pRing->numDropped = 0;
+#endif
+    return numDropped;
+}
+
+static int32_t LogReserve(CLI_LOG_RING *pRing, uint32_t numWords, uint32_t *pPosition)
+{
+    uint32_t reserveIndex = ADI_CIRC_BUF_LOAD_INDEX(&pRing->reserveIndex);
+    uint32_t position;
+    uint32_t numPadWords;
+
+    do
+    {
+        position = reserveIndex & (pRing->numWords - 1u);
+        numPadWords = 0;
+        if (position + numWords > pRing->numWords)
+        {
+            numPadWords = pRing->numWords - position;
+        }
+        if (reserveIndex + numPadWords + numWords - ADI_CIRC_BUF_LOAD_INDEX(&pRing->readIndex) >
+            pRing->numWords)
+        {
+            return 1;
+        }
+    } while (!LogCompareExchange(pRing, &reserveIndex, reserveIndex + numPadWords + numWords));
+
+    if (numPadWords != 0)
+    {
+        ADI_CIRC_BUF_STORE_INDEX(&pRing->pBase[position],
+                                 CLI_LOG_HEADER(numPadWords, CLI_LOG_LEVEL_PAD));
+        position = 0;
+    }
+    *pPosition = position;
+    return 0;
+}
+
+static bool LogCompareExchange(CLI_LOG_RING *pRing, uint32_t *pExpected, uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_compare_exchange_n(&pRing->reserveIndex, pExpected, value, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#else
+    /* Without atomic operations only a single producer is supported */
+    (void)pExpected;
+    pRing->reserveIndex = value;
+    return true;
+#endif
+}
+
+static void LogPackArgs(CLI_LOG_ARGS *pArgs, const char *pFormat, va_list pVaArgs)
+{
+    const char *pChar = pFormat;
+    int32_t precision;
+    int32_t intValue;
+    uint32_t numBytes;
+    uint32_t value32;
+    uint64_t value64;
+    uintptr_t pointer;
+    double doubleValue;
+    bool isLongDouble;
+
+    while (!pArgs->isFull && (*pChar != '\0'))
+    {
+        if (*pChar++ != '%')
+        {
+            continue;
+        }
+        if (*pChar == '%')
+        {
+            pChar++;
+            continue;
+        }
+        while ((*pChar != '\0') && (strchr("-+ #0", *pChar) != NULL))
+        {
+            pChar++;
+        }
+        /* Width */
+        if (*pChar == '*')
+        {
+            intValue = va_arg(pVaArgs, int);
+            LogPutValue(pArgs, &intValue, sizeof(int32_t));
+            pChar++;
+        }
+        while ((*pChar >= '0') && (*pChar <= '9'))
+        {
+            pChar++;
+        }
+        /* Precision */
+        precision = -1;
+        if (*pChar == '.')
+        {
+            pChar++;
+            precision = 0;
+            if (*pChar == '*')
+            {
+                precision = va_arg(pVaArgs, int);
+                LogPutValue(pArgs, &precision, sizeof(int32_t));
+                pChar++;
+            }
+            while ((*pChar >= '0') && (*pChar <= '9'))
+            {
+                precision = precision * 10 + (*pChar++ - '0');
+            }
+        }
+        /* Length modifier */
+        numBytes = sizeof(int);
+        isLongDouble = false;
+        switch (*pChar)
+        {
+        case 'h':
+            pChar += (pChar[1] == 'h') ? 2 : 1;
+            break;
+        case 'l':
+            numBytes = (pChar[1] == 'l') ? sizeof(long long) : sizeof(long);
+            pChar += (pChar[1] == 'l') ? 2 : 1;
+            break;
+        case 'j':
+            numBytes = sizeof(intmax_t);
+            pChar++;
+            break;
+        case 'z':
+            numBytes = sizeof(size_t);
+            pChar++;
+            break;
+        case 't':
+            numBytes = sizeof(ptrdiff_t);
+            pChar++;
+            break;
+        case 'L':
+            isLongDouble = true;
+            pChar++;
+            break;
+        default:
+            break;
+        }
+        /* Conversion */
+        switch (*pChar)
+        {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'c':
+            if (numBytes > sizeof(uint32_t))
+            {
+                value64 = va_arg(pVaArgs, unsigned long long);
+                LogPutValue(pArgs, &value64, sizeof(uint64_t));
+            }
+            else
+            {
+                value32 = va_arg(pVaArgs, unsigned int);
+                LogPutValue(pArgs, &value32, sizeof(uint32_t));
+            }
+            break;
+        case 'p':
+            /* The whole pointer is stored so that none is truncated on 64-bit hosts */
+            pointer = (uintptr_t)va_arg(pVaArgs, void *);
+            LogPutValue(pArgs, &pointer, sizeof(uintptr_t));
+            break;
+        case 'n':
+            /* Nothing is written back, the argument is skipped */
+            (void)va_arg(pVaArgs, void *);
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            doubleValue =
+                isLongDouble ? (double)va_arg(pVaArgs, long double) : va_arg(pVaArgs, double);
+            LogPutValue(pArgs, &doubleValue, sizeof(double));
+            break;
+        case 's':
+            LogPutString(pArgs, va_arg(pVaArgs, const char *), precision);
+            break;
+        default:
+            /* The types of the remaining arguments are unknown */
+            pArgs->isFull = true;
+            break;
+        }
+        if (*pChar != '\0')
+        {
+            pChar++;
+        }
+    }
+}
+
+static void LogPutValue(CLI_LOG_ARGS *pArgs, const void *pValue, uint32_t numBytes)
+{
+    uint32_t numWords = numBytes / sizeof(uint32_t);
+    if (pArgs->isFull || (pArgs->numWords + numWords > APP_CFG_CLI_LOG_MAX_ARG_WORDS))
+    {
+        pArgs->isFull = true;
+    }
+    else
+    {
+        memcpy(&pArgs->pWords[pArgs->numWords], pValue, numBytes);
+        pArgs->numWords += numWords;
+    }
+}
+
+static void LogPutString(CLI_LOG_ARGS *pArgs, const char *pString, int32_t precision)
+{
+    uint32_t maxLength = APP_CFG_CLI_LOG_MAX_STRING_LENGTH;
+    uint32_t length = 0;
+    uint32_t numWords;
+
+    if (pString == NULL)
+    {
+        pString = CLI_LOG_NULL_STRING;
+    }
+    if ((precision >= 0) && ((uint32_t)precision < maxLength))
+    {
+        maxLength = (uint32_t)precision;
+    }
+    while ((length < maxLength) && (pString[length] != '\0'))
+    {
+        length++;
+    }
+    if ((length == APP_CFG_CLI_LOG_MAX_STRING_LENGTH) && (pString[length] != '\0') &&
+        ((precision < 0) || ((uint32_t)precision > length)))
+    {
+        pArgs->isStringTruncated = true;
+    }
+
+    numWords = (length + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    if (pArgs->isFull || (pArgs->numWords + 1 + numWords > APP_CFG_CLI_LOG_MAX_ARG_WORDS))
+    {
+        pArgs->isFull = true;
+    }
+    else
+    {
+        pArgs->pWords[pArgs->numWords++] = length;
+        if (numWords > 0)
+        {
+            /* Characters are padded with zeros up to the last word */
+            pArgs->pWords[pArgs->numWords + numWords - 1] = 0;
+            memcpy(&pArgs->pWords[pArgs->numWords], pString, length);
+        }
+        pArgs->numWords += numWords;
+    }
+}
+
+/**
+ * @}
+ */
@@ -18,6 +18,8 @@
 #include "cli_history.h"
 #include "internal_dispatch_table.h"
 #include <ctype.h>
+#include <limits.h>
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -57,8 +59,28 @@
 /** @brief state machine ID to move control to the end of the line */
 #define CLI_MET_CTRL_END ('4')
 
+/** @brief Characters separating the command name from its arguments */
+#define CLI_COMMAND_DELIMITERS " ,;\t"
+
 /*========================== D A T A T Y P E S ==========================*/
 
+/**
+ * @brief Visible commands whose names start with a prefix.
+ */
+typedef struct
+{
+    /** Number of commands found */
+    int32_t numMatches;
+    /** Name of the first command found */
+    const char *pName;
+    /** Number of leading characters shared by the names of all commands found */
+    uint32_t commonLength;
+    /** Record of the internal dispatch table last found, or NULL */
+    const InternalCommand *pInternalRecord;
+    /** Record of the dispatch table last found, or NULL */
+    const Command *pDispatchRecord;
+} CLI_PREFIX_MATCH;
+
 /*========================== P R O T O T Y P E S ==========================*/
 
 /**
@@ -76,6 +98,40 @@ static void CliInsertChar(CLI_PRIVATE *pInfo, const char inputChar);
  */
 static int32_t CliProcessInputChar(CLI_PRIVATE *pInfo, const char inputChar);
 
+/**
+ * @brief  Finds the visible commands of the internal and the dispatch table whose names start
+ * with a prefix, ignoring case. The dispatch table is searched through its sorted index.
+ * @param[in] pInfo          - pointer to CLI interface structure.
+ * @param[in] pPrefix        - prefix, needs no terminating null.
+ * @param[in] prefixLen      - number of characters of the prefix.
+ * @param[in] pDispatchTable - pointer to dispatch table, may be NULL.
+ * @param[in] numRecords     - number of records in dispatch table.
+ * @param[in] print          - print the name of each command found.
+ * @param[out] pMatch        - commands found.
+ */
+static void CliFindPrefix(CLI_PRIVATE *pInfo, const char *pPrefix, uint32_t prefixLen,
+                          const Command *pDispatchTable, int32_t numRecords, bool print,
+                          CLI_PREFIX_MATCH *pMatch);
+
+/**
+ * @brief  Adds a command to the commands found by #CliFindPrefix.
+ * @param[in] pInfo   - pointer to CLI interface structure.
+ * @param[in] pName   - name of the command.
+ * @param[in] print   - print the name.
+ * @param[out] pMatch - commands found.
+ */
+static void CliAddPrefixMatch(CLI_PRIVATE *pInfo, const char *pName, bool print,
+                              CLI_PREFIX_MATCH *pMatch);
+
+/**
+ * @brief  Completes the command name before the cursor for TAB. The name is extended to the
+ * longest prefix shared by all commands starting with it, followed by a space if only one
+ * command matches. If the name cannot be extended, the matching commands are listed and the
+ * edit line is shown again. The dispatch table is the one of the last command dispatched.
+ * @param[in] pInfo - pointer to CLI interface structure.
+ */
+static void CliCompleteCommand(CLI_PRIVATE *pInfo);
+
 /**
  * @brief  Move cursor to beginning of line, and fill edit line with command string.
  * @param[in] pEditLine    - handle to CLI editline.
@@ -167,6 +223,15 @@ static int32_t CliInsertControlChars(CLI_PRIVATE *pInfo, int32_t ctrlFuncID);
  */
 static int32_t CliInsertManualControlChars(CLI_PRIVATE *pInfo, int32_t ctrlFuncID);
 
+/**
+ * @brief  Function to insert or delete characters at the cursor with one terminal sequence.
+ * @param[in] ctrlFuncID    - #CLI_CTRL_INSERT or #CLI_CTRL_DELETE.
+ * @param[in] numChars      - number of characters, nothing is sent for 0.
+ * @return  0 - Success, 1 - Failed.
+ */
+static int32_t CliInsertEditControlChars(CLI_PRIVATE *pInfo, int32_t ctrlFuncID,
+                                         uint32_t numChars);
+
 /**
  * @brief  Scans each input char and form an input command/control char action.
  * @return  0 - Success, 1 - Failed.
@@ -180,26 +245,83 @@ static int32_t CliScanInputChars(CLI_PRIVATE *pInfo);
  * @param[out] pArgs          - pointer to command arguments storage.
  * @return  0 - Success, 1 - Failed.
  */
-static int32_t CliDispatch(const Command *pDispatchRecord, Args *pArgs, bool silent);
+static int32_t CliDispatch(CLI_PRIVATE *pInfo, CLI_TOKENIZER *pTokenizer,
+                           const Command *pDispatchRecord, Args *pArgs, bool silent);
 
 /**
- * @brief  Parse the command arguments list based on their data type.
- * @param[in] pPattern      - pointer to user input command string.
- * @param[in] pArgs         - pointer to user input command string.
+ * @brief  Parse the next command argument based on its data type.
+ * @param[in] pInfo         - pointer to CLI interface structure.
+ * @param[in] pTokenizer    - tokenizer positioned at the argument.
+ * @param[in] pArgs         - pointer to command arguments storage.
  * @param[in] argIndex      - argument index/position.
  * @param[in] dataType      - argument data type.
- * @return  0 - Success, 1 - Failed.
+ * @param[in] silent        - flag silent parse.
+ * @return  0 - Success or argument not present, 1 - Failed.
  */
-static int32_t CliScanParams(char *pPattern, Args *pArgs, int32_t argIndex, int32_t dataType);
+static int32_t CliScanParams(CLI_PRIVATE *pInfo, CLI_TOKENIZER *pTokenizer, Args *pArgs,
+                             int32_t argIndex, int32_t dataType, bool silent);
 
 /**
  * @brief  State machine to parse arguments of a command.
+ * @param[in] pInfo       - pointer to CLI interface structure.
+ * @param[in] pTokenizer  - tokenizer positioned after the command name.
  * @param[in] pParams	  - handle to dispatch table.
  * @param[in] silent      - flag silent parse.
  * @param[out] pArgs      - pointer to command arguments storage.
  * @return  0 - Success, 1 - Failed.
  */
-static int32_t CliParseParams(const char *pParams, Args *pArgs, bool silent);
+static int32_t CliParseParams(CLI_PRIVATE *pInfo, CLI_TOKENIZER *pTokenizer, const char *pParams,
+                              Args *pArgs, bool silent);
+
+/**
+ * @brief  Splits off the next token of the command line in place.
+ * @param[in] pTokenizer   - tokenizer state.
+ * @param[in] pDelimiters  - characters separating the tokens.
+ * @param[in] allowQuotes  - treat text between a pair of single or double quotes as one token.
+ * @return  pointer to the null terminated token, NULL if there are no more tokens.
+ */
+static char *CliNextToken(CLI_TOKENIZER *pTokenizer, const char *pDelimiters, bool allowQuotes);
+
+/**
+ * @brief  Converts a token to an integer. Accepts an optional sign and decimal, octal (leading
+ * 0) or hexadecimal (leading 0x) digits. Octal and hexadecimal values may use the full unsigned
+ * range.
+ * @param[in] pToken   - null terminated token.
+ * @param[out] pValue  - converted value.
+ * @return  0 - Success, 1 - not an integer or out of range.
+ */
+static int32_t CliParseInteger(const char *pToken, long *pValue);
+
+/**
+ * @brief  Converts a token to a floating point value. Accepts an optional sign, decimal digits
+ * with an optional fraction and an optional exponent. The digits are accumulated in an integer
+ * and scaled once by a power of ten.
+ * @param[in] pToken   - null terminated token.
+ * @param[out] pValue  - converted value.
+ * @return  0 - Success, 1 - not a number.
+ */
+static int32_t CliParseFixed(const char *pToken, double *pValue);
+
+/**
+ * @brief  Decodes little endian binary arguments based on the parameter list of a command.
+ * String arguments are moved down over their length field and null terminated in place.
+ * @param[in] pData       - pointer to the arguments in the frame.
+ * @param[in] numBytes    - number of bytes of arguments.
+ * @param[in] pParamList  - list of argument types.
+ * @param[out] pArgs      - pointer to command arguments storage.
+ * @return  0 - Success, 1 - arguments are truncated or there are extra bytes.
+ */
+static int32_t CliDecodeBinaryParams(uint8_t *pData, uint32_t numBytes, const char *pParamList,
+                                     Args *pArgs);
+
+/**
+ * @brief  Sends the answer to a binary frame.
+ * @param[in] pInfo   - pointer to CLI interface structure.
+ * @param[in] cmdId   - command ID of the frame.
+ * @param[in] status  - status of the command, see #ADI_CLI_BINARY_STATUS.
+ * @return  0 - Success, -1 - not enough space in the transmit buffer.
+ */
+static int32_t CliSendBinaryAnswer(CLI_PRIVATE *pInfo, uint8_t cmdId, uint8_t status);
 
 /**
  * @brief Resets the Edit line buffer.
@@ -244,7 +366,14 @@ int32_t CliGetCmd(CLI_PRIVATE *pInfo, char *pString)
 #ifdef DEBUG_CLI
     CliReadFileInput(pString);
 #else
-    status = CliReadCommandLineInput(pInfo, pString);
+    if (pInfo->binaryMode)
+    {
+        status = CliGetBinaryFrame(pInfo);
+    }
+    else
+    {
+        status = CliReadCommandLineInput(pInfo, pString);
+    }
 #endif
     return status;
 }
@@ -253,8 +382,6 @@ static int32_t CliScanInputChars(CLI_PRIVATE *pInfo)
 {
     char *pCommand = NULL;
     int32_t status = 1;
-    /* State variable for building ANSI escape sequences */
-    static int32_t escSeqState = 0;
     int32_t inputChar = CliGetChar(pInfo);
     if (inputChar != EOF)
     {
@@ -265,14 +392,14 @@ static int32_t CliScanInputChars(CLI_PRIVATE *pInfo)
             CliOverwriteLineWithPrompt(pInfo);
         }
         /* State machine that constructs an ANSI ESC sequence from char */
-        switch (escSeqState)
+        switch (pInfo->escSeqState)
         {
 
         /* Initiate one/process character, if no ESC sequence is initiated yet */
         case CLI_MET_NO_CHAR:
             if (inputChar == 0x1B)
             {
-                escSeqState++;
+                pInfo->escSeqState++;
             }
             else
             {
@@ -283,11 +410,11 @@ static int32_t CliScanInputChars(CLI_PRIVATE *pInfo)
         case CLI_MET_ESC_CHAR:
             if (inputChar == '[')
             {
-                escSeqState++;
+                pInfo->escSeqState++;
             }
             else
             {
-                escSeqState = 0;
+                pInfo->escSeqState = 0;
             }
             break;
         /* So far we have an 'ESC[' sequence, and now check for A, B, C or D */
@@ -302,7 +429,7 @@ static int32_t CliScanInputChars(CLI_PRIVATE *pInfo)
                 {
                     CliFillCommandLine(pInfo, pCommand);
                 }
-                escSeqState = 0;
+                pInfo->escSeqState = 0;
                 break;
 
             /* Down arrow */
@@ -316,36 +443,36 @@ static int32_t CliScanInputChars(CLI_PRIVATE *pInfo)
                 {
                     CliReset(pInfo);
                 }
-                escSeqState = 0;
+                pInfo->escSeqState = 0;
                 break;
 
             /* Right arrow */
             case CLI_MET_CTRL_RIGHT:
                 CliMoveCursorForward(pInfo);
-                escSeqState = 0;
+                pInfo->escSeqState = 0;
                 break;
 
             /* Left arrow */
             case CLI_MET_CTRL_LEFT:
                 CliMoveCursorBackward(pInfo);
-                escSeqState = 0;
+                pInfo->escSeqState = 0;
                 break;
 
             /* Home */
             case CLI_MET_CTRL_HOME:
                 CliMoveCursorToStart(pInfo);
-                ++escSeqState;
+                ++pInfo->escSeqState;
                 break;
 
             /* End */
             case CLI_MET_CTRL_END:
                 CliMoveCursorToEnd(pInfo);
-                ++escSeqState;
+                ++pInfo->escSeqState;
                 break;
 
             /* Unrecognized escape sequence */
             default:
-                ++escSeqState;
+                ++pInfo->escSeqState;
                 break;
             }
             break;
@@ -354,13 +481,13 @@ static int32_t CliScanInputChars(CLI_PRIVATE *pInfo)
         case CLI_MET_FINAL_CHAR:
             if (inputChar == '~')
             {
-                escSeqState = 0;
+                pInfo->escSeqState = 0;
             }
             break;
 
         /* The state variable is somehow out of whack, reset it */
         default:
-            escSeqState = 0;
+            pInfo->escSeqState = 0;
             break;
         }
     }
@@ -423,15 +550,21 @@ static void CliEditLineReset(EditLine *pInfo)
     pInfo->numCharsToPrint = 0;
 }
 
-static int32_t CliDispatch(const Command *pDispatchRecord, Args *pArgs, bool silent)
+static int32_t CliDispatch(CLI_PRIVATE *pInfo, CLI_TOKENIZER *pTokenizer,
+                           const Command *pDispatchRecord, Args *pArgs, bool silent)
 {
     /* Initializing status to error*/
     int32_t status = 1;
-    status = CliParseParams(pDispatchRecord->pParamList, pArgs, silent);
+    status = CliParseParams(pInfo, pTokenizer, pDispatchRecord->pParamList, pArgs, silent);
     if (status == 0)
     {
         /* Call respective command function */
         status = (int32_t)pDispatchRecord->pfFunc(pArgs);
+        if (status == CMD_IN_PROGRESS)
+        {
+            pInfo->pResumeRecord = pDispatchRecord;
+            status = 0;
+        }
     }
 
     return status;
@@ -442,11 +575,13 @@ int32_t CliParse(CLI_PRIVATE *pInfo, char *pCommand, const Command *pDispatchTab
 {
     bool silent = false;
     char *pCommandToken = NULL;
-    const Command *pDispatchRecord;
+    const Command *pDispatchRecord = NULL;
+    const InternalCommand *pInternalRecord = NULL;
     int32_t numInternalDispatchRecords;
-    int32_t internalCmdFlag = 0;
     int32_t i;
     CLI_DISPATCH_DATA *pDispatchInfo = &pInfo->cliDispatchData;
+    CLI_TOKENIZER tokenizer;
+    CLI_PREFIX_MATCH match;
     // Initialize sArgs to 0
     memset(&pDispatchInfo->sArgs, 0, sizeof(pDispatchInfo->sArgs));
     int32_t status = 0;
@@ -454,7 +589,8 @@ int32_t CliParse(CLI_PRIVATE *pInfo, char *pCommand, const Command *pDispatchTab
     /* Parse off the first token from command line in pCommand,
      * should be the command name.
      */
-    pCommandToken = strtok(pCommand, " ,;\t");
+    tokenizer.pNext = pCommand;
+    pCommandToken = CliNextToken(&tokenizer, CLI_COMMAND_DELIMITERS, false);
     numInternalDispatchRecords = (sizeof(internalDispatchTable) / sizeof(InternalCommand));
     if (pCommandToken != NULL)
     {
@@ -462,57 +598,160 @@ int32_t CliParse(CLI_PRIVATE *pInfo, char *pCommand, const Command *pDispatchTab
         {
             if (strcmp(internalDispatchTable[i].pName, pCommandToken) == 0)
             {
-                status = CliParseParams(internalDispatchTable[i].pParamList, &pDispatchInfo->sArgs,
-                                        silent);
-                if (strcmp(internalDispatchTable[i].pName, "echo") == 0)
-                {
-                    status = CliCmdEcho(pInfo, pDispatchTable, &pDispatchInfo->sArgs, numRecords);
-                }
-                else if (strcmp(internalDispatchTable[i].pName, "help") == 0)
-                {
-                    status = CliHelp(pInfo, pDispatchTable, &pDispatchInfo->sArgs, numRecords);
-                }
-#ifdef ENABLE_X86_BUILD
-                else if (strcmp(internalDispatchTable[i].pName, "exit") == 0)
-                {
-                    status = CliExit(pInfo, pDispatchTable, &pDispatchInfo->sArgs, numRecords);
-                }
-#endif
-                internalCmdFlag = 1;
-
+                pInternalRecord = &internalDispatchTable[i];
                 break;
             }
         }
-        if (internalCmdFlag == 0)
+        if (pInternalRecord == NULL)
         {
             pDispatchRecord = (const Command *)DispatchGetCommandDetails(
                 pDispatchInfo, pCommandToken, pDispatchTable, numRecords);
-            if (pDispatchRecord != NULL)
+        }
+        if ((pInternalRecord == NULL) && (pDispatchRecord == NULL))
+        {
+            /* A command may be abbreviated to any prefix that no other visible command has */
+            CliFindPrefix(pInfo, pCommandToken, (uint32_t)strlen(pCommandToken), pDispatchTable,
+                          numRecords, false, &match);
+            if (match.numMatches == 1)
             {
+                pInternalRecord = match.pInternalRecord;
+                pDispatchRecord = match.pDispatchRecord;
+            }
+        }
 
-                /* Got a matching command record */
-                /* It's a good command, and not hidden (or we are in unlock
-                 * mode anyway) parse parameters required for this command */
-                status = CliDispatch(pDispatchRecord, &pDispatchInfo->sArgs, silent);
-                if (status != 0)
-                {
-                    INFO_MSG("Incorrect usage: Enter 'help %s' for details", pCommandToken)
-                }
+        if (pInternalRecord != NULL)
+        {
+            status = CliParseParams(pInfo, &tokenizer, pInternalRecord->pParamList,
+                                    &pDispatchInfo->sArgs, silent);
+            if (strcmp(pInternalRecord->pName, "echo") == 0)
+            {
+                status = CliCmdEcho(pInfo, pDispatchTable, &pDispatchInfo->sArgs, numRecords);
             }
-            else
+            else if (strcmp(pInternalRecord->pName, "help") == 0)
+            {
+                status = CliHelp(pInfo, pDispatchTable, &pDispatchInfo->sArgs, numRecords);
+            }
+            else if (strcmp(pInternalRecord->pName, "binary") == 0)
+            {
+                status = CliCmdBinary(pInfo, pDispatchTable, &pDispatchInfo->sArgs, numRecords);
+            }
+#ifdef ENABLE_X86_BUILD
+            else if (strcmp(pInternalRecord->pName, "exit") == 0)
+            {
+                status = CliExit(pInfo, pDispatchTable, &pDispatchInfo->sArgs, numRecords);
+            }
+#endif
+        }
+        else if (pDispatchRecord != NULL)
+        {
+
+            /* Got a matching command record */
+            /* It's a good command, and not hidden (or we are in unlock
+             * mode anyway) parse parameters required for this command */
+            status = CliDispatch(pInfo, &tokenizer, pDispatchRecord, &pDispatchInfo->sArgs, silent);
+            if (status != 0)
             {
-                WARN_MSG("Command '%s' not found", pCommandToken)
+                CliPrintMessage(pInfo, "", "Incorrect usage: Enter 'help %s' for details",
+                                pDispatchRecord->pName);
             }
         }
+        else
+        {
+            CliPrintMessage(pInfo, "Warn : ", "Command '%s' not found", pCommandToken);
+        }
     }
     return status;
 }
 
-static int32_t CliScanParams(char *pPattern, Args *pArgs, int32_t argIndex, int32_t dataType)
+static void CliFindPrefix(CLI_PRIVATE *pInfo, const char *pPrefix, uint32_t prefixLen,
+                          const Command *pDispatchTable, int32_t numRecords, bool print,
+                          CLI_PREFIX_MATCH *pMatch)
+{
+    int32_t i;
+    int32_t first;
+    int32_t numFound;
+    uint32_t j;
+    int32_t numInternalDispatchRecords =
+        (int32_t)(sizeof(internalDispatchTable) / sizeof(InternalCommand));
+    const Command *pDispatchRecord;
+
+    memset(pMatch, 0, sizeof(*pMatch));
+    for (i = 0; i < numInternalDispatchRecords; i++)
+    {
+        for (j = 0; (j < prefixLen) && (tolower((unsigned char)internalDispatchTable[i].pName[j]) ==
+                                        tolower((unsigned char)pPrefix[j]));
+             j++)
+        {
+        }
+        if ((j == prefixLen) && !internalDispatchTable[i].hide)
+        {
+            CliAddPrefixMatch(pInfo, internalDispatchTable[i].pName, print, pMatch);
+            pMatch->pInternalRecord = &internalDispatchTable[i];
+        }
+    }
+
+    numFound = DispatchFindPrefix(&pInfo->cliDispatchData, pPrefix, prefixLen, pDispatchTable,
+                                  numRecords, &first);
+    for (i = first; i < first + numFound; i++)
+    {
+        pDispatchRecord = DispatchGetSortedRecord(&pInfo->cliDispatchData, i);
+        /* Records named as an internal command are shadowed by it */
+        for (j = 0; (j < (uint32_t)numInternalDispatchRecords) &&
+                    (strcmp(internalDispatchTable[j].pName, pDispatchRecord->pName) != 0);
+             j++)
+        {
+        }
+        if (!pDispatchRecord->hide && (j == (uint32_t)numInternalDispatchRecords))
+        {
+            CliAddPrefixMatch(pInfo, pDispatchRecord->pName, print, pMatch);
+            pMatch->pDispatchRecord = pDispatchRecord;
+        }
+    }
+}
+
+static void CliAddPrefixMatch(CLI_PRIVATE *pInfo, const char *pName, bool print,
+                              CLI_PREFIX_MATCH *pMatch)
+{
+    uint32_t i = 0;
+
+    if (pMatch->numMatches == 0)
+    {
+        pMatch->pName = pName;
+        pMatch->commonLength = (uint32_t)strlen(pName);
+    }
+    else
+    {
+        while ((i < pMatch->commonLength) &&
+               (tolower((unsigned char)pName[i]) == tolower((unsigned char)pMatch->pName[i])))
+        {
+            i++;
+        }
+        pMatch->commonLength = i;
+    }
+    pMatch->numMatches++;
+
+    if (print)
+    {
+        CliPutString(pInfo, pName);
+        CliPutString(pInfo, "  ");
+    }
+}
+
+static int32_t CliScanParams(CLI_PRIVATE *pInfo, CLI_TOKENIZER *pTokenizer, Args *pArgs,
+                             int32_t argIndex, int32_t dataType, bool silent)
 {
     int32_t status = 0;
     char *pParamToken = NULL;
-    pParamToken = strtok(NULL, pPattern);
+    const char *pExpected = "";
+
+    if (dataType == DATATYPE_STRING)
+    {
+        pParamToken = CliNextToken(pTokenizer, " \t", true);
+    }
+    else
+    {
+        pParamToken = CliNextToken(pTokenizer, " ,;\t", false);
+    }
 
     if (pParamToken != NULL)
     {
@@ -522,38 +761,37 @@ static int32_t CliScanParams(char *pPattern, Args *pArgs, int32_t argIndex, int3
             pArgs->v[argIndex].pS = pParamToken;
             break;
         case DATATYPE_FLOAT:
-            if (sscanf(pParamToken, "%lf", &pArgs->v[argIndex].f) != 1)
-            {
-                status = 1;
-            }
+            status = CliParseFixed(pParamToken, &pArgs->v[argIndex].f);
+            pExpected = "a number";
             break;
         case DATATYPE_INTEGER:
-            if (sscanf(pParamToken, "%li", &pArgs->v[argIndex].d) != 1)
-            {
-                status = 1;
-            }
+            status = CliParseInteger(pParamToken, &pArgs->v[argIndex].d);
+            pExpected = "an integer";
             break;
         case DATATYPE_CHAR:
-            if (sscanf(pParamToken, "%c", &pArgs->v[argIndex].c) != 1)
-            {
-                status = 1;
-            }
+            pArgs->v[argIndex].c = pParamToken[0];
             break;
         default:
             status = 1;
             break;
         }
 
-        if (status != 1)
+        if (status == 0)
         {
             pArgs->c++;
         }
+        else if (!silent)
+        {
+            CliPrintMessage(pInfo, "", "Invalid argument %ld '%s', expected %s",
+                            (long)(argIndex + 1), pParamToken, pExpected);
+        }
     }
 
     return status;
 }
 
-static int32_t CliParseParams(const char *pParamList, Args *pArgs, bool silent)
+static int32_t CliParseParams(CLI_PRIVATE *pInfo, CLI_TOKENIZER *pTokenizer, const char *pParamList,
+                              Args *pArgs, bool silent)
 {
     char *pParamToken;
     int32_t paramCount;
@@ -571,21 +809,21 @@ static int32_t CliParseParams(const char *pParamList, Args *pArgs, bool silent)
              * s,f,d,D,x,X. c,S,F are not used; Fix their support when needed */
             case 's':
             case 'S':
-                status = CliScanParams(" \"'", pArgs, i, DATATYPE_STRING);
+                status |= CliScanParams(pInfo, pTokenizer, pArgs, i, DATATYPE_STRING, silent);
                 break;
             case 'f':
             case 'F':
-                status = CliScanParams(" ,;\t", pArgs, i, DATATYPE_FLOAT);
+                status |= CliScanParams(pInfo, pTokenizer, pArgs, i, DATATYPE_FLOAT, silent);
                 break;
             case 'd':
             case 'x':
             case 'D':
             case 'X':
-                status = CliScanParams(" ,;\t", pArgs, i, DATATYPE_INTEGER);
+                status |= CliScanParams(pInfo, pTokenizer, pArgs, i, DATATYPE_INTEGER, silent);
                 break;
             case 'c':
             case 'C':
-                status = CliScanParams(" ,;\t", pArgs, i, DATATYPE_CHAR);
+                status |= CliScanParams(pInfo, pTokenizer, pArgs, i, DATATYPE_CHAR, silent);
                 break;
             default:
                 break;
@@ -595,19 +833,15 @@ static int32_t CliParseParams(const char *pParamList, Args *pArgs, bool silent)
     else
     {
         status = 1;
-    }
-
-    if (status != 0)
-    {
         if (!silent)
         {
-            INFO_MSG("Invalid Arguments")
+            CliPrintMessage(pInfo, "", "Invalid Arguments");
         }
     }
 
     while (1)
     {
-        pParamToken = strtok(NULL, " ,;\t");
+        pParamToken = CliNextToken(pTokenizer, " ,;\t", true);
         if (!pParamToken)
         {
             break;
@@ -615,12 +849,468 @@ static int32_t CliParseParams(const char *pParamList, Args *pArgs, bool silent)
 
         if (!silent)
         {
-            WARN_MSG("Extra parameter '%s' ignored", pParamToken)
+            CliPrintMessage(pInfo, "Warn : ", "Extra parameter '%s' ignored", pParamToken);
+        }
+    }
+    return status;
+}
+
+static char *CliNextToken(CLI_TOKENIZER *pTokenizer, const char *pDelimiters, bool allowQuotes)
+{
+    char *pChar = pTokenizer->pNext;
+    char *pToken = NULL;
+    char quote;
+
+    if (pChar != NULL)
+    {
+        while ((*pChar != '\0') && (strchr(pDelimiters, *pChar) != NULL))
+        {
+            pChar++;
+        }
+        if (*pChar != '\0')
+        {
+            if (allowQuotes && ((*pChar == '"') || (*pChar == '\'')))
+            {
+                quote = *pChar++;
+                pToken = pChar;
+                while ((*pChar != '\0') && (*pChar != quote))
+                {
+                    pChar++;
+                }
+            }
+            else
+            {
+                pToken = pChar;
+                while ((*pChar != '\0') && (strchr(pDelimiters, *pChar) == NULL))
+                {
+                    pChar++;
+                }
+            }
+            if (*pChar != '\0')
+            {
+                *pChar++ = '\0';
+            }
+        }
+        pTokenizer->pNext = pChar;
+    }
+
+    return pToken;
+}
+
+static int32_t CliParseInteger(const char *pToken, long *pValue)
+{
+    const char *pChar = pToken;
+    bool negative = false;
+    unsigned long base = 10;
+    unsigned long value = 0;
+    unsigned long digit;
+    int32_t numDigits = 0;
+    int32_t status = 0;
+
+    if ((*pChar == '+') || (*pChar == '-'))
+    {
+        negative = (*pChar == '-');
+        pChar++;
+    }
+    if ((pChar[0] == '0') && ((pChar[1] == 'x') || (pChar[1] == 'X')))
+    {
+        base = 16;
+        pChar += 2;
+    }
+    else if ((pChar[0] == '0') && (pChar[1] != '\0'))
+    {
+        base = 8;
+        pChar++;
+    }
+
+    for (; (*pChar != '\0') && (status == 0); pChar++)
+    {
+        if (isdigit((unsigned char)*pChar))
+        {
+            digit = (unsigned long)(*pChar - '0');
+        }
+        else if (isxdigit((unsigned char)*pChar))
+        {
+            digit = (unsigned long)(tolower((unsigned char)*pChar) - 'a' + 10);
+        }
+        else
+        {
+            digit = base;
+        }
+
+        if ((digit >= base) || (value > ((ULONG_MAX - digit) / base)))
+        {
+            status = 1;
+        }
+        else
+        {
+            value = (value * base) + digit;
+            numDigits++;
         }
     }
+
+    if ((numDigits == 0) ||
+        ((base == 10) && (value > ((unsigned long)LONG_MAX + (negative ? 1u : 0u)))))
+    {
+        status = 1;
+    }
+    if (status == 0)
+    {
+        *pValue = negative ? (long)(0ul - value) : (long)value;
+    }
+
     return status;
 }
 
+static int32_t CliParseFixed(const char *pToken, double *pValue)
+{
+    static const double powersOf10[] = {1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256};
+    const char *pChar = pToken;
+    bool negative = false;
+    bool expNegative = false;
+    uint64_t mantissa = 0;
+    int32_t exponent = 0;
+    int32_t expValue = 0;
+    int32_t numDigits = 0;
+    uint32_t absExponent;
+    double scale = 1.0;
+    double value;
+    uint32_t i;
+
+    if ((*pChar == '+') || (*pChar == '-'))
+    {
+        negative = (*pChar == '-');
+        pChar++;
+    }
+    for (; isdigit((unsigned char)*pChar); pChar++)
+    {
+        /* Digits beyond the precision of the mantissa only scale the value */
+        if (mantissa < 1000000000000000000ull)
+        {
+            mantissa = (mantissa * 10u) + (uint64_t)(*pChar - '0');
+        }
+        else
+        {
+            exponent++;
+        }
+        numDigits++;
+    }
+    if (*pChar == '.')
+    {
+        for (pChar++; isdigit((unsigned char)*pChar); pChar++)
+        {
+            if (mantissa < 1000000000000000000ull)
+            {
+                mantissa = (mantissa * 10u) + (uint64_t)(*pChar - '0');
+                exponent--;
+            }
+            numDigits++;
+        }
+    }
+    if (numDigits == 0)
+    {
+        return 1;
+    }
+    if ((*pChar == 'e') || (*pChar == 'E'))
+    {
+        pChar++;
+        if ((*pChar == '+') || (*pChar == '-'))
+        {
+            expNegative = (*pChar == '-');
+            pChar++;
+        }
+        if (!isdigit((unsigned char)*pChar))
+        {
+            return 1;
+        }
+        for (; isdigit((unsigned char)*pChar); pChar++)
+        {
+            if (expValue < 10000)
+            {
+                expValue = (expValue * 10) + (*pChar - '0');
+            }
+        }
+        exponent += expNegative ? -expValue : expValue;
+    }
+    if (*pChar != '\0')
+    {
+        return 1;
+    }
+
+    absExponent = (uint32_t)((exponent < 0) ? -exponent : exponent);
+    if (absExponent > 511u)
+    {
+        absExponent = 511u;
+    }
+    for (i = 0; absExponent != 0; i++, absExponent >>= 1)
+    {
+        if (absExponent & 1u)
+        {
+            scale *= powersOf10[i];
+        }
+    }
+    value = (double)mantissa;
+    value = (exponent < 0) ? (value / scale) : (value * scale);
+    *pValue = negative ? -value : value;
+
+    return 0;
+}
+
+int32_t CliGetBinaryFrame(CLI_PRIVATE *pInfo)
+{
+    int32_t status = 1;
+    CLI_BINARY_FRAME *pFrame = &pInfo->binaryFrame;
+    uint8_t *pBuffer = (uint8_t *)&pInfo->cliString[0];
+    volatile ADI_CIRC_BUF *pRxBuff = pInfo->cliData.pRxBuff;
+    uint32_t numBytesAvailable;
+    uint32_t numBytesToRead;
+    uint32_t payloadLength;
+    uint16_t expectedCrc;
+    uint16_t crc;
+
+    numBytesAvailable = (uint32_t)ADICircBufGetNumBytesAvailable(pRxBuff);
+    while ((status != 0) && (numBytesAvailable > 0))
+    {
+        if (pFrame->state == CLI_BINARY_STATE_SYNC)
+        {
+            if (CliGetChar(pInfo) == ADI_CLI_BINARY_SYNC)
+            {
+                pFrame->state = CLI_BINARY_STATE_LENGTH;
+                pFrame->numBytes = 0;
+                pFrame->frameLength = CLI_BINARY_LENGTH_NUM_BYTES;
+            }
+            numBytesAvailable--;
+            continue;
+        }
+
+        numBytesToRead = pFrame->frameLength - pFrame->numBytes;
+        if (numBytesToRead > numBytesAvailable)
+        {
+            numBytesToRead = numBytesAvailable;
+        }
+        ADICircBufReadBulk(pRxBuff, &pBuffer[pFrame->numBytes], numBytesToRead);
+        pFrame->numBytes += numBytesToRead;
+        numBytesAvailable -= numBytesToRead;
+
+        if (pFrame->numBytes == pFrame->frameLength)
+        {
+            if (pFrame->state == CLI_BINARY_STATE_LENGTH)
+            {
+                payloadLength = (uint32_t)pBuffer[0] | ((uint32_t)pBuffer[1] << 8);
+                pFrame->frameLength =
+                    CLI_BINARY_LENGTH_NUM_BYTES + payloadLength + CLI_BINARY_CRC_NUM_BYTES;
+                pFrame->state = CLI_BINARY_STATE_BODY;
+                /* A frame that does not fit the command line buffer cannot be valid, look
+                 * for the next sync byte */
+                if ((payloadLength == 0) || (pFrame->frameLength > APP_CFG_CLI_MAX_CMD_LENGTH))
+                {
+                    pFrame->state = CLI_BINARY_STATE_SYNC;
+                }
+            }
+            else
+            {
+                expectedCrc = (uint16_t)(pBuffer[pFrame->frameLength - 2] |
+                                         (pBuffer[pFrame->frameLength - 1] << 8));
+                crc = (uint16_t)pFrame->pfCalculateCrc(pBuffer, pFrame->frameLength -
+                                                                    CLI_BINARY_CRC_NUM_BYTES);
+                if (crc == expectedCrc)
+                {
+                    pFrame->isFramePending = true;
+                    status = 0;
+                }
+                else
+                {
+                    CliSendBinaryAnswer(pInfo, pBuffer[CLI_BINARY_LENGTH_NUM_BYTES],
+                                        ADI_CLI_BINARY_STATUS_CRC_ERROR);
+                }
+                pFrame->state = CLI_BINARY_STATE_SYNC;
+            }
+        }
+    }
+
+    return status;
+}
+
+int32_t CliDispatchBinary(CLI_PRIVATE *pInfo, const Command *pDispatchTable, int32_t numRecords)
+{
+    int32_t status = 1;
+    CLI_BINARY_FRAME *pFrame = &pInfo->binaryFrame;
+    uint8_t *pBuffer = (uint8_t *)&pInfo->cliString[0];
+    Args *pArgs = &pInfo->cliDispatchData.sArgs;
+    const Command *pDispatchRecord;
+    uint8_t binaryStatus = ADI_CLI_BINARY_STATUS_INVALID_COMMAND;
+    uint8_t cmdId;
+    uint32_t numArgBytes;
+
+    if (pFrame->isFramePending)
+    {
+        pFrame->isFramePending = false;
+        cmdId = pBuffer[CLI_BINARY_LENGTH_NUM_BYTES];
+        numArgBytes =
+            pFrame->frameLength - CLI_BINARY_LENGTH_NUM_BYTES - CLI_BINARY_CRC_NUM_BYTES - 1;
+        if (cmdId == ADI_CLI_BINARY_EXIT_ID)
+        {
+            pInfo->binaryMode = false;
+            pInfo->displayPrompt = true;
+            binaryStatus = ADI_CLI_BINARY_STATUS_SUCCESS;
+            status = 0;
+        }
+        else if ((pDispatchTable != NULL) && ((int32_t)cmdId < numRecords))
+        {
+            pDispatchRecord = &pDispatchTable[cmdId];
+            memset(pArgs, 0, sizeof(Args));
+            binaryStatus = ADI_CLI_BINARY_STATUS_INVALID_ARGUMENTS;
+            if (CliDecodeBinaryParams(&pBuffer[CLI_BINARY_LENGTH_NUM_BYTES + 1], numArgBytes,
+                                      pDispatchRecord->pParamList, pArgs) == 0)
+            {
+                status = pDispatchRecord->pfFunc(pArgs);
+                binaryStatus = (status == 0) ? ADI_CLI_BINARY_STATUS_SUCCESS
+                                             : ADI_CLI_BINARY_STATUS_COMMAND_FAILED;
+            }
+        }
+        if (status == CMD_IN_PROGRESS)
+        {
+            /* The frame is answered by CliResumeCommand once the command completes */
+            pInfo->pResumeRecord = pDispatchRecord;
+            pInfo->resumeCmdId = cmdId;
+            status = 0;
+        }
+        else
+        {
+            CliSendBinaryAnswer(pInfo, cmdId, binaryStatus);
+        }
+    }
+
+    return status;
+}
+
+int32_t CliResumeCommand(CLI_PRIVATE *pInfo)
+{
+    const Command *pDispatchRecord = pInfo->pResumeRecord;
+    int32_t status;
+
+    status = pDispatchRecord->pfFunc(&pInfo->cliDispatchData.sArgs);
+    if (status != CMD_IN_PROGRESS)
+    {
+        pInfo->pResumeRecord = NULL;
+        if (pInfo->binaryMode)
+        {
+            CliSendBinaryAnswer(pInfo, pInfo->resumeCmdId,
+                                (status == 0) ? ADI_CLI_BINARY_STATUS_SUCCESS
+                                              : ADI_CLI_BINARY_STATUS_COMMAND_FAILED);
+        }
+        else if (status != 0)
+        {
+            CliPrintMessage(pInfo, "", "Incorrect usage: Enter 'help %s' for details",
+                            pDispatchRecord->pName);
+        }
+    }
+
+    return status;
+}
+
+static int32_t CliDecodeBinaryParams(uint8_t *pData, uint32_t numBytes, const char *pParamList,
+                                     Args *pArgs)
+{
+    int32_t status = 0;
+    int32_t paramCount;
+    int32_t i;
+    uint32_t offset = 0;
+    uint32_t length;
+    uint32_t value;
+    float floatValue;
+
+    paramCount = (int32_t)StrnLen(pParamList, APP_CFG_CLI_MAX_PARAM_COUNT);
+    for (i = 0; (i < paramCount) && (offset < numBytes) && (status == 0); i++)
+    {
+        switch (pParamList[i])
+        {
+        case 's':
+        case 'S':
+            length = 0;
+            if ((numBytes - offset) >= 2)
+            {
+                length = (uint32_t)pData[offset] | ((uint32_t)pData[offset + 1] << 8);
+            }
+            if (((numBytes - offset) < 2) || (length > (numBytes - offset - 2)))
+            {
+                status = 1;
+            }
+            else
+            {
+                memmove(&pData[offset], &pData[offset + 2], length);
+                pData[offset + length] = '\0';
+                pArgs->v[i].pS = (char *)&pData[offset];
+                offset += length + 2;
+                pArgs->c++;
+            }
+            break;
+        case 'f':
+        case 'F':
+        case 'd':
+        case 'D':
+        case 'x':
+        case 'X':
+            if ((numBytes - offset) < 4)
+            {
+                status = 1;
+            }
+            else
+            {
+                value = (uint32_t)pData[offset] | ((uint32_t)pData[offset + 1] << 8) |
+                        ((uint32_t)pData[offset + 2] << 16) | ((uint32_t)pData[offset + 3] << 24);
+                if ((pParamList[i] == 'f') || (pParamList[i] == 'F'))
+                {
+                    memcpy(&floatValue, &value, sizeof(floatValue));
+                    pArgs->v[i].f = floatValue;
+                }
+                else if ((pParamList[i] == 'x') || (pParamList[i] == 'X'))
+                {
+                    pArgs->v[i].d = (long)value;
+                }
+                else
+                {
+                    pArgs->v[i].d = (long)(int32_t)value;
+                }
+                offset += 4;
+                pArgs->c++;
+            }
+            break;
+        case 'c':
+        case 'C':
+            pArgs->v[i].c = (char)pData[offset];
+            offset++;
+            pArgs->c++;
+            break;
+        default:
+            break;
+        }
+    }
+    if (offset != numBytes)
+    {
+        status = 1;
+    }
+
+    return status;
+}
+
+static int32_t CliSendBinaryAnswer(CLI_PRIVATE *pInfo, uint8_t cmdId, uint8_t status)
+{
+    uint8_t answer[1 + CLI_BINARY_LENGTH_NUM_BYTES + 2 + CLI_BINARY_CRC_NUM_BYTES];
+    uint16_t crc;
+
+    answer[0] = ADI_CLI_BINARY_SYNC;
+    answer[1] = 2;
+    answer[2] = 0;
+    answer[3] = cmdId;
+    answer[4] = status;
+    crc = (uint16_t)pInfo->binaryFrame.pfCalculateCrc(&answer[1], CLI_BINARY_LENGTH_NUM_BYTES + 2);
+    answer[5] = (uint8_t)crc;
+    answer[6] = (uint8_t)(crc >> 8);
+
+    return CliPutBuffer(pInfo, (const char *)answer, (int32_t)sizeof(answer));
+}
+
 static int32_t CliCommandHelp(CLI_PRIVATE *pInfo, const Command *pDispatchTable,
                               char *pCommandToken, int32_t numRecords)
 {
@@ -753,12 +1443,13 @@ int32_t CliHelp(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int32_
     else
     {
         status = CliGenericHelp(pCliInfo, pDispatchRecord, pArgs, numRecords, false);
-        INFO_MSG("\r\nCommand specific help is displayed with 'help <command>'")
+        CliPrintMessage(pCliInfo, "",
+                        "\r\nCommand specific help is displayed with 'help <command>'");
     }
 
     if (status != 0)
     {
-        WARN_MSG("Command '%s' not found", pArgs->v[0].pS)
+        CliPrintMessage(pCliInfo, "Warn : ", "Command '%s' not found", pArgs->v[0].pS);
     }
 
     return status;
@@ -771,7 +1462,8 @@ int32_t CliExpertHelp(void *pInfo, const Command *pDispatchRecord, Args *pArgs,
     if (pArgs->c == 0)
     {
         status = CliGenericHelp(pCliInfo, pDispatchRecord, pArgs, numRecords, true);
-        INFO_MSG("\r\nCommand specific help is displayed with 'help <command>'")
+        CliPrintMessage(pCliInfo, "",
+                        "\r\nCommand specific help is displayed with 'help <command>'");
     }
 
     return status;
@@ -789,7 +1481,7 @@ int32_t CliCmdEcho(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int
         {
 
             pCliInfo->echo = true;
-            INFO_MSG("echo on")
+            CliPrintMessage(pCliInfo, "", "echo on");
         }
         else if (strcmp(pArgs->v[0].pS, "off") == 0)
         {
@@ -802,28 +1494,52 @@ int32_t CliCmdEcho(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int
                     pCliInfo->displayCtrlChars = false;
                 }
             }
-            INFO_MSG("echo off")
+            CliPrintMessage(pCliInfo, "", "echo off");
         }
         else
         {
-            WARN_MSG("Invalid configuration choice. Usage: manual on/off")
+            CliPrintMessage(pCliInfo, "Warn : ",
+                            "Invalid configuration choice. Usage: manual on/off");
         }
     }
     else
     {
         if (pCliInfo->echo == true)
         {
-            INFO_MSG("echo on")
+            CliPrintMessage(pCliInfo, "", "echo on");
         }
         else
         {
-            INFO_MSG("echo off")
+            CliPrintMessage(pCliInfo, "", "echo off");
         }
     }
 
     return status;
 }
 
+int32_t CliCmdBinary(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int32_t numRecords)
+{
+    (void)pDispatchRecord; /* Dummy use of argument */
+    (void)pArgs;           /* Dummy use of argument */
+    (void)numRecords;      /* Dummy use of argument */
+    int32_t status = 0;
+    CLI_PRIVATE *pCliInfo = (CLI_PRIVATE *)pInfo;
+    if (pCliInfo->binaryFrame.pfCalculateCrc != NULL)
+    {
+        pCliInfo->binaryFrame.state = CLI_BINARY_STATE_SYNC;
+        pCliInfo->binaryFrame.isFramePending = false;
+        pCliInfo->binaryMode = true;
+        CliPrintMessage(pCliInfo, "", "binary on");
+    }
+    else
+    {
+        CliPrintMessage(pCliInfo, "Warn : ", "Binary frames are not supported");
+        status = 1;
+    }
+
+    return status;
+}
+
 #ifdef ENABLE_X86_BUILD
 int32_t CliExit(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int32_t numRecords)
 {
@@ -834,7 +1550,7 @@ int32_t CliExit(void *pInfo, const Command *pDispatchRecord, Args *pArgs, int32_
 
     if (pArgs->c > 0)
     {
-        WARN_MSG("Incorrect usage")
+        CliPrintMessage(pCliInfo, "Warn : ", "Incorrect usage");
     }
     else
     {
@@ -905,6 +1621,10 @@ static int32_t CliProcessInputChar(CLI_PRIVATE *pInfo, const char inputChar)
         case 0x0c:
             CliReset(pInfo);
             break;
+        /* ^I       complete command name */
+        case 0x09:
+            CliCompleteCommand(pInfo);
+            break;
         /* ^C break (probably not a command we want to keep for target
              application) */
         case 0x03:
@@ -920,6 +1640,78 @@ static int32_t CliProcessInputChar(CLI_PRIVATE *pInfo, const char inputChar)
     return status;
 }
 
+static void CliCompleteCommand(CLI_PRIVATE *pInfo)
+{
+    uint32_t i;
+    bool isAtEnd;
+    CLI_PREFIX_MATCH match;
+    EditLine *pEditLine = &pInfo->editLine;
+    CLI_DISPATCH_DATA *pDispatchInfo = &pInfo->cliDispatchData;
+    const Command *pDispatchTable = pDispatchInfo->pDispatchTable;
+    int32_t numRecords = pDispatchInfo->numDispatchRecords;
+    /* Characters inserted but not echoed yet are part of the name */
+    uint32_t prefixLen = pEditLine->indexCur + pEditLine->numCharsToPrint;
+
+    /* Only the command name is completed, and only from its end */
+    for (i = 0; (i < prefixLen) && (strchr(CLI_COMMAND_DELIMITERS, pEditLine->pBuffer[i]) == NULL);
+         i++)
+    {
+    }
+    isAtEnd = (prefixLen >= pEditLine->indexEnd) ||
+              (strchr(CLI_COMMAND_DELIMITERS, pEditLine->pBuffer[prefixLen]) != NULL);
+    /* The table of the configuration is completed even before the first dispatch */
+    if (pInfo->pCompleteTable != NULL)
+    {
+        pDispatchTable = pInfo->pCompleteTable;
+        numRecords = pInfo->numCompleteRecords;
+    }
+    match.numMatches = 0;
+    if ((i == prefixLen) && isAtEnd)
+    {
+        CliFindPrefix(pInfo, pEditLine->pBuffer, prefixLen, pDispatchTable, numRecords, false,
+                      &match);
+    }
+
+    if (match.numMatches == 0)
+    {
+        CliInsertControlChars(pInfo, CLI_CTRL_ALERT);
+    }
+    else if ((match.commonLength > prefixLen) || (match.numMatches == 1))
+    {
+        for (i = prefixLen; i < match.commonLength; i++)
+        {
+            CliInsertChar(pInfo, match.pName[i]);
+        }
+        if ((match.numMatches == 1) && (pEditLine->indexCur + pEditLine->numCharsToPrint ==
+                                        pEditLine->indexEnd))
+        {
+            CliInsertChar(pInfo, ' ');
+        }
+    }
+    else if (pInfo->echo)
+    {
+        /* Nothing to add, list the commands and show the edit line again */
+        CliInsertControlChars(pInfo, CLI_CTRL_NEWLINE);
+        CliFindPrefix(pInfo, pEditLine->pBuffer, prefixLen, pDispatchTable, numRecords, true,
+                      &match);
+        CliInsertControlChars(pInfo, CLI_CTRL_NEWLINE);
+        CliDisplayPrompt(pInfo);
+        snprintf(pInfo->pCliPrintString, APP_CFG_CLI_MAX_CMD_LENGTH, "%.*s",
+                 (int)pEditLine->indexEnd, pEditLine->pBuffer);
+        CliPutString(pInfo, pInfo->pCliPrintString);
+        pEditLine->indexCur = pEditLine->indexEnd;
+        pEditLine->numCharsToPrint = 0;
+        for (i = prefixLen; i < pEditLine->indexEnd; i++)
+        {
+            CliMoveCursorBackward(pInfo);
+        }
+    }
+    else
+    {
+        CliInsertControlChars(pInfo, CLI_CTRL_ALERT);
+    }
+}
+
 void CliReset(CLI_PRIVATE *pInfo)
 {
     CliEditLineReset(&pInfo->editLine);
@@ -1005,7 +1797,23 @@ static void CliInsertChar(CLI_PRIVATE *pInfo, const char inputChar)
     }
     /* Check if there are any more characters waiting to be echoed (e.g. when several characters are
      * buffered when copy-pasting) */
-    if (CliGetNumCharAvailable(pInfo) == 0 && echo)
+    if (CliGetNumCharAvailable(pInfo) == 0 && echo && pInfo->useInsertDelete &&
+        pInfo->displayCtrlChars)
+    {
+        if (pEditLine->indexCur + pEditLine->numCharsToPrint < APP_CFG_CLI_MAX_CMD_LENGTH)
+        {
+            /* Open a gap for the new characters, the terminal shifts the rest of the line */
+            if (pEditLine->indexCur + pEditLine->numCharsToPrint < pEditLine->indexEnd)
+            {
+                CliInsertEditControlChars(pInfo, CLI_CTRL_INSERT, pEditLine->numCharsToPrint);
+            }
+            CliPutBuffer(pInfo, &pEditLine->pBuffer[pEditLine->indexCur],
+                         (int32_t)pEditLine->numCharsToPrint);
+            pEditLine->indexCur = pEditLine->indexCur + pEditLine->numCharsToPrint;
+        }
+        pEditLine->numCharsToPrint = 0;
+    }
+    else if (CliGetNumCharAvailable(pInfo) == 0 && echo)
     {
         /* Print inputChar and all buffered characters */
         if (pEditLine->indexCur + pEditLine->numCharsToPrint < APP_CFG_CLI_MAX_CMD_LENGTH)
@@ -1084,20 +1892,27 @@ void CliDeleteCharAtCursor(CLI_PRIVATE *pInfo)
     if (pEditLine->indexCur > 0)
     {
         pEditLine->indexCur--;
-        CliInsertControlChars(pInfo, CLI_CTRL_PREV);
-        CliInsertControlChars(pInfo, CLI_CTRL_SAVE);
         for (i = pEditLine->indexCur; i < pEditLine->indexEnd - 1; i++)
         {
             pEditLine->pBuffer[i] = pEditLine->pBuffer[i + 1];
-            if (echo == true)
-            {
-                /* Echoed  for all commands in both host/cli mode */
-                CliPutChar(pInfo, pEditLine->pBuffer[i]);
-            }
         }
-        CliPutChar(pInfo, ' ');
-        CliInsertControlChars(pInfo, CLI_CTRL_RESTORE);
         pEditLine->indexEnd--;
+
+        CliInsertControlChars(pInfo, CLI_CTRL_PREV);
+        if ((echo == true) && pInfo->useInsertDelete && pInfo->displayCtrlChars)
+        {
+            /* The terminal shifts the rest of the line left */
+            CliInsertEditControlChars(pInfo, CLI_CTRL_DELETE, 1);
+        }
+        else if (echo == true)
+        {
+            /* Echoed  for all commands in both host/cli mode */
+            CliInsertControlChars(pInfo, CLI_CTRL_SAVE);
+            CliPutBuffer(pInfo, &pEditLine->pBuffer[pEditLine->indexCur],
+                         (int32_t)(pEditLine->indexEnd - pEditLine->indexCur));
+            CliPutChar(pInfo, ' ');
+            CliInsertControlChars(pInfo, CLI_CTRL_RESTORE);
+        }
     }
 }
 
@@ -1139,7 +1954,8 @@ static int32_t CliInsertControlChars(CLI_PRIVATE *pInfo, int32_t ctrlFuncID)
 int32_t CliPutChar(CLI_PRIVATE *pInfo, char inputchar)
 {
     int32_t status = 0;
-    if ((pInfo->bufferInfo.bytesStored + 1) < ADI_CLI_MAX_SIZE)
+    ADI_RTOS_LOCK(pInfo->txLock);
+    if ((pInfo->bufferInfo.bytesStored + 1) < pInfo->bufferInfo.bufferSize)
     {
         memcpy(&pInfo->bufferInfo.pBufferToWrite[pInfo->bufferInfo.bytesStored], &inputchar, 1);
         pInfo->bufferInfo.bytesStored += 1;
@@ -1148,6 +1964,7 @@ int32_t CliPutChar(CLI_PRIVATE *pInfo, char inputchar)
     {
         status = -1;
     }
+    ADI_RTOS_UNLOCK(pInfo->txLock);
     return status;
 }
 
@@ -1155,7 +1972,8 @@ int32_t CliPutString(CLI_PRIVATE *pInfo, const char *pString)
 {
     int32_t status = 0;
     uint16_t length = strlen(pString);
-    if ((pInfo->bufferInfo.bytesStored + length) < ADI_CLI_MAX_SIZE)
+    ADI_RTOS_LOCK(pInfo->txLock);
+    if ((pInfo->bufferInfo.bytesStored + length) < pInfo->bufferInfo.bufferSize)
     {
         memcpy(&pInfo->bufferInfo.pBufferToWrite[pInfo->bufferInfo.bytesStored], pString, length);
         pInfo->bufferInfo.bytesStored += length;
@@ -1164,6 +1982,60 @@ int32_t CliPutString(CLI_PRIVATE *pInfo, const char *pString)
     {
         status = -1;
     }
+    ADI_RTOS_UNLOCK(pInfo->txLock);
+    return status;
+}
+
+int32_t CliVPrintMessage(CLI_PRIVATE *pInfo, const char *pMsgType, const char *pFormat,
+                         va_list pArgs)
+{
+    int32_t status = 1;
+    BufferInfo *pBufferInfo = &pInfo->bufferInfo;
+    char *pDst;
+    uint32_t space;
+    uint32_t prefixLength = 0;
+    uint32_t suffixLength = 0;
+    int32_t msgLength;
+
+    ADI_RTOS_LOCK(pInfo->txLock);
+    pDst = (char *)&pBufferInfo->pBufferToWrite[pBufferInfo->bytesStored];
+    /* One byte is kept free for the terminating null written by vsnprintf */
+    space = pBufferInfo->bufferSize - pBufferInfo->bytesStored - 1;
+    if ((pBufferInfo->bytesStored < pBufferInfo->bufferSize) && (pDst != NULL))
+    {
+        if ((strcmp(pMsgType, "RAW") != 0) && (strcmp(pMsgType, "DBGRAW") != 0))
+        {
+            prefixLength = (uint32_t)strlen(pMsgType);
+            suffixLength = 2;
+        }
+        if ((prefixLength + suffixLength) <= space)
+        {
+            memcpy(pDst, pMsgType, prefixLength);
+            msgLength = vsnprintf(&pDst[prefixLength], space - prefixLength + 1, pFormat, pArgs);
+            /* The message is committed only if it fits completely */
+            if ((msgLength >= 0) &&
+                ((uint32_t)msgLength <= (space - prefixLength - suffixLength)))
+            {
+                memcpy(&pDst[prefixLength + (uint32_t)msgLength], "\n\r", suffixLength);
+                pBufferInfo->bytesStored += prefixLength + (uint32_t)msgLength + suffixLength;
+                status = 0;
+            }
+        }
+    }
+    ADI_RTOS_UNLOCK(pInfo->txLock);
+
+    return status;
+}
+
+__attribute__((__format__(__printf__, 3, 0))) int32_t CliPrintMessage(CLI_PRIVATE *pInfo,
+                                                                      const char *pMsgType,
+                                                                      const char *pFormat, ...)
+{
+    int32_t status;
+    va_list pArgs;
+    va_start(pArgs, pFormat);
+    status = CliVPrintMessage(pInfo, pMsgType, pFormat, pArgs);
+    va_end(pArgs);
     return status;
 }
 
@@ -1173,7 +2045,8 @@ int32_t CliPutBuffer(CLI_PRIVATE *pInfo, const char *pBuffer, int32_t length)
     uint16_t readIndex = 0;
     uint32_t numBytesToSend = 0;
     uint16_t index = 0;
-    if ((pInfo->bufferInfo.bytesStored + length) < ADI_CLI_MAX_SIZE)
+    ADI_RTOS_LOCK(pInfo->txLock);
+    if ((pInfo->bufferInfo.bytesStored + length) < pInfo->bufferInfo.bufferSize)
     {
         while (index < length)
         {
@@ -1190,13 +2063,14 @@ int32_t CliPutBuffer(CLI_PRIVATE *pInfo, const char *pBuffer, int32_t length)
             memcpy(&pInfo->bufferInfo.pBufferToWrite[pInfo->bufferInfo.bytesStored],
                    (uint8_t *)&pBuffer[readIndex], numBytesToSend);
             pInfo->bufferInfo.bytesStored += numBytesToSend;
-            readIndex += index;
+            readIndex += numBytesToSend;
         }
     }
     else
     {
         status = -1;
     }
+    ADI_RTOS_UNLOCK(pInfo->txLock);
     return status;
 }
 
@@ -1258,6 +2132,22 @@ static int32_t CliInsertManualControlChars(CLI_PRIVATE *pInfo, int32_t ctrlFuncI
     return status;
 }
 
+static int32_t CliInsertEditControlChars(CLI_PRIVATE *pInfo, int32_t ctrlFuncID,
+                                         uint32_t numChars)
+{
+    int32_t status = 0;
+    char sequence[16];
+    volatile bool echo = pInfo->echo;
+    if ((pInfo->displayCtrlChars == true) && (echo == true) && (numChars > 0))
+    {
+        /* ICH and DCH take the number of characters, so an edit is one sequence */
+        snprintf(sequence, sizeof(sequence), "\x1B[%u%c", (unsigned int)numChars,
+                 (ctrlFuncID == CLI_CTRL_INSERT) ? '@' : 'P');
+        status = CliPutString(pInfo, sequence);
+    }
+    return status;
+}
+
 static int32_t CliPutStringBold(CLI_PRIVATE *pInfo, const char *pString)
 {
     int32_t status = 0;
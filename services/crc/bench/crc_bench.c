@@ -0,0 +1,409 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     crc_bench.c
+ * @brief    Benchmark of the CRC engines over payloads from 2 bytes to 64 KB.
+ *
+ * Every engine of the software CRC, and the CCITT16 functions, is run for common
+ * configurations. Each result is cross-checked against a bitwise reference independent of the
+ * service and against the published check value of "123456789". The time per byte is reported
+ * in cycles of the DWT cycle counter on target and of the time stamp counter on an x86 host
+ * (ENABLE_X86_BUILD). The program returns non-zero if any result does not match.
+ *
+ * The software CRC is built either with look up tables or without (CRC_BENCH_NOLUT), so each
+ * variant is a separate executable. The hardware backend needs the board functions of the
+ * application and is not part of the benchmark.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+#include "adi_crc.h"
+#include "adi_crc_ccitt16.h"
+#include "adi_crc_sw.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef ENABLE_X86_BUILD
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+#endif
+
+/*============= D E F I N E S =============*/
+
+/** Largest payload in bytes */
+#ifndef CRC_BENCH_MAX_NUM_BYTES
+#define CRC_BENCH_MAX_NUM_BYTES 65536u
+#endif
+
+/** Number of bytes processed for each measurement, by repeating smaller payloads */
+#ifndef CRC_BENCH_NUM_BYTES_PER_POINT
+#ifdef ENABLE_X86_BUILD
+#define CRC_BENCH_NUM_BYTES_PER_POINT (4u * 1024u * 1024u)
+#else
+#define CRC_BENCH_NUM_BYTES_PER_POINT (256u * 1024u)
+#endif
+#endif
+
+/** State memory of the CRC instance. Engines needing larger tables are skipped. */
+#ifndef CRC_BENCH_STATE_MEM_NUM_BYTES
+#ifdef ENABLE_X86_BUILD
+#define CRC_BENCH_STATE_MEM_NUM_BYTES ADI_CRC32_SW_LUT16_STATE_MEM_NUM_BYTES
+#else
+#define CRC_BENCH_STATE_MEM_NUM_BYTES ADI_CRC32_SW_SLICE8_STATE_MEM_NUM_BYTES
+#endif
+#endif
+
+#ifndef ENABLE_X86_BUILD
+/** Debug exception and monitor control register */
+#define CRC_BENCH_DEMCR (*(volatile uint32_t *)0xE000EDFCu)
+/** Trace enable bit of DEMCR */
+#define CRC_BENCH_DEMCR_TRCENA (1u << 24)
+/** DWT control register */
+#define CRC_BENCH_DWT_CTRL (*(volatile uint32_t *)0xE0001000u)
+/** Cycle counter enable bit of DWT_CTRL */
+#define CRC_BENCH_DWT_CTRL_CYCCNTENA (1u << 0)
+/** DWT cycle counter */
+#define CRC_BENCH_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004u)
+#endif
+
+/*============= D A T A  T Y P E S =============*/
+
+/**
+ * Configuration benchmarked, with its published check value.
+ */
+typedef struct
+{
+    /** Name of the configuration */
+    const char *pName;
+    /** CRC type */
+    ADI_CRC_TYPE crcType;
+    /** Width in bits */
+    uint32_t numBits;
+    /** Polynomial in normal form */
+    uint32_t poly;
+    /** Seed */
+    uint32_t seed;
+    /** Final XOR value */
+    uint32_t xorOut;
+    /** Reflected input and output */
+    bool reversed;
+    /** CRC of "123456789" */
+    uint32_t check;
+} CRC_BENCH_CONFIG;
+
+/**
+ * Software engine benchmarked.
+ */
+typedef struct
+{
+    /** Name of the engine */
+    const char *pName;
+    /** Engine */
+    ADI_CRC_ENGINE engine;
+} CRC_BENCH_ENGINE;
+
+/*============= D A T A =============*/
+
+/** Configurations */
+static const CRC_BENCH_CONFIG benchConfigs[] = {
+    {"CRC-8/SMBUS", ADI_CRC_TYPE_CRC8, 8u, 0x07u, 0x00u, 0x00u, false, 0xF4u},
+    {"CRC-16/CCITT-FALSE", ADI_CRC_TYPE_CRC16, 16u, 0x1021u, 0xFFFFu, 0x0000u, false, 0x29B1u},
+    {"CRC-16/KERMIT", ADI_CRC_TYPE_CRC16, 16u, 0x1021u, 0x0000u, 0x0000u, true, 0x2189u},
+    {"CRC-32", ADI_CRC_TYPE_CRC32, 32u, 0x04C11DB7u, 0xFFFFFFFFu, 0xFFFFFFFFu, true, 0xCBF43926u},
+    {"CRC-32/MPEG-2", ADI_CRC_TYPE_CRC32, 32u, 0x04C11DB7u, 0xFFFFFFFFu, 0x0u, false,
+     0x0376E6E7u},
+};
+
+/** Engines */
+#ifdef CRC_BENCH_NOLUT
+static const CRC_BENCH_ENGINE benchEngines[] = {{"NOLUT", ADI_CRC_ENGINE_LUT8}};
+#else
+static const CRC_BENCH_ENGINE benchEngines[] = {{"LUT8", ADI_CRC_ENGINE_LUT8},
+                                                {"SLICE4", ADI_CRC_ENGINE_SLICE4},
+                                                {"SLICE8", ADI_CRC_ENGINE_SLICE8},
+                                                {"LUT16", ADI_CRC_ENGINE_LUT16}};
+#endif
+
+/** Payload sizes in bytes */
+static const uint32_t benchSizes[] = {2u, 16u, 64u, 256u, 1024u, 4096u, 16384u, 65536u};
+
+/** Check string of the CRC catalogues */
+static const uint8_t checkString[] = "123456789";
+
+/** Payload */
+static uint8_t benchData[CRC_BENCH_MAX_NUM_BYTES];
+
+/** State memory of the CRC instance */
+static uint32_t stateMemory[(CRC_BENCH_STATE_MEM_NUM_BYTES + 3u) / 4u];
+
+/*============= F U N C T I O N S =============*/
+
+/**
+ * @brief Function to start the cycle counter.
+ */
+static void BenchTimerInit(void);
+
+/**
+ * @brief Function to read the cycle counter.
+ * @return - Returns the count
+ */
+static uint64_t BenchTimerRead(void);
+
+/**
+ * @brief Function to calculate a CRC one bit at a time, without the service.
+ * @param pConfig       - Pointer to the configuration.
+ * @param pBuff         - Pointer to the data.
+ * @param numBytes      - Number of bytes.
+ * @return - Returns the CRC
+ */
+static uint32_t BenchReference(const CRC_BENCH_CONFIG *pConfig, const uint8_t *pBuff,
+                               uint32_t numBytes);
+
+/**
+ * @brief Function to calculate a CRC with the service as one stream.
+ * @param hCrc          - Handle to CRC instance.
+ * @param pBuff         - Pointer to the data.
+ * @param numBytes      - Number of bytes.
+ * @param pCrc          - Pointer to the CRC.
+ * @return - Returns the status of the service
+ */
+static ADI_CRC_RESULT BenchCalculate(ADI_CRC_HANDLE hCrc, const uint8_t *pBuff, uint32_t numBytes,
+                                     uint32_t *pCrc);
+
+/**
+ * @brief Function to benchmark and check one engine for one configuration.
+ * @param hCrc          - Handle to CRC instance, NULL for the CCITT16 functions.
+ * @param pEngineName   - Name of the engine.
+ * @param pConfig       - Pointer to the configuration.
+ * @return - Returns the number of mismatches
+ */
+static uint32_t BenchRun(ADI_CRC_HANDLE hCrc, const char *pEngineName,
+                         const CRC_BENCH_CONFIG *pConfig);
+
+/*=============  C O D E  =============*/
+
+int main(void)
+{
+    ADI_CRC_HANDLE hCrc = NULL;
+    ADI_CRC_CONFIG crcConfig = {0};
+    ADI_CRC_RESULT status;
+    uint32_t numErrors = 0;
+    uint32_t seed = 0x12345678u;
+    uint32_t i;
+    uint32_t j;
+
+    BenchTimerInit();
+    for (i = 0; i < CRC_BENCH_MAX_NUM_BYTES; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        benchData[i] = (uint8_t)(seed >> 24);
+    }
+
+    if (adi_crc_OpenSw(&hCrc, stateMemory, sizeof(stateMemory)) != ADI_CRC_RESULT_SUCCESS)
+    {
+        printf("crc_bench: adi_crc_OpenSw failed\n");
+        return 1;
+    }
+
+    printf("%-8s %-20s %8s %12s\n", "engine", "config", "bytes", "cycles/byte");
+    for (i = 0; i < sizeof(benchConfigs) / sizeof(benchConfigs[0]); i++)
+    {
+        for (j = 0; j < sizeof(benchEngines) / sizeof(benchEngines[0]); j++)
+        {
+            crcConfig.crcType = benchConfigs[i].crcType;
+            crcConfig.poly = benchConfigs[i].poly;
+            crcConfig.seed = benchConfigs[i].seed;
+            crcConfig.xorOut = benchConfigs[i].xorOut;
+            crcConfig.reversed = benchConfigs[i].reversed;
+            crcConfig.engine = benchEngines[j].engine;
+            status = adi_crc_SetConfig(hCrc, &crcConfig);
+            if (status == ADI_CRC_RESULT_INSUFFICIENT_MEMORY)
+            {
+                printf("%-8s %-20s skipped, needs more state memory\n", benchEngines[j].pName,
+                       benchConfigs[i].pName);
+            }
+            else if (status != ADI_CRC_RESULT_SUCCESS)
+            {
+                printf("%-8s %-20s adi_crc_SetConfig failed\n", benchEngines[j].pName,
+                       benchConfigs[i].pName);
+                numErrors++;
+            }
+            else
+            {
+                numErrors += BenchRun(hCrc, benchEngines[j].pName, &benchConfigs[i]);
+            }
+        }
+    }
+    /* CRC-16/CCITT-FALSE is the configuration of the CCITT16 functions */
+    numErrors += BenchRun(NULL, "CCITT16", &benchConfigs[1]);
+
+    printf("crc_bench: %s, %u mismatches\n", (numErrors == 0) ? "PASS" : "FAIL",
+           (unsigned)numErrors);
+    return (numErrors == 0) ? 0 : 1;
+}
+
+static uint32_t BenchRun(ADI_CRC_HANDLE hCrc, const char *pEngineName,
+                         const CRC_BENCH_CONFIG *pConfig)
+{
+    uint32_t numErrors = 0;
+    uint32_t crc = 0;
+    uint32_t numBytes;
+    uint32_t numRepeats;
+    uint32_t i;
+    uint32_t k;
+    uint64_t start;
+    uint64_t numCycles;
+
+    if (hCrc == NULL)
+    {
+        crc = adi_crc_CalculateCCITT16((uint8_t *)checkString, sizeof(checkString) - 1u);
+    }
+    else if (BenchCalculate(hCrc, checkString, sizeof(checkString) - 1u, &crc) !=
+             ADI_CRC_RESULT_SUCCESS)
+    {
+        crc = ~pConfig->check;
+    }
+    if (crc != pConfig->check)
+    {
+        printf("%-8s %-20s check 0x%08X, expected 0x%08X\n", pEngineName, pConfig->pName,
+               (unsigned)crc, (unsigned)pConfig->check);
+        numErrors++;
+    }
+
+    for (i = 0; i < sizeof(benchSizes) / sizeof(benchSizes[0]); i++)
+    {
+        numBytes = benchSizes[i];
+        if (numBytes > CRC_BENCH_MAX_NUM_BYTES)
+        {
+            break;
+        }
+        numRepeats = CRC_BENCH_NUM_BYTES_PER_POINT / numBytes;
+        if (numRepeats == 0)
+        {
+            numRepeats = 1;
+        }
+
+        start = BenchTimerRead();
+        for (k = 0; k < numRepeats; k++)
+        {
+            if (hCrc == NULL)
+            {
+                crc = adi_crc_CalculateCCITT16(benchData, numBytes);
+            }
+            else
+            {
+                (void)BenchCalculate(hCrc, benchData, numBytes, &crc);
+            }
+        }
+        numCycles = BenchTimerRead() - start;
+
+        if (crc != BenchReference(pConfig, benchData, numBytes))
+        {
+            printf("%-8s %-20s %8u mismatch\n", pEngineName, pConfig->pName, (unsigned)numBytes);
+            numErrors++;
+        }
+        else
+        {
+            printf("%-8s %-20s %8u %12.2f\n", pEngineName, pConfig->pName, (unsigned)numBytes,
+                   (double)numCycles / ((double)numRepeats * (double)numBytes));
+        }
+    }
+
+    return numErrors;
+}
+
+static ADI_CRC_RESULT BenchCalculate(ADI_CRC_HANDLE hCrc, const uint8_t *pBuff, uint32_t numBytes,
+                                     uint32_t *pCrc)
+{
+    /* Streaming takes 32-bit lengths, adi_crc_Calculate() stops below 64 KB */
+    ADI_CRC_RESULT status = adi_crc_Update(hCrc, pBuff, numBytes);
+    if (status == ADI_CRC_RESULT_SUCCESS)
+    {
+        status = adi_crc_Finalize(hCrc, pCrc);
+    }
+    return status;
+}
+
+static uint32_t BenchReference(const CRC_BENCH_CONFIG *pConfig, const uint8_t *pBuff,
+                               uint32_t numBytes)
+{
+    uint32_t mask = 0xFFFFFFFFu >> (32u - pConfig->numBits);
+    uint32_t crc = pConfig->seed & mask;
+    uint32_t reflected = 0;
+    uint32_t bit;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        for (j = 0; j < 8u; j++)
+        {
+            bit = pConfig->reversed ? ((pBuff[i] >> j) & 1u) : ((pBuff[i] >> (7u - j)) & 1u);
+            bit ^= (crc >> (pConfig->numBits - 1u)) & 1u;
+            crc = (crc << 1) & mask;
+            if (bit != 0)
+            {
+                crc ^= pConfig->poly & mask;
+            }
+        }
+    }
+    if (pConfig->reversed)
+    {
+        for (j = 0; j < pConfig->numBits; j++)
+        {
+            reflected |= ((crc >> j) & 1u) << (pConfig->numBits - 1u - j);
+        }
+        crc = reflected;
+    }
+
+    return (crc ^ pConfig->xorOut) & mask;
+}
+
+#ifdef ENABLE_X86_BUILD
+static void BenchTimerInit(void)
+{
+}
+
+static uint64_t BenchTimerRead(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+#endif
+}
+#else
+static void BenchTimerInit(void)
+{
+    CRC_BENCH_DEMCR |= CRC_BENCH_DEMCR_TRCENA;
+    CRC_BENCH_DWT_CYCCNT = 0;
+    CRC_BENCH_DWT_CTRL |= CRC_BENCH_DWT_CTRL_CYCCNTENA;
+}
+
+static uint64_t BenchTimerRead(void)
+{
+    static uint32_t lastCount;
+    static uint64_t numWraps;
+    uint32_t count = CRC_BENCH_DWT_CYCCNT;
+
+    /* The 32-bit counter wraps within seconds, extend it between reads */
+    if (count < lastCount)
+    {
+        numWraps++;
+    }
+    lastCount = count;
+    return (numWraps << 32) | count;
+}
+#endif
+
+/**
+ * @}
+ */
@@ -14,10 +14,24 @@
  *
  * Typical API usage:
  * 1. **Create the CRC Instance**: Call adi_crc_OpenSw() or adi_crc_OpenHw() depending on whether
- * software or hardware CRC is required.
+ * software or hardware CRC is required. For hardware CRC, populate an #ADI_CRC_HW_CONFIG with the
+ * functions driving the CRC unit of the board.
  * 2. **Configure the NVM**: Populate an ADI_CRC_CONFIG structure with the required function
  * pointers.
  * 3. Use the provided APIs to calculate the CRC.
+ *
+ * ## Streaming
+ * Data arriving in chunks is checksummed with adi_crc_Update(), called once per chunk, followed by
+ * adi_crc_Finalize(). The first adi_crc_Update() after adi_crc_Finalize(), adi_crc_Reset() or
+ * adi_crc_SetConfig() starts from the seed. The partial CRC is held in the instance, so chunks
+ * of different streams must not be interleaved on the same handle, and adi_crc_Calculate()
+ * discards a stream in progress.
+ *
+ * ## Constant Tables
+ * With #ADI_CRC_ENGINE_LUT8 the software CRC uses a constant table in flash instead of building
+ * one in the state memory for these configurations: CRC-8 poly 0x07, CRC-16 poly 0x1021,
+ * reflected CRC-16 poly 0x8005 and CRC-32 poly 0x04C11DB7, normal or reflected. They only need
+ * #ADI_CRC_SW_CONST_TABLE_STATE_MEM_NUM_BYTES of state memory.
  * @{
  */
 
@@ -80,12 +94,44 @@ typedef enum
  * @brief Look up table buffer size.
  */
 #define LOOK_UP_TABLE_SIZE 256
+/**
+ * @brief Number of entries of the 16-bit indexed look up table.
+ */
+#define LOOK_UP_TABLE_16BIT_SIZE 65536u
 /** State memory required in bytes for the library. Allocate a buffer aligned to
  * 32 bit boundary */
 #define ADI_CRC_HW_STATE_MEM_NUM_BYTES sizeof(ADI_CRC_DATA)
-/** State memory required in bytes for the library. Allocate a buffer aligned to
- *  32 bit boundary */
+/** State memory required in bytes for the library built with adi_crc_nolut.c. Allocate a buffer
+ * aligned to 32 bit boundary */
+#define ADI_CRC_SW_NOLUT_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + 16 * 4)
+/** State memory required in bytes for the library with #ADI_CRC_ENGINE_LUT8 and a polynomial
+ * that has a constant table. Allocate a buffer aligned to 32 bit boundary */
+#define ADI_CRC_SW_CONST_TABLE_STATE_MEM_NUM_BYTES sizeof(ADI_CRC_DATA)
+/** State memory required in bytes for the library with #ADI_CRC_ENGINE_LUT8. Allocate a buffer
+ * aligned to 32 bit boundary */
 #define ADI_CRC_SW_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + LOOK_UP_TABLE_SIZE * 2)
+/** State memory required in bytes for the library with #ADI_CRC_ENGINE_SLICE4. Allocate a
+ * buffer aligned to 32 bit boundary */
+#define ADI_CRC_SW_SLICE4_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + 4 * LOOK_UP_TABLE_SIZE * 2)
+/** State memory required in bytes for the library with #ADI_CRC_ENGINE_SLICE8. Allocate a
+ * buffer aligned to 32 bit boundary */
+#define ADI_CRC_SW_SLICE8_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + 8 * LOOK_UP_TABLE_SIZE * 2)
+/** State memory required in bytes for the library with #ADI_CRC_ENGINE_LUT16. Allocate a
+ * buffer aligned to 32 bit boundary */
+#define ADI_CRC_SW_LUT16_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + LOOK_UP_TABLE_16BIT_SIZE * 2)
+/** State memory required in bytes for CRC-32 with #ADI_CRC_ENGINE_LUT8. Allocate a buffer
+ * aligned to 32 bit boundary */
+#define ADI_CRC32_SW_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + LOOK_UP_TABLE_SIZE * 4)
+/** State memory required in bytes for CRC-32 with #ADI_CRC_ENGINE_SLICE4. Allocate a buffer
+ * aligned to 32 bit boundary */
+#define ADI_CRC32_SW_SLICE4_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + 4 * LOOK_UP_TABLE_SIZE * 4)
+/** State memory required in bytes for CRC-32 with #ADI_CRC_ENGINE_SLICE8. Allocate a buffer
+ * aligned to 32 bit boundary */
+#define ADI_CRC32_SW_SLICE8_STATE_MEM_NUM_BYTES (sizeof(ADI_CRC_DATA) + 8 * LOOK_UP_TABLE_SIZE * 4)
+/** State memory required in bytes for CRC-32 with #ADI_CRC_ENGINE_LUT16. Allocate a buffer
+ * aligned to 32 bit boundary */
+#define ADI_CRC32_SW_LUT16_STATE_MEM_NUM_BYTES                                                     \
+    (sizeof(ADI_CRC_DATA) + LOOK_UP_TABLE_16BIT_SIZE * 4)
 
 /** A device handle used in all API functions to identify the instance.
  *  It is obtained from the open API. */
@@ -107,6 +153,22 @@ typedef enum
 
 } ADI_CRC_TYPE;
 
+/**
+ * Enums of software CRC engines. Faster engines need more state memory for look up tables.
+ */
+typedef enum
+{
+    /** One 256 entry table, one byte per lookup. */
+    ADI_CRC_ENGINE_LUT8 = 0u,
+    /** Slicing-by-4, four 256 entry tables, four independent lookups per 4 bytes. */
+    ADI_CRC_ENGINE_SLICE4,
+    /** Slicing-by-8, eight 256 entry tables, eight independent lookups per 8 bytes. */
+    ADI_CRC_ENGINE_SLICE8,
+    /** One 65536 entry table indexed by 16 bits, two bytes per lookup. */
+    ADI_CRC_ENGINE_LUT16,
+
+} ADI_CRC_ENGINE;
+
 /**
  * Function pointer to CRC implementation.
  */
@@ -118,9 +180,11 @@ typedef uint32_t (*ADI_CRC_FUNC)(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t n
  */
 typedef struct
 {
-    /** Byte Swap CRC Data Input. */
+    /** Reflected CRC. Data bits are processed LSB first and the CRC is reflected, for example
+     * CRC-32/IEEE 802.3. poly and seed are given in normal (MSB first) form. */
     bool reversed;
-    /** Most Significant Bit Order. */
+    /** Byte swap the final CRC, for protocols that store the CRC in the opposite byte order.
+     * No effect for CRC-8. */
     bool bigEndian;
     /** Seed for CRC. */
     uint32_t seed;
@@ -134,6 +198,8 @@ typedef struct
     ADI_CRC_CALLBACK_FUNC pfCallback;
     /** data returned in callback function */
     void *pCBData;
+    /** Software CRC engine. */
+    ADI_CRC_ENGINE engine;
 } ADI_CRC_CONFIG;
 
 /** CRC Calculation function */
@@ -148,6 +214,40 @@ typedef ADI_CRC_RESULT (*ADI_CRC_CONFIG_FUNC)(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFI
 typedef ADI_CRC_RESULT (*ADI_CRC_CLOSE_FUNC)(ADI_CRC_HANDLE hCrc);
 /** CRC config close function */
 typedef ADI_CRC_RESULT (*ADI_CRC_GET_FUNC)(ADI_CRC_HANDLE hCrc, uint32_t *pData);
+/** CRC update function */
+typedef ADI_CRC_RESULT (*ADI_CRC_UPDATE_FUNC)(ADI_CRC_HANDLE hCrc, const uint8_t *pData,
+                                              uint32_t numBytes);
+/** CRC engine kernel. Updates the CRC register with the bytes in the buffer and returns it. */
+typedef uint32_t (*ADI_CRC_KERNEL_FUNC)(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                        uint32_t numBytes);
+
+/** Programs the CRC unit with poly, seed and bit order of the configuration. Returns 0 on
+ * success. */
+typedef int32_t (*ADI_CRC_HW_CONFIGURE_FUNC)(void *hUser, ADI_CRC_CONFIG *pConfig);
+/** Starts feeding a buffer to the CRC unit. Returns 0 if the transfer started. */
+typedef int32_t (*ADI_CRC_HW_START_FUNC)(void *hUser, const uint8_t *pData, uint32_t numBytes,
+                                         bool restart);
+/** Stops a transfer in progress. */
+typedef void (*ADI_CRC_HW_ABORT_FUNC)(void *hUser);
+
+/**
+ * Structure for the functions driving a hardware CRC unit.
+ */
+typedef struct
+{
+    /** User handle passed to the functions below */
+    void *hUser;
+    /** Function to program the CRC unit. Output reflection must match the input reflection and
+     * final XOR and byte swap of the unit must be disabled, the service applies them. */
+    ADI_CRC_HW_CONFIGURE_FUNC pfConfigure;
+    /** Function to start feeding a buffer to the CRC unit, by DMA or by the CPU. When restart is
+     * true the unit is loaded with the seed first, otherwise it continues from the previous
+     * buffer. When the unit is done the board calls adi_crc_HwCallback() with the CRC register,
+     * which may be from an interrupt. */
+    ADI_CRC_HW_START_FUNC pfStart;
+    /** Function to stop a transfer in progress. Optional, can be NULL. */
+    ADI_CRC_HW_ABORT_FUNC pfAbort;
+} ADI_CRC_HW_CONFIG;
 
 /**
  * Structure for CRC data.
@@ -156,8 +256,11 @@ typedef struct
 {
     /** Input data configuration */
     ADI_CRC_CONFIG crcCfg;
-    /** Pointer to CRC look up table */
-    uint16_t *pLookUpTable;
+    /** Pointer to CRC look up table, either a constant table or pTableMemory. Entries are 16 bit
+     * for CRC-8 and CRC-16 and 32 bit for CRC-32. */
+    const void *pLookUpTable;
+    /** State memory for look up tables built at run time */
+    void *pTableMemory;
     /** CRC calculation function */
     ADI_CRC_CALC_API_FUNC pfCalc;
     /**  CRC Configuration function*/
@@ -166,10 +269,26 @@ typedef struct
     ADI_CRC_GET_FUNC pfGetCrc;
     /** Close Function */
     ADI_CRC_CLOSE_FUNC pfReset;
-    /** CRC value of last call to calculate */
+    /** Update Function */
+    ADI_CRC_UPDATE_FUNC pfUpdate;
+    /** Finalize Function */
+    ADI_CRC_GET_FUNC pfFinalize;
+    /** CRC value of last call to calculate, or the partial CRC register while streaming */
     uint32_t crcValue;
+    /** A stream is in progress, crcValue holds the partial CRC register */
+    bool isStreaming;
+    /** Functions driving the hardware CRC unit */
+    ADI_CRC_HW_CONFIG hwCfg;
+    /** The hardware CRC unit is processing a buffer */
+    volatile bool isBusy;
     /** Core CRC calculation function*/
     ADI_CRC_CALC_FUNC pFunc;
+    /** Kernel of the configured engine */
+    ADI_CRC_KERNEL_FUNC pfKernel;
+    /** Number of bytes of pTableMemory */
+    uint32_t lookUpTableSize;
+    /** CRC register at the start of a calculation, the seed in the bit order of the kernel */
+    uint32_t initialCrc;
 } ADI_CRC_DATA;
 
 /** @} */
@@ -215,7 +334,52 @@ ADI_CRC_RESULT adi_crc_Calculate(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint16_t n
 ADI_CRC_RESULT adi_crc_GetCrc(ADI_CRC_HANDLE hCrc, uint32_t *pData);
 
 /**
- * @brief Function to reset CRC.
+ * @brief Function to add a chunk of data to the CRC of a stream. The first call after
+ * adi_crc_Finalize() or adi_crc_Reset() starts from the seed.
+ * @param hCrc          - Handle to CRC instance.
+ * @param pData         - Pointer to the chunk.
+ * @param numBytes      - Number of bytes in the chunk.
+ * return status of calculation.
+ */
+ADI_CRC_RESULT adi_crc_Update(ADI_CRC_HANDLE hCrc, const uint8_t *pData, uint32_t numBytes);
+
+/**
+ * @brief Function to end a stream and get its CRC. The CRC is also returned by adi_crc_GetCrc()
+ * afterwards. A stream without any data gives the CRC of an empty buffer.
+ * @param hCrc          - Handle to CRC instance.
+ * @param pData         - Pointer to the CRC.
+ * return status of calculation.
+ */
+ADI_CRC_RESULT adi_crc_Finalize(ADI_CRC_HANDLE hCrc, uint32_t *pData);
+
+/**
+ * @brief Function to combine the CRCs of two consecutive blocks into the CRC of both, for the
+ * configured polynomial. The blocks can be checksummed independently and in any order.
+ * @param hCrc          - Handle to CRC instance.
+ * @param crcA          - CRC of the first block.
+ * @param crcB          - CRC of the second block.
+ * @param lenB          - Number of bytes of the second block.
+ * @param pCrc          - Pointer to the CRC of the first block followed by the second.
+ * return status of calculation.
+ */
+ADI_CRC_RESULT adi_crc_Combine(ADI_CRC_HANDLE hCrc, uint32_t crcA, uint32_t crcB, uint32_t lenB,
+                               uint32_t *pCrc);
+
+/**
+ * @brief Function to check the configured engine against a bitwise reference of the
+ * configuration. Runs adi_crc_Calculate() over known vectors, including the check string
+ * "123456789", and one stream through adi_crc_Update() and adi_crc_Finalize(). For common
+ * configurations, for example CRC-32 and CRC-16/CCITT-FALSE, the CRC of "123456789" is also
+ * compared with the published check value. The last CRC and any stream in progress are
+ * discarded and pfCallback is called for each calculation.
+ * A hardware backend completes asynchronously and returns #ADI_CRC_RESULT_NOT_READY.
+ * @param hCrc          - Handle to CRC instance.
+ * return #ADI_CRC_RESULT_SUCCESS if all results match, #ADI_CRC_RESULT_FAILURE otherwise.
+ */
+ADI_CRC_RESULT adi_crc_SelfTest(ADI_CRC_HANDLE hCrc);
+
+/**
+ * @brief Function to reset CRC. Discards a stream in progress.
  * @param hCrc          - Handle to CRC instance.
  */
 void adi_crc_Reset(ADI_CRC_HANDLE hCrc);
@@ -21,9 +21,18 @@ extern "C" {
 /** macro for crc error */
 #define ADI_STATUS_CRC_ERROR 0x01
 
+/** Seed of the crc */
+#define ADI_CRC_CCITT16_SEED 0xFFFFu
+
 /** CRC Bytes*/
 #define ADI_CRC_BYTES_LEN 2
 
+/** Register left after running the crc over data followed by its crc, high byte first */
+#define ADI_CRC_CCITT16_RESIDUE 0x0000u
+
+/** Table of the crc, polynomial 0x1021. Generated in adi_crc_tables.c */
+extern const uint16_t crcTable16Poly1021[256];
+
 /*======= P U B L I C   P R O T O T Y P E S ========*/
 
 /**
@@ -51,6 +60,46 @@ int32_t adi_crc_VerifyCCITT16(uint8_t *pData, uint16_t numBytes);
  */
 uint32_t adi_crc_CalculateCCITT16(uint8_t *pBuff, uint32_t numBytes);
 
+/**
+ * @brief Update a partial crc with a chunk of data. Start with #ADI_CRC_CCITT16_SEED; the
+ * result after the last chunk is the crc of the whole data.
+ *
+ * @param[in]  crc  - partial crc of the previous chunks
+ * @param[in]  pBuff  - pointer to the chunk
+ * @param[in]  numBytes  - number of bytes in the chunk
+ * @return  partial CRC
+ */
+uint32_t adi_crc_UpdateCCITT16(uint32_t crc, const uint8_t *pBuff, uint32_t numBytes);
+
+/*======= INLINE FUNCTIONS  ========*/
+
+/**
+ * @brief Verify the crc of a frame in one pass. Runs the crc over the data and the crc bytes
+ * stored after it by adi_crc_AddCCITT16 and checks the residue.
+ *
+ * @param[in]  pData  - pointer to data, followed by #ADI_CRC_BYTES_LEN crc bytes
+ * @param[in]  numBytes  - number of bytes of data, without the crc bytes
+ * @return  0 if it is success.
+ */
+static inline int32_t adi_crc_VerifyResidueCCITT16(const uint8_t *pData, uint32_t numBytes)
+{
+    uint16_t checksum = (uint16_t)ADI_CRC_CCITT16_SEED;
+    uint32_t i;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        checksum = (uint16_t)(crcTable16Poly1021[(uint8_t)(pData[i] ^ (checksum >> 8))] ^
+                              (uint16_t)(checksum << 8));
+    }
+    /* The crc is stored low byte first, it has to enter the register high byte first */
+    checksum = (uint16_t)(crcTable16Poly1021[(uint8_t)(pData[numBytes + 1] ^ (checksum >> 8))] ^
+                          (uint16_t)(checksum << 8));
+    checksum = (uint16_t)(crcTable16Poly1021[(uint8_t)(pData[numBytes] ^ (checksum >> 8))] ^
+                          (uint16_t)(checksum << 8));
+
+    return (checksum == ADI_CRC_CCITT16_RESIDUE) ? 0 : ADI_STATUS_CRC_ERROR;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,122 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file        adi_crc_hw.h
+ * @addtogroup CRCAPI
+ * @{
+ */
+
+#ifndef __ADI_CRC_HW_H__
+#define __ADI_CRC_HW_H__
+
+/*============= I N C L U D E S =============*/
+#include "adi_crc.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= P U B L I C   P R O T O T Y P E S =============*/
+/**
+ * @brief Function to initialize hardware based CRC.
+ * Assign memory and sets up the internal structures of the library. The calculations are
+ * asynchronous: adi_crc_Calculate() and adi_crc_Update() start the CRC unit and return,
+ * pfCallback of the configuration is called when the unit is done. Until then adi_crc_GetCrc()
+ * returns #ADI_CRC_RESULT_NOT_READY.
+ *
+ * @param[out] phCrc            - Pointer to a location where the
+ *                                handle to the library is written.
+ *                                This handle is required in all other
+ *                                library APIs.
+ * @param[in]  pStateMemory     - The pointer to the memory for the library.
+ *                                This pointer must be 32-bit aligned. This
+ *                                memory must be persistent in the application
+ *                                so it is recommended that it is not allocated
+ *                                in the stack.
+ * @param[in]  stateMemorySize	- Size of the memory pointed by pStateMemory
+ *                                This must be at least
+ *                                ADI_CRC_HW_STATE_MEM_NUM_BYTES bytes.
+ * @param[in]  pHwConfig        - Functions driving the CRC unit.
+ * @return  One of the codes documented in #ADI_CRC_RESULT. Refer to
+ * #ADI_CRC_RESULT documentation for details.
+ *
+ */
+ADI_CRC_RESULT adi_crc_OpenHw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_t stateMemorySize,
+                              ADI_CRC_HW_CONFIG *pHwConfig);
+
+/**
+ * @brief Function to assign CRC configuration parameters and program the CRC unit.
+ *
+ * @param[in]  hCrc         - Handle to the library instance.
+ * @param[in]  pConfig      - The pointer to the configuration structure
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ *          Refer to #ADI_CRC_RESULT for details.
+ */
+ADI_CRC_RESULT adi_crc_SetConfigHw(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFIG *pConfig);
+
+/**
+ * @brief Function to start the calculation of the CRC. The buffer must stay valid until the
+ * callback.
+ * @param[in] hCrc          - Handle to the library instance.
+ * @param[in] pData         - Pointer to buffer.
+ * @param[in] numBytes      - Number of bytes in the buffer.
+ * @param[in] offset        - Offset in the buffer to data to calculate CRC.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ *          #ADI_CRC_RESULT_NOT_READY if the unit is still busy.
+ */
+ADI_CRC_RESULT adi_crc_CalculateHw(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint32_t numBytes,
+                                   uint16_t offset);
+
+/**
+ * @brief Function to get the computed CRC.
+ * @param[in]  hCrc          - Handle to CRC instance.
+ * @param[out] pData         - Pointer to buffer.
+ * @return  #ADI_CRC_RESULT_NOT_READY while the unit is busy or a stream is open.
+ */
+ADI_CRC_RESULT adi_crc_GetCrcHw(ADI_CRC_HANDLE hCrc, uint32_t *pData);
+
+/**
+ * @brief Function to start adding a chunk of data to the CRC of a stream. The chunk must stay
+ * valid until the callback. An empty chunk completes immediately without a callback.
+ * @param[in] hCrc          - Handle to the library instance.
+ * @param[in] pData         - Pointer to the chunk.
+ * @param[in] numBytes      - Number of bytes in the chunk.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ *          #ADI_CRC_RESULT_NOT_READY if the unit is still busy.
+ */
+ADI_CRC_RESULT adi_crc_UpdateHw(ADI_CRC_HANDLE hCrc, const uint8_t *pData, uint32_t numBytes);
+
+/**
+ * @brief Function to end a stream and get its CRC.
+ * @param[in]  hCrc          - Handle to CRC instance.
+ * @param[out] pData         - Pointer to the CRC.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ *          #ADI_CRC_RESULT_NOT_READY if the unit is still busy.
+ */
+ADI_CRC_RESULT adi_crc_FinalizeHw(ADI_CRC_HANDLE hCrc, uint32_t *pData);
+
+/**
+ * @brief Function to stop a calculation in progress and discard a stream.
+ * @param[in]  hCrc          - Handle to CRC instance.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ */
+ADI_CRC_RESULT adi_crc_ResetHw(ADI_CRC_HANDLE hCrc);
+
+/**
+ * @brief Function to be called by the board when the CRC unit is done with the buffer given to
+ * pfStart. Can be called from an interrupt.
+ * @param[in]  hCrc          - Handle to CRC instance.
+ * @param[in]  crc           - CRC register of the unit, reflected for reflected configurations.
+ */
+void adi_crc_HwCallback(ADI_CRC_HANDLE hCrc, uint32_t crc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_CRC_HW_H__ */
+
+/** @} */
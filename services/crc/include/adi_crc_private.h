@@ -0,0 +1,87 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file        adi_crc_private.h
+ * @brief       Helpers shared by the CRC backends (internal use)
+ * @{
+ */
+
+#ifndef __ADI_CRC_PRIVATE_H__
+#define __ADI_CRC_PRIVATE_H__
+
+/*=============  I N C L U D E S   =============*/
+#include "adi_crc.h"
+#include "adi_crc_ccitt16.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= D E F I N I T I O N S =============*/
+
+/**
+ * Constant 8 bit look up table of a polynomial.
+ */
+typedef struct
+{
+    /** CRC Type. */
+    ADI_CRC_TYPE crcType;
+    /** Reflected table. */
+    bool reversed;
+    /** CRC polynomial in normal form. */
+    uint32_t poly;
+    /** Table, 16 bit entries for CRC-8 and CRC-16 and 32 bit entries for CRC-32. */
+    const void *pTable;
+} CRC_CONST_TABLE;
+
+/** CRC-8 table of polynomial 0x07 */
+extern const uint16_t crcTable8Poly07[LOOK_UP_TABLE_SIZE];
+/** Reflected CRC-16 table of polynomial 0x8005 */
+extern const uint16_t crcTable16ReflectedPoly8005[LOOK_UP_TABLE_SIZE];
+/** CRC-32 table of polynomial 0x04C11DB7 */
+extern const uint32_t crcTable32Poly04C11DB7[LOOK_UP_TABLE_SIZE];
+/** Reflected CRC-32 table of polynomial 0x04C11DB7 */
+extern const uint32_t crcTable32ReflectedPoly04C11DB7[LOOK_UP_TABLE_SIZE];
+/** All constant tables */
+extern const CRC_CONST_TABLE crcConstTables[];
+/** Number of entries in crcConstTables */
+extern const uint32_t crcNumConstTables;
+
+/*============= P R O T O T Y P E S =============*/
+
+/**
+ * @brief Function to turn the CRC register into the CRC. Applies the final XOR, the width and
+ * the byte order of the configuration.
+ * @param pData         - Pointer to CRC data.
+ * @param crc           - CRC register.
+ * @return - Returns the CRC
+ */
+uint32_t CrcFinalize(const ADI_CRC_DATA *pData, uint32_t crc);
+
+/**
+ * @brief Function to reverse the bit order of a value.
+ * @param value         - Value to reflect.
+ * @param numBits       - Number of bits of the value.
+ * @return - Returns the reflected value
+ */
+uint32_t CrcReflect(uint32_t value, uint32_t numBits);
+
+/**
+ * @brief Function to get the CRC register at the start of a calculation. This is the seed, reflected
+ * for reflected configurations.
+ * @param pConfig       - Pointer to the configuration.
+ * @return - Returns the initial CRC register
+ */
+uint32_t CrcGetInitialRegister(const ADI_CRC_CONFIG *pConfig);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_CRC_PRIVATE_H__ */
+
+/** @} */
@@ -76,6 +76,33 @@ ADI_CRC_RESULT adi_crc_CalculateSw(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint32_t
  */
 ADI_CRC_RESULT adi_crc_GetCrcSw(ADI_CRC_HANDLE hCrc, uint32_t *pData);
 
+/**
+ * @brief Function to add a chunk of data to the CRC of a stream.
+ * @param[in] hCrc          - Handle to the library instance.
+ * @param[in] pData         - Pointer to the chunk.
+ * @param[in] numBytes      - Number of bytes in the chunk.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ *          Refer to #ADI_CRC_RESULT for details.
+ */
+ADI_CRC_RESULT adi_crc_UpdateSw(ADI_CRC_HANDLE hCrc, const uint8_t *pData, uint32_t numBytes);
+
+/**
+ * @brief Function to end a stream and get its CRC.
+ * @param[in]  hCrc          - Handle to CRC instance.
+ * @param[out] pData         - Pointer to the CRC.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ *          Refer to #ADI_CRC_RESULT for details.
+ */
+ADI_CRC_RESULT adi_crc_FinalizeSw(ADI_CRC_HANDLE hCrc, uint32_t *pData);
+
+/**
+ * @brief Function to discard a stream in progress.
+ * @param[in]  hCrc          - Handle to CRC instance.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ *          Refer to #ADI_CRC_RESULT for details.
+ */
+ADI_CRC_RESULT adi_crc_ResetSw(ADI_CRC_HANDLE hCrc);
+
 #ifdef __cplusplus
 }
 #endif
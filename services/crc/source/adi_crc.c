@@ -11,9 +11,132 @@
 
 /*=============  I N C L U D E S   =============*/
 #include "adi_crc.h"
+#include "adi_crc_private.h"
 #include <stdint.h>
 #include <stdlib.h>
 
+/*============= D E F I N E S =============*/
+
+/** Number of bytes of the self test data streamed in the first chunk */
+#define CRC_SELF_TEST_CHUNK_NUM_BYTES 20u
+/** Number of bytes of the check string "123456789" */
+#define CRC_CHECK_NUM_BYTES 9u
+
+/*============= D A T A  T Y P E S =============*/
+
+/**
+ * Published parameters and check value of a CRC, from the catalogue of parametrised CRC
+ * algorithms.
+ */
+typedef struct
+{
+    /** CRC type */
+    ADI_CRC_TYPE crcType;
+    /** Polynomial in normal form */
+    uint32_t poly;
+    /** Seed */
+    uint32_t seed;
+    /** Final XOR value */
+    uint32_t xorOut;
+    /** Reflected input and output */
+    bool reversed;
+    /** CRC of "123456789", without byte swap */
+    uint32_t check;
+} CRC_CATALOGUE_ENTRY;
+
+/*============= D A T A =============*/
+
+/** Self test data. The first 9 bytes are the check string of the CRC catalogues. */
+static const uint8_t selfTestData[] =
+    "123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+/** Self test lengths, covering the tails of the 4 and 8 byte kernels */
+static const uint16_t selfTestLengths[] = {0u, 1u, 9u, 17u, 23u, sizeof(selfTestData) - 1u};
+
+/** Check values of common configurations. They are compared with the engine directly, so that a
+ * fault shared by the engine and the bitwise reference is found as well. */
+static const CRC_CATALOGUE_ENTRY crcCatalogue[] = {
+    /* CRC-8/SMBUS */
+    {ADI_CRC_TYPE_CRC8, 0x07u, 0x00u, 0x00u, false, 0xF4u},
+    /* CRC-8/MAXIM-DOW */
+    {ADI_CRC_TYPE_CRC8, 0x31u, 0x00u, 0x00u, true, 0xA1u},
+    /* CRC-16/IBM-3740, also known as CRC-16/CCITT-FALSE */
+    {ADI_CRC_TYPE_CRC16, 0x1021u, 0xFFFFu, 0x0000u, false, 0x29B1u},
+    /* CRC-16/XMODEM */
+    {ADI_CRC_TYPE_CRC16, 0x1021u, 0x0000u, 0x0000u, false, 0x31C3u},
+    /* CRC-16/KERMIT */
+    {ADI_CRC_TYPE_CRC16, 0x1021u, 0x0000u, 0x0000u, true, 0x2189u},
+    /* CRC-16/ARC */
+    {ADI_CRC_TYPE_CRC16, 0x8005u, 0x0000u, 0x0000u, true, 0xBB3Du},
+    /* CRC-16/MODBUS */
+    {ADI_CRC_TYPE_CRC16, 0x8005u, 0xFFFFu, 0x0000u, true, 0x4B37u},
+    /* CRC-32/ISO-HDLC, the CRC-32 of IEEE 802.3 */
+    {ADI_CRC_TYPE_CRC32, 0x04C11DB7u, 0xFFFFFFFFu, 0xFFFFFFFFu, true, 0xCBF43926u},
+    /* CRC-32/MPEG-2 */
+    {ADI_CRC_TYPE_CRC32, 0x04C11DB7u, 0xFFFFFFFFu, 0x00000000u, false, 0x0376E6E7u},
+    /* CRC-32/BZIP2 */
+    {ADI_CRC_TYPE_CRC32, 0x04C11DB7u, 0xFFFFFFFFu, 0xFFFFFFFFu, false, 0xFC891918u},
+    /* CRC-32/ISCSI, the CRC-32C of Castagnoli */
+    {ADI_CRC_TYPE_CRC32, 0x1EDC6F41u, 0xFFFFFFFFu, 0xFFFFFFFFu, true, 0xE3069283u},
+};
+
+/*============= F U N C T I O N S =============*/
+/**
+ * @brief Function to calculate the CRC of the configuration one bit at a time.
+ * @param pData         - Pointer to CRC data.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @return - Returns the CRC
+ */
+static uint32_t CrcReferenceCalculate(const ADI_CRC_DATA *pData, const uint8_t *pBuff,
+                                      uint32_t numBytes);
+
+/**
+ * @brief Function to get the width of a CRC type.
+ * @param crcType       - CRC type.
+ * @return - Returns the width in bits
+ */
+static uint32_t CrcGetWidth(ADI_CRC_TYPE crcType);
+
+/**
+ * @brief Function to recover the CRC register from a CRC. Reverts the byte order and the final
+ * XOR of the configuration.
+ * @param pConfig       - Pointer to the configuration.
+ * @param crc           - CRC.
+ * @return - Returns the CRC register
+ */
+static uint32_t CrcUnfinalize(const ADI_CRC_CONFIG *pConfig, uint32_t crc);
+
+/**
+ * @brief Function to multiply two polynomials modulo the CRC polynomial. All values are
+ * reflected; the MSB of the width is x^0.
+ * @param a             - First polynomial.
+ * @param b             - Second polynomial.
+ * @param poly          - Reflected CRC polynomial.
+ * @param numBits       - Width of the CRC.
+ * @return - Returns a * b modulo poly
+ */
+static uint32_t CrcMultModP(uint32_t a, uint32_t b, uint32_t poly, uint32_t numBits);
+
+/**
+ * @brief Function to get x^(8 * numBytes) modulo the CRC polynomial, the operator that appends
+ * numBytes zero bytes to a CRC register.
+ * @param numBytes      - Number of bytes.
+ * @param poly          - Reflected CRC polynomial.
+ * @param numBits       - Width of the CRC.
+ * @return - Returns the reflected x^(8 * numBytes) modulo poly
+ */
+static uint32_t CrcXPow8nModP(uint32_t numBytes, uint32_t poly, uint32_t numBits);
+
+/**
+ * @brief Function to get the published check value of the configuration, the CRC of
+ * "123456789", in the byte order of the configuration.
+ * @param pConfig       - Pointer to the configuration.
+ * @param pCheck        - Pointer to the check value.
+ * @return - Returns true if the configuration is in the catalogue
+ */
+static bool CrcGetCatalogueCheck(const ADI_CRC_CONFIG *pConfig, uint32_t *pCheck);
+
 /*=============  C O D E  =============*/
 
 ADI_CRC_RESULT adi_crc_SetConfig(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFIG *pConfig)
@@ -86,6 +209,161 @@ ADI_CRC_RESULT adi_crc_GetCrc(ADI_CRC_HANDLE hCrc, uint32_t *pData)
     return status;
 }
 
+ADI_CRC_RESULT adi_crc_Update(ADI_CRC_HANDLE hCrc, const uint8_t *pData, uint32_t numBytes)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if (hCrc == NULL)
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else
+    {
+        if (pCrcData->pfUpdate != NULL)
+        {
+            status = pCrcData->pfUpdate(hCrc, pData, numBytes);
+        }
+        else
+        {
+            status = ADI_CRC_RESULT_NULL_PTR;
+        }
+    }
+    return status;
+}
+
+ADI_CRC_RESULT adi_crc_Finalize(ADI_CRC_HANDLE hCrc, uint32_t *pData)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if (hCrc == NULL)
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else
+    {
+        if (pCrcData->pfFinalize != NULL)
+        {
+            status = pCrcData->pfFinalize(hCrc, pData);
+        }
+        else
+        {
+            status = ADI_CRC_RESULT_NULL_PTR;
+        }
+    }
+    return status;
+}
+
+ADI_CRC_RESULT adi_crc_Combine(ADI_CRC_HANDLE hCrc, uint32_t crcA, uint32_t crcB, uint32_t lenB,
+                               uint32_t *pCrc)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+    const ADI_CRC_CONFIG *pConfig;
+    uint32_t numBits;
+    uint32_t mask;
+    uint32_t poly;
+    uint32_t regA;
+    uint32_t regB;
+    uint32_t initial;
+    uint32_t crc;
+
+    if ((hCrc == NULL) || (pCrc == NULL))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else
+    {
+        pConfig = &pCrcData->crcCfg;
+        numBits = CrcGetWidth(pConfig->crcType);
+        mask = 0xFFFFFFFFu >> (32u - numBits);
+        regA = CrcUnfinalize(pConfig, crcA);
+        regB = CrcUnfinalize(pConfig, crcB);
+        initial = CrcGetInitialRegister(pConfig) & mask;
+        if (!pConfig->reversed)
+        {
+            /* Work on reflected registers, the arithmetic is the same in either bit order */
+            regA = CrcReflect(regA, numBits);
+            regB = CrcReflect(regB, numBits);
+            initial = CrcReflect(initial, numBits);
+        }
+        poly = CrcReflect(pConfig->poly, numBits);
+
+        /* Running B from the end of A instead of the seed changes its register by the
+         * difference of the two, shifted over the lenB bytes of B */
+        crc = CrcMultModP(CrcXPow8nModP(lenB, poly, numBits), regA ^ initial, poly, numBits);
+        crc ^= regB;
+
+        if (!pConfig->reversed)
+        {
+            crc = CrcReflect(crc, numBits);
+        }
+        *pCrc = CrcFinalize(pCrcData, crc);
+    }
+
+    return status;
+}
+
+ADI_CRC_RESULT adi_crc_SelfTest(ADI_CRC_HANDLE hCrc)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+    uint32_t numBytes;
+    uint32_t crc = 0;
+    uint32_t check;
+    uint32_t i;
+
+    if (hCrc == NULL)
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+
+    for (i = 0; (i < sizeof(selfTestLengths) / sizeof(selfTestLengths[0])) &&
+                (status == ADI_CRC_RESULT_SUCCESS);
+         i++)
+    {
+        numBytes = selfTestLengths[i];
+        status = adi_crc_Calculate(hCrc, (uint8_t *)selfTestData, (uint16_t)numBytes, 0);
+        if (status == ADI_CRC_RESULT_SUCCESS)
+        {
+            status = adi_crc_GetCrc(hCrc, &crc);
+        }
+        if ((status == ADI_CRC_RESULT_SUCCESS) &&
+            (crc != CrcReferenceCalculate(pCrcData, selfTestData, numBytes)))
+        {
+            status = ADI_CRC_RESULT_FAILURE;
+        }
+        if ((status == ADI_CRC_RESULT_SUCCESS) && (numBytes == CRC_CHECK_NUM_BYTES) &&
+            CrcGetCatalogueCheck(&pCrcData->crcCfg, &check) && (crc != check))
+        {
+            status = ADI_CRC_RESULT_FAILURE;
+        }
+    }
+
+    if (status == ADI_CRC_RESULT_SUCCESS)
+    {
+        numBytes = sizeof(selfTestData) - 1u;
+        status = adi_crc_Update(hCrc, selfTestData, CRC_SELF_TEST_CHUNK_NUM_BYTES);
+        if (status == ADI_CRC_RESULT_SUCCESS)
+        {
+            status = adi_crc_Update(hCrc, &selfTestData[CRC_SELF_TEST_CHUNK_NUM_BYTES],
+                                    numBytes - CRC_SELF_TEST_CHUNK_NUM_BYTES);
+        }
+        if (status == ADI_CRC_RESULT_SUCCESS)
+        {
+            status = adi_crc_Finalize(hCrc, &crc);
+        }
+        if ((status == ADI_CRC_RESULT_SUCCESS) &&
+            (crc != CrcReferenceCalculate(pCrcData, selfTestData, numBytes)))
+        {
+            status = ADI_CRC_RESULT_FAILURE;
+        }
+    }
+
+    return status;
+}
+
 void adi_crc_Reset(ADI_CRC_HANDLE hCrc)
 {
     ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
@@ -99,6 +377,244 @@ void adi_crc_Reset(ADI_CRC_HANDLE hCrc)
     }
 }
 
+uint32_t CrcFinalize(const ADI_CRC_DATA *pData, uint32_t crc)
+{
+    uint32_t checksum = crc ^ pData->crcCfg.xorOut;
+
+    if (pData->crcCfg.crcType == ADI_CRC_TYPE_CRC8)
+    {
+        checksum &= 0xFFu;
+    }
+    else if (pData->crcCfg.crcType == ADI_CRC_TYPE_CRC16)
+    {
+        checksum &= 0xFFFFu;
+        if (pData->crcCfg.bigEndian)
+        {
+            checksum = ((checksum & 0xFFu) << 8) | (checksum >> 8);
+        }
+    }
+    else if (pData->crcCfg.bigEndian)
+    {
+        checksum = ((checksum & 0xFFu) << 24) | ((checksum & 0xFF00u) << 8) |
+                   ((checksum >> 8) & 0xFF00u) | (checksum >> 24);
+    }
+
+    return checksum;
+}
+
+uint32_t CrcReflect(uint32_t value, uint32_t numBits)
+{
+    uint32_t reflected = 0;
+    uint32_t i;
+
+    for (i = 0; i < numBits; i++)
+    {
+        reflected = (reflected << 1) | ((value >> i) & 1u);
+    }
+
+    return reflected;
+}
+
+uint32_t CrcGetInitialRegister(const ADI_CRC_CONFIG *pConfig)
+{
+    uint32_t crc = pConfig->seed;
+
+    if (pConfig->reversed)
+    {
+        switch (pConfig->crcType)
+        {
+        case ADI_CRC_TYPE_CRC8:
+            crc = CrcReflect(pConfig->seed, 8);
+            break;
+        case ADI_CRC_TYPE_CRC16:
+            crc = CrcReflect(pConfig->seed, 16);
+            break;
+        default:
+            crc = CrcReflect(pConfig->seed, 32);
+            break;
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * \ref CrcReferenceCalculate
+ */
+static uint32_t CrcReferenceCalculate(const ADI_CRC_DATA *pData, const uint8_t *pBuff,
+                                      uint32_t numBytes)
+{
+    uint32_t numBits = CrcGetWidth(pData->crcCfg.crcType);
+    uint32_t topBit = 1u << (numBits - 1u);
+    uint32_t mask = 0xFFFFFFFFu >> (32u - numBits);
+    uint32_t poly = pData->crcCfg.poly & mask;
+    uint32_t crc = pData->crcCfg.seed & mask;
+    uint32_t bit;
+    uint32_t i, j;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            /* Data bit in the order of the configuration, against the MSB of the register */
+            bit = pData->crcCfg.reversed ? (pBuff[i] >> j) : (pBuff[i] >> (7u - j));
+            if (((bit & 1u) != 0) != ((crc & topBit) != 0))
+            {
+                crc = ((crc << 1) ^ poly) & mask;
+            }
+            else
+            {
+                crc = (crc << 1) & mask;
+            }
+        }
+    }
+    if (pData->crcCfg.reversed)
+    {
+        /* CrcFinalize expects the register in the bit order of the kernels */
+        crc = CrcReflect(crc, numBits);
+    }
+
+    return CrcFinalize(pData, crc);
+}
+
+/**
+ * \ref CrcGetCatalogueCheck
+ */
+static bool CrcGetCatalogueCheck(const ADI_CRC_CONFIG *pConfig, uint32_t *pCheck)
+{
+    bool isFound = false;
+    uint32_t mask = 0xFFFFFFFFu >> (32u - CrcGetWidth(pConfig->crcType));
+    uint32_t check = 0;
+    uint32_t i;
+
+    for (i = 0; (i < sizeof(crcCatalogue) / sizeof(crcCatalogue[0])) && !isFound; i++)
+    {
+        if ((crcCatalogue[i].crcType == pConfig->crcType) &&
+            (crcCatalogue[i].poly == (pConfig->poly & mask)) &&
+            (crcCatalogue[i].seed == (pConfig->seed & mask)) &&
+            (crcCatalogue[i].xorOut == (pConfig->xorOut & mask)) &&
+            (crcCatalogue[i].reversed == pConfig->reversed))
+        {
+            check = crcCatalogue[i].check;
+            isFound = true;
+        }
+    }
+    if (isFound && pConfig->bigEndian)
+    {
+        if (pConfig->crcType == ADI_CRC_TYPE_CRC16)
+        {
+            check = ((check & 0xFFu) << 8) | (check >> 8);
+        }
+        else if (pConfig->crcType == ADI_CRC_TYPE_CRC32)
+        {
+            check = ((check & 0xFFu) << 24) | ((check & 0xFF00u) << 8) |
+                    ((check >> 8) & 0xFF00u) | (check >> 24);
+        }
+    }
+    *pCheck = check;
+
+    return isFound;
+}
+
+/**
+ * \ref CrcGetWidth
+ */
+static uint32_t CrcGetWidth(ADI_CRC_TYPE crcType)
+{
+    uint32_t numBits;
+
+    switch (crcType)
+    {
+    case ADI_CRC_TYPE_CRC8:
+        numBits = 8;
+        break;
+    case ADI_CRC_TYPE_CRC16:
+        numBits = 16;
+        break;
+    default:
+        numBits = 32;
+        break;
+    }
+
+    return numBits;
+}
+
+/**
+ * \ref CrcUnfinalize
+ */
+static uint32_t CrcUnfinalize(const ADI_CRC_CONFIG *pConfig, uint32_t crc)
+{
+    uint32_t numBits = CrcGetWidth(pConfig->crcType);
+    uint32_t reg = crc & (0xFFFFFFFFu >> (32u - numBits));
+
+    if (pConfig->bigEndian)
+    {
+        if (numBits == 16)
+        {
+            reg = ((reg & 0xFFu) << 8) | (reg >> 8);
+        }
+        else if (numBits == 32)
+        {
+            reg = ((reg & 0xFFu) << 24) | ((reg & 0xFF00u) << 8) | ((reg >> 8) & 0xFF00u) |
+                  (reg >> 24);
+        }
+    }
+
+    return (reg ^ pConfig->xorOut) & (0xFFFFFFFFu >> (32u - numBits));
+}
+
+/**
+ * \ref CrcMultModP
+ */
+static uint32_t CrcMultModP(uint32_t a, uint32_t b, uint32_t poly, uint32_t numBits)
+{
+    uint32_t m = 1u << (numBits - 1u);
+    uint32_t p = 0;
+
+    while (m != 0)
+    {
+        if ((a & m) != 0)
+        {
+            p ^= b;
+        }
+        /* b times x */
+        b = (b & 1u) ? ((b >> 1) ^ poly) : (b >> 1);
+        m >>= 1;
+    }
+
+    return p;
+}
+
+/**
+ * \ref CrcXPow8nModP
+ */
+static uint32_t CrcXPow8nModP(uint32_t numBytes, uint32_t poly, uint32_t numBits)
+{
+    /* x^0 */
+    uint32_t p = 1u << (numBits - 1u);
+    /* x^8, squared for each bit of numBytes */
+    uint32_t square = 1u << (numBits - 9u);
+    uint32_t n = numBytes;
+
+    if (numBits == 8)
+    {
+        /* x^8 does not fit an 8 bit register, x^8 = x^7 * x */
+        square = CrcMultModP(1u, 1u << 6, poly, numBits);
+    }
+
+    while (n != 0)
+    {
+        if ((n & 1u) != 0)
+        {
+            p = CrcMultModP(square, p, poly, numBits);
+        }
+        square = CrcMultModP(square, square, poly, numBits);
+        n >>= 1;
+    }
+
+    return p;
+}
+
 /**
  * @}
  */
@@ -0,0 +1,312 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     adi_crc_hw.c
+ * @brief    This file contains the routines for initializing and calculating
+ *           CRC with a hardware CRC unit. The unit is driven through the
+ *           functions of #ADI_CRC_HW_CONFIG and completes asynchronously.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+#include "adi_crc_hw.h"
+#include "adi_crc_private.h"
+#include <stdint.h>
+#include <string.h>
+
+/*============= F U N C T I O N S =============*/
+/**
+ * @brief Function to start the CRC unit on a buffer.
+ * @param pData         - Pointer to CRC data.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @param restart       - Load the seed before the buffer.
+ * @return  One of the return codes documented in #ADI_CRC_RESULT.
+ */
+static ADI_CRC_RESULT CrcStartHw(ADI_CRC_DATA *pData, const uint8_t *pBuff, uint32_t numBytes,
+                                 bool restart);
+
+/*=============  C O D E  =============*/
+/**
+ * \ref adi_crc_OpenHw
+ */
+ADI_CRC_RESULT adi_crc_OpenHw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_t stateMemorySize,
+                              ADI_CRC_HW_CONFIG *pHwConfig)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = NULL;
+
+    /* Check the given pointers before we set their contents */
+    if ((phCrc == (void *)NULL) || (pStateMemory == (void *)NULL) || (pHwConfig == NULL) ||
+        (pHwConfig->pfStart == NULL))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+
+    if (status == ADI_CRC_RESULT_SUCCESS)
+    {
+        *phCrc = (ADI_CRC_HANDLE)NULL;
+
+        if (stateMemorySize < ADI_CRC_HW_STATE_MEM_NUM_BYTES)
+        {
+            status = ADI_CRC_RESULT_INSUFFICIENT_MEMORY;
+        }
+        else
+        {
+            pCrcData = (ADI_CRC_DATA *)pStateMemory;
+            memset(pCrcData, 0, sizeof(ADI_CRC_DATA));
+            pCrcData->pfReset = adi_crc_ResetHw;
+            pCrcData->pfUpdate = adi_crc_UpdateHw;
+            pCrcData->pfFinalize = adi_crc_FinalizeHw;
+            pCrcData->pfCalc = (ADI_CRC_CALC_API_FUNC)adi_crc_CalculateHw;
+            pCrcData->pfConfig = adi_crc_SetConfigHw;
+            pCrcData->pfGetCrc = adi_crc_GetCrcHw;
+            memcpy(&pCrcData->hwCfg, pHwConfig, sizeof(pCrcData->hwCfg));
+
+            *phCrc = (ADI_CRC_HANDLE *)pCrcData;
+        }
+    }
+    return status;
+}
+
+/**
+ * \ref adi_crc_SetConfigHw
+ */
+ADI_CRC_RESULT adi_crc_SetConfigHw(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFIG *pConfig)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || (pConfig == NULL))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->isBusy)
+    {
+        status = ADI_CRC_RESULT_NOT_READY;
+    }
+    else if (pConfig->crcType > ADI_CRC_TYPE_CRC32)
+    {
+        status = ADI_CRC_RESULT_FAILURE;
+    }
+    else
+    {
+        memcpy(&pCrcData->crcCfg, pConfig, sizeof(pCrcData->crcCfg));
+        pCrcData->isStreaming = false;
+        pCrcData->initialCrc = CrcGetInitialRegister(&pCrcData->crcCfg);
+        if (pCrcData->hwCfg.pfConfigure != NULL)
+        {
+            if (pCrcData->hwCfg.pfConfigure(pCrcData->hwCfg.hUser, &pCrcData->crcCfg) != 0)
+            {
+                status = ADI_CRC_RESULT_INIT_FAILURE;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_CalculateHw
+ */
+ADI_CRC_RESULT adi_crc_CalculateHw(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint32_t numBytes,
+                                   uint16_t offset)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || ((pData == NULL) && (numBytes > 0)))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->isBusy)
+    {
+        status = ADI_CRC_RESULT_NOT_READY;
+    }
+    else
+    {
+        pCrcData->isStreaming = false;
+        if (numBytes == 0)
+        {
+            /* Nothing for the unit to do, the CRC of an empty buffer is ready now */
+            pCrcData->crcValue = CrcFinalize(pCrcData, pCrcData->initialCrc);
+            if (pCrcData->crcCfg.pfCallback != NULL)
+            {
+                pCrcData->crcCfg.pfCallback(pCrcData->crcCfg.pCBData);
+            }
+        }
+        else
+        {
+            status = CrcStartHw(pCrcData, &pData[offset], numBytes, true);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_GetCrcHw
+ */
+ADI_CRC_RESULT adi_crc_GetCrcHw(ADI_CRC_HANDLE hCrc, uint32_t *pData)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || (pData == NULL))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->isBusy || pCrcData->isStreaming)
+    {
+        status = ADI_CRC_RESULT_NOT_READY;
+    }
+    else
+    {
+        *pData = pCrcData->crcValue;
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_UpdateHw
+ */
+ADI_CRC_RESULT adi_crc_UpdateHw(ADI_CRC_HANDLE hCrc, const uint8_t *pData, uint32_t numBytes)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+    bool restart;
+
+    if ((hCrc == NULL) || ((pData == NULL) && (numBytes > 0)))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->isBusy)
+    {
+        status = ADI_CRC_RESULT_NOT_READY;
+    }
+    else if (numBytes > 0)
+    {
+        restart = !pCrcData->isStreaming;
+        pCrcData->isStreaming = true;
+        status = CrcStartHw(pCrcData, pData, numBytes, restart);
+        if ((status != ADI_CRC_RESULT_SUCCESS) && restart)
+        {
+            /* The unit never started, so the stream is still empty */
+            pCrcData->isStreaming = false;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_FinalizeHw
+ */
+ADI_CRC_RESULT adi_crc_FinalizeHw(ADI_CRC_HANDLE hCrc, uint32_t *pData)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || (pData == NULL))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->isBusy)
+    {
+        status = ADI_CRC_RESULT_NOT_READY;
+    }
+    else
+    {
+        if (!pCrcData->isStreaming)
+        {
+            pCrcData->crcValue = pCrcData->initialCrc;
+        }
+        pCrcData->isStreaming = false;
+        pCrcData->crcValue = CrcFinalize(pCrcData, pCrcData->crcValue);
+        *pData = pCrcData->crcValue;
+        if (pCrcData->crcCfg.pfCallback != NULL)
+        {
+            pCrcData->crcCfg.pfCallback(pCrcData->crcCfg.pCBData);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_ResetHw
+ */
+ADI_CRC_RESULT adi_crc_ResetHw(ADI_CRC_HANDLE hCrc)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if (hCrc == NULL)
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else
+    {
+        if (pCrcData->isBusy && (pCrcData->hwCfg.pfAbort != NULL))
+        {
+            pCrcData->hwCfg.pfAbort(pCrcData->hwCfg.hUser);
+        }
+        pCrcData->isBusy = false;
+        pCrcData->isStreaming = false;
+        pCrcData->crcValue = 0;
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_HwCallback
+ */
+void adi_crc_HwCallback(ADI_CRC_HANDLE hCrc, uint32_t crc)
+{
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    /* Ignore completions of transfers that were reset */
+    if ((hCrc != NULL) && pCrcData->isBusy)
+    {
+        if (pCrcData->isStreaming)
+        {
+            pCrcData->crcValue = crc;
+        }
+        else
+        {
+            pCrcData->crcValue = CrcFinalize(pCrcData, crc);
+        }
+        pCrcData->isBusy = false;
+        if (pCrcData->crcCfg.pfCallback != NULL)
+        {
+            pCrcData->crcCfg.pfCallback(pCrcData->crcCfg.pCBData);
+        }
+    }
+}
+
+/**
+ * \ref CrcStartHw
+ */
+static ADI_CRC_RESULT CrcStartHw(ADI_CRC_DATA *pData, const uint8_t *pBuff, uint32_t numBytes,
+                                 bool restart)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+
+    /* Set before starting, the unit may complete before pfStart returns */
+    pData->isBusy = true;
+    if (pData->hwCfg.pfStart(pData->hwCfg.hUser, pBuff, numBytes, restart) != 0)
+    {
+        pData->isBusy = false;
+        status = ADI_CRC_RESULT_RUN_TIME_ERROR;
+    }
+
+    return status;
+}
+
+/**
+ * @}
+ */
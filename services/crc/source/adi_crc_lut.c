@@ -10,10 +10,18 @@
  */
 
 /*=============  I N C L U D E S   =============*/
+#include "adi_crc_private.h"
 #include "adi_crc_sw.h"
 #include <stdint.h>
 #include <string.h>
 
+/*============= D E F I N E S =============*/
+
+/** Number of look up tables used by slicing-by-4 */
+#define CRC_SLICE4_NUM_TABLES 4u
+/** Number of look up tables used by slicing-by-8 */
+#define CRC_SLICE8_NUM_TABLES 8u
+
 /*============= F U N C T I O N S =============*/
 /**
  * @brief Assign CRC configuration parameters.
@@ -33,26 +41,170 @@ static void Crc16InitTable8Bit(ADI_CRC_DATA *pData);
 static void Crc8InitTable8Bit(ADI_CRC_DATA *pData);
 
 /**
- * @brief Function to calculate CRC-16
+ * @brief Function to initialize CRC32 table, reflected if configured.
+ */
+static void Crc32InitTable8Bit(ADI_CRC_DATA *pData);
+
+/**
+ * @brief Function to initialize reflected CRC8 and CRC16 tables
+ * @param pData         - Pointer to CRC data.
+ * @param numBits       - Width of the CRC.
+ */
+static void CrcReflectedInitTable8Bit(ADI_CRC_DATA *pData, uint32_t numBits);
+
+/**
+ * @brief Function to derive the slicing tables from the 8 bit table. Table k holds the CRC of
+ * byte i followed by k zero bytes.
+ * @param pData         - Pointer to CRC data.
+ * @param numTables     - Number of tables including the 8 bit table.
+ * @param pfKernel      - 8 bit table kernel of the configuration.
+ */
+static void CrcInitSliceTables(ADI_CRC_DATA *pData, uint32_t numTables,
+                               ADI_CRC_KERNEL_FUNC pfKernel);
+
+/**
+ * @brief Function to derive the 16 bit indexed table from the 8 bit table. The first 256
+ * entries of the table are the 8 bit table.
+ * @param pData         - Pointer to CRC data.
+ * @param pfKernel      - 8 bit table kernel of the configuration.
+ */
+static void CrcInitTable16Bit(ADI_CRC_DATA *pData, ADI_CRC_KERNEL_FUNC pfKernel);
+
+/**
+ * @brief Function to read a look up table entry of either entry size.
+ * @param pData         - Pointer to CRC data.
+ * @param index         - Index of the entry.
+ * @return - Returns the entry
+ */
+static uint32_t CrcGetEntry(const ADI_CRC_DATA *pData, uint32_t index);
+
+/**
+ * @brief Function to write a look up table entry of either entry size.
+ * @param pData         - Pointer to CRC data.
+ * @param index         - Index of the entry.
+ * @param value         - Value of the entry.
+ */
+static void CrcSetEntry(ADI_CRC_DATA *pData, uint32_t index, uint32_t value);
+
+/**
+ * @brief Function to find the constant table of the configuration.
+ * @param pConfig       - Pointer to the configuration.
+ * @return - Returns the table or NULL if there is no constant table for the polynomial
+ */
+static const void *CrcFindConstTable(const ADI_CRC_CONFIG *pConfig);
+
+/**
+ * @brief Function to calculate the CRC with the kernel of the configured engine.
  * @param hCrc          - Handle to the library instance.
  * @param pBuff         - Pointer to buffer
  * @param numBytes      - Number of bytes in the buffer
  * @param offset        - offset in the buffer to data to calculate CRC
  * @return - Returns calculated CRC
  */
-static uint32_t Crc16CalcLUT8Bit(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
-                                 uint16_t offset);
+static uint32_t CrcCalcTable(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
+                             uint16_t offset);
 
 /**
- * @brief Function to calculate CRC-8.
+ * @brief CRC-16 kernels. Update the CRC register with the bytes in the buffer.
  * @param hCrc          - Handle to the library instance.
+ * @param crc           - CRC register.
  * @param pBuff         - Pointer to buffer
  * @param numBytes      - Number of bytes in the buffer
- * @param offset        - offset in the buffer to data to calculate CRC
- * @return - Returns calculated CRC
+ * @return - Returns updated CRC register
+ */
+static uint32_t Crc16UpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                   uint32_t numBytes);
+/** @copydoc Crc16UpdateLUT8Bit */
+static uint32_t Crc16UpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes);
+/** @copydoc Crc16UpdateLUT8Bit */
+static uint32_t Crc16UpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes);
+/** @copydoc Crc16UpdateLUT8Bit */
+static uint32_t Crc16UpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                    uint32_t numBytes);
+
+/**
+ * @brief CRC-8 kernels. Update the CRC register with the bytes in the buffer.
+ * @param hCrc          - Handle to the library instance.
+ * @param crc           - CRC register.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @return - Returns updated CRC register
+ */
+static uint32_t Crc8UpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes);
+/** @copydoc Crc8UpdateLUT8Bit */
+static uint32_t Crc8UpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                 uint32_t numBytes);
+/** @copydoc Crc8UpdateLUT8Bit */
+static uint32_t Crc8UpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                 uint32_t numBytes);
+/** @copydoc Crc8UpdateLUT8Bit */
+static uint32_t Crc8UpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                   uint32_t numBytes);
+
+/**
+ * @brief Reflected CRC-8 and CRC-16 kernels. Update the reflected CRC register with the bytes in
+ * the buffer. The kernels do not depend on the width as the register is shifted right.
+ * @param hCrc          - Handle to the library instance.
+ * @param crc           - Reflected CRC register.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @return - Returns updated CRC register
+ */
+static uint32_t Crc16ReflectedUpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                            const uint8_t *pBuff, uint32_t numBytes);
+/** @copydoc Crc16ReflectedUpdateLUT8Bit */
+static uint32_t Crc16ReflectedUpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes);
+/** @copydoc Crc16ReflectedUpdateLUT8Bit */
+static uint32_t Crc16ReflectedUpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes);
+/** @copydoc Crc16ReflectedUpdateLUT8Bit */
+static uint32_t Crc16ReflectedUpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                             const uint8_t *pBuff, uint32_t numBytes);
+
+/**
+ * @brief CRC-32 kernels. Update the CRC register with the bytes in the buffer.
+ * @param hCrc          - Handle to the library instance.
+ * @param crc           - CRC register.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @return - Returns updated CRC register
+ */
+static uint32_t Crc32UpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                   uint32_t numBytes);
+/** @copydoc Crc32UpdateLUT8Bit */
+static uint32_t Crc32UpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes);
+/** @copydoc Crc32UpdateLUT8Bit */
+static uint32_t Crc32UpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes);
+/** @copydoc Crc32UpdateLUT8Bit */
+static uint32_t Crc32UpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                    uint32_t numBytes);
+
+/**
+ * @brief Reflected CRC-32 kernels. Update the reflected CRC register with the bytes in the
+ * buffer.
+ * @param hCrc          - Handle to the library instance.
+ * @param crc           - Reflected CRC register.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @return - Returns updated CRC register
  */
-static uint32_t Crc8CalcLUT8Bit(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
-                                uint16_t offset);
+static uint32_t Crc32ReflectedUpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                            const uint8_t *pBuff, uint32_t numBytes);
+/** @copydoc Crc32ReflectedUpdateLUT8Bit */
+static uint32_t Crc32ReflectedUpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes);
+/** @copydoc Crc32ReflectedUpdateLUT8Bit */
+static uint32_t Crc32ReflectedUpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes);
+/** @copydoc Crc32ReflectedUpdateLUT8Bit */
+static uint32_t Crc32ReflectedUpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                             const uint8_t *pBuff, uint32_t numBytes);
 /*=============  C O D E  =============*/
 /**
  * \ref adi_crc_OpenSw
@@ -61,7 +213,7 @@ ADI_CRC_RESULT adi_crc_OpenSw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_
 {
     ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
     ADI_CRC_DATA *pCrcData = NULL;
-    uint32_t reqSize = sizeof(ADI_CRC_DATA) + LOOK_UP_TABLE_SIZE * 2;
+    uint32_t reqSize = sizeof(ADI_CRC_DATA);
 
     /* Check the given pointers before we set their contents */
     if ((phCrc == (void *)NULL) || (pStateMemory == (void *)NULL))
@@ -81,14 +233,17 @@ ADI_CRC_RESULT adi_crc_OpenSw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_
         {
             pCrcData = (ADI_CRC_DATA *)pStateMemory;
             memset(pCrcData, 0, sizeof(ADI_CRC_DATA));
-            pCrcData->pfReset = NULL;
+            pCrcData->pfReset = adi_crc_ResetSw;
+            pCrcData->pfUpdate = adi_crc_UpdateSw;
+            pCrcData->pfFinalize = adi_crc_FinalizeSw;
             pCrcData->pfCalc = (ADI_CRC_CALC_API_FUNC)adi_crc_CalculateSw;
             pCrcData->pfConfig = adi_crc_SetConfigSw;
             pCrcData->pfGetCrc = adi_crc_GetCrcSw;
 
-            pCrcData->pLookUpTable = (uint16_t *)pStateMemory;
-            // Moving look up table to end of CrcData struct
-            pCrcData->pLookUpTable = &pCrcData->pLookUpTable[sizeof(ADI_CRC_DATA) / 2];
+            // Tables built at run time are placed at the end of CrcData struct
+            pCrcData->pTableMemory = (uint8_t *)pStateMemory + sizeof(ADI_CRC_DATA);
+
+            pCrcData->lookUpTableSize = stateMemorySize - sizeof(ADI_CRC_DATA);
 
             *phCrc = (ADI_CRC_HANDLE *)pCrcData;
         }
@@ -112,6 +267,7 @@ ADI_CRC_RESULT adi_crc_SetConfigSw(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFIG *pConfig)
     else
     {
         memcpy(&pCrcData->crcCfg, pConfig, sizeof(pCrcData->crcCfg));
+        pCrcData->isStreaming = false;
         status = CrcSetConfig(pCrcData);
     }
 
@@ -131,8 +287,13 @@ ADI_CRC_RESULT adi_crc_CalculateSw(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint32_t
     {
         status = ADI_CRC_RESULT_NULL_PTR;
     }
+    else if (pCrcData->pFunc == NULL)
+    {
+        status = ADI_CRC_RESULT_INIT_FAILURE;
+    }
     else
     {
+        pCrcData->isStreaming = false;
         pCrcData->crcValue = pCrcData->pFunc(hCrc, pData, numBytes, offset);
         if (pCrcData->crcCfg.pfCallback != NULL)
         {
@@ -158,8 +319,100 @@ ADI_CRC_RESULT adi_crc_GetCrcSw(ADI_CRC_HANDLE hCrc, uint32_t *pData)
     else
     {
         pCrcData = (ADI_CRC_DATA *)hCrc;
-        // Get CRC result
+        if (pCrcData->isStreaming)
+        {
+            /* crcValue holds the partial register until the stream is finalized */
+            status = ADI_CRC_RESULT_NOT_READY;
+        }
+        else
+        {
+            // Get CRC result
+            *pData = pCrcData->crcValue;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_UpdateSw
+ */
+ADI_CRC_RESULT adi_crc_UpdateSw(ADI_CRC_HANDLE hCrc, const uint8_t *pData, uint32_t numBytes)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || ((pData == NULL) && (numBytes > 0)))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->pfKernel == NULL)
+    {
+        status = ADI_CRC_RESULT_INIT_FAILURE;
+    }
+    else
+    {
+        if (!pCrcData->isStreaming)
+        {
+            pCrcData->crcValue = pCrcData->initialCrc;
+            pCrcData->isStreaming = true;
+        }
+        pCrcData->crcValue = pCrcData->pfKernel(hCrc, pCrcData->crcValue, pData, numBytes);
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_FinalizeSw
+ */
+ADI_CRC_RESULT adi_crc_FinalizeSw(ADI_CRC_HANDLE hCrc, uint32_t *pData)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || (pData == NULL))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->pfKernel == NULL)
+    {
+        status = ADI_CRC_RESULT_INIT_FAILURE;
+    }
+    else
+    {
+        if (!pCrcData->isStreaming)
+        {
+            pCrcData->crcValue = pCrcData->initialCrc;
+        }
+        pCrcData->isStreaming = false;
+        pCrcData->crcValue = CrcFinalize(pCrcData, pCrcData->crcValue);
         *pData = pCrcData->crcValue;
+        if (pCrcData->crcCfg.pfCallback != NULL)
+        {
+            pCrcData->crcCfg.pfCallback(pCrcData->crcCfg.pCBData);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_ResetSw
+ */
+ADI_CRC_RESULT adi_crc_ResetSw(ADI_CRC_HANDLE hCrc)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if (hCrc == NULL)
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else
+    {
+        pCrcData->isStreaming = false;
+        pCrcData->crcValue = 0;
     }
 
     return status;
@@ -171,25 +424,153 @@ ADI_CRC_RESULT adi_crc_GetCrcSw(ADI_CRC_HANDLE hCrc, uint32_t *pData)
 static ADI_CRC_RESULT CrcSetConfig(ADI_CRC_DATA *pData)
 {
     ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    uint32_t numEntries = LOOK_UP_TABLE_SIZE;
+    uint32_t entrySize = sizeof(uint16_t);
+    const ADI_CRC_KERNEL_FUNC *pKernels = NULL;
+    /* Kernels indexed by engine */
+    static const ADI_CRC_KERNEL_FUNC crc16Kernels[] = {Crc16UpdateLUT8Bit, Crc16UpdateSlice4,
+                                                       Crc16UpdateSlice8, Crc16UpdateLUT16Bit};
+    static const ADI_CRC_KERNEL_FUNC crc8Kernels[] = {Crc8UpdateLUT8Bit, Crc8UpdateSlice4,
+                                                      Crc8UpdateSlice8, Crc8UpdateLUT16Bit};
+    static const ADI_CRC_KERNEL_FUNC crc32Kernels[] = {Crc32UpdateLUT8Bit, Crc32UpdateSlice4,
+                                                       Crc32UpdateSlice8, Crc32UpdateLUT16Bit};
+    static const ADI_CRC_KERNEL_FUNC crc16ReflectedKernels[] = {
+        Crc16ReflectedUpdateLUT8Bit, Crc16ReflectedUpdateSlice4, Crc16ReflectedUpdateSlice8,
+        Crc16ReflectedUpdateLUT16Bit};
+    static const ADI_CRC_KERNEL_FUNC crc32ReflectedKernels[] = {
+        Crc32ReflectedUpdateLUT8Bit, Crc32ReflectedUpdateSlice4, Crc32ReflectedUpdateSlice8,
+        Crc32ReflectedUpdateLUT16Bit};
+
+    pData->pFunc = NULL;
+    pData->pfKernel = NULL;
+    pData->initialCrc = CrcGetInitialRegister(&pData->crcCfg);
 
     switch (pData->crcCfg.crcType)
     {
     case ADI_CRC_TYPE_CRC16:
-        Crc16InitTable8Bit(pData);
-        pData->pFunc = Crc16CalcLUT8Bit;
+        pKernels = crc16Kernels;
+        if (pData->crcCfg.reversed)
+        {
+            pKernels = crc16ReflectedKernels;
+        }
         break;
     case ADI_CRC_TYPE_CRC8:
-        Crc8InitTable8Bit(pData);
-        pData->pFunc = Crc8CalcLUT8Bit;
+        pKernels = crc8Kernels;
+        if (pData->crcCfg.reversed)
+        {
+            pKernels = crc16ReflectedKernels;
+        }
         break;
     case ADI_CRC_TYPE_CRC32:
+        entrySize = sizeof(uint32_t);
+        pKernels = crc32Kernels;
+        if (pData->crcCfg.reversed)
+        {
+            pKernels = crc32ReflectedKernels;
+        }
+        break;
+    default:
+        status = ADI_CRC_RESULT_FAILURE;
+        break;
+    }
+
+    switch (pData->crcCfg.engine)
+    {
+    case ADI_CRC_ENGINE_LUT8:
+        break;
+    case ADI_CRC_ENGINE_SLICE4:
+        numEntries = CRC_SLICE4_NUM_TABLES * LOOK_UP_TABLE_SIZE;
+        break;
+    case ADI_CRC_ENGINE_SLICE8:
+        numEntries = CRC_SLICE8_NUM_TABLES * LOOK_UP_TABLE_SIZE;
+        break;
+    case ADI_CRC_ENGINE_LUT16:
+        numEntries = LOOK_UP_TABLE_16BIT_SIZE;
+        break;
+    default:
         status = ADI_CRC_RESULT_FAILURE;
         break;
     }
+    pData->pLookUpTable = NULL;
+    if ((status == ADI_CRC_RESULT_SUCCESS) && (pData->crcCfg.engine == ADI_CRC_ENGINE_LUT8))
+    {
+        pData->pLookUpTable = CrcFindConstTable(&pData->crcCfg);
+    }
+    if ((status == ADI_CRC_RESULT_SUCCESS) && (pData->pLookUpTable == NULL) &&
+        ((numEntries * entrySize) > pData->lookUpTableSize))
+    {
+        status = ADI_CRC_RESULT_INSUFFICIENT_MEMORY;
+    }
+
+    if ((status == ADI_CRC_RESULT_SUCCESS) && (pData->pLookUpTable == NULL))
+    {
+        pData->pLookUpTable = pData->pTableMemory;
+        switch (pData->crcCfg.crcType)
+        {
+        case ADI_CRC_TYPE_CRC16:
+            if (pData->crcCfg.reversed)
+            {
+                CrcReflectedInitTable8Bit(pData, 16);
+            }
+            else
+            {
+                Crc16InitTable8Bit(pData);
+            }
+            break;
+        case ADI_CRC_TYPE_CRC8:
+            if (pData->crcCfg.reversed)
+            {
+                CrcReflectedInitTable8Bit(pData, 8);
+            }
+            else
+            {
+                Crc8InitTable8Bit(pData);
+            }
+            break;
+        default:
+            Crc32InitTable8Bit(pData);
+            break;
+        }
+        if (pData->crcCfg.engine == ADI_CRC_ENGINE_LUT16)
+        {
+            CrcInitTable16Bit(pData, pKernels[ADI_CRC_ENGINE_LUT8]);
+        }
+        else
+        {
+            CrcInitSliceTables(pData, numEntries / LOOK_UP_TABLE_SIZE,
+                               pKernels[ADI_CRC_ENGINE_LUT8]);
+        }
+    }
+    if (status == ADI_CRC_RESULT_SUCCESS)
+    {
+        pData->pfKernel = pKernels[pData->crcCfg.engine];
+        pData->pFunc = CrcCalcTable;
+    }
 
     return status;
 }
 
+/**
+ * \ref CrcFindConstTable
+ */
+static const void *CrcFindConstTable(const ADI_CRC_CONFIG *pConfig)
+{
+    const void *pTable = NULL;
+    uint32_t i;
+
+    for (i = 0; (i < crcNumConstTables) && (pTable == NULL); i++)
+    {
+        if ((crcConstTables[i].crcType == pConfig->crcType) &&
+            (crcConstTables[i].reversed == pConfig->reversed) &&
+            (crcConstTables[i].poly == pConfig->poly))
+        {
+            pTable = crcConstTables[i].pTable;
+        }
+    }
+
+    return pTable;
+}
+
 /**
  * \ref Crc16InitTable8Bit
  */
@@ -219,7 +600,7 @@ static void Crc16InitTable8Bit(ADI_CRC_DATA *pData)
             checkSum ^= currPoly;
         }
         /* Add entry to LUT */
-        pData->pLookUpTable[i] = checkSum;
+        ((uint16_t *)pData->pTableMemory)[i] = checkSum;
     }
 }
 
@@ -251,51 +632,620 @@ static void Crc8InitTable8Bit(ADI_CRC_DATA *pData)
             checkSum ^= currPoly;
         }
         /* Add entry to LUT */
-        pData->pLookUpTable[i] = checkSum;
+        ((uint16_t *)pData->pTableMemory)[i] = checkSum;
+    }
+}
+
+/**
+ * \ref Crc32InitTable8Bit
+ */
+static void Crc32InitTable8Bit(ADI_CRC_DATA *pData)
+{
+    uint32_t *pTable = (uint32_t *)pData->pTableMemory;
+    uint32_t checkSum;
+    uint32_t i, j;
+    uint32_t poly = pData->crcCfg.poly;
+
+    if (pData->crcCfg.reversed)
+    {
+        poly = CrcReflect(poly, 32);
+        for (i = 0; i < 256; i++)
+        {
+            checkSum = i;
+            for (j = 0; j < 8; j++)
+            {
+                /* Shift out the LSB and XOR the reflected polynomial */
+                checkSum = (checkSum & 1u) ? ((checkSum >> 1) ^ poly) : (checkSum >> 1);
+            }
+            pTable[i] = checkSum;
+        }
+    }
+    else
+    {
+        for (i = 0; i < 256; i++)
+        {
+            checkSum = i << 24;
+            for (j = 0; j < 8; j++)
+            {
+                /* Shift out the MSB and XOR the polynomial */
+                checkSum = (checkSum & (1u << 31)) ? ((checkSum << 1) ^ poly) : (checkSum << 1);
+            }
+            pTable[i] = checkSum;
+        }
+    }
+}
+
+/**
+ * \ref CrcReflectedInitTable8Bit
+ */
+static void CrcReflectedInitTable8Bit(ADI_CRC_DATA *pData, uint32_t numBits)
+{
+    uint16_t *pTable = (uint16_t *)pData->pTableMemory;
+    uint16_t poly = (uint16_t)CrcReflect(pData->crcCfg.poly, numBits);
+    uint16_t checkSum;
+    uint32_t i, j;
+
+    for (i = 0; i < 256; i++)
+    {
+        checkSum = (uint16_t)i;
+        for (j = 0; j < 8; j++)
+        {
+            /* Shift out the LSB and XOR the reflected polynomial */
+            checkSum = (checkSum & 1u) ? (uint16_t)((checkSum >> 1) ^ poly) : (checkSum >> 1);
+        }
+        pTable[i] = checkSum;
+    }
+}
+
+/**
+ * \ref CrcInitSliceTables
+ */
+static void CrcInitSliceTables(ADI_CRC_DATA *pData, uint32_t numTables,
+                               ADI_CRC_KERNEL_FUNC pfKernel)
+{
+    static const uint8_t zero = 0;
+    uint32_t prev;
+    uint32_t i, k;
+
+    for (k = 1; k < numTables; k++)
+    {
+        for (i = 0; i < LOOK_UP_TABLE_SIZE; i++)
+        {
+            /* Append one zero byte to the entry of the previous table */
+            prev = CrcGetEntry(pData, ((k - 1) * LOOK_UP_TABLE_SIZE) + i);
+            CrcSetEntry(pData, (k * LOOK_UP_TABLE_SIZE) + i, pfKernel(pData, prev, &zero, 1));
+        }
+    }
+}
+
+/**
+ * \ref CrcInitTable16Bit
+ */
+static void CrcInitTable16Bit(ADI_CRC_DATA *pData, ADI_CRC_KERNEL_FUNC pfKernel)
+{
+    static const uint8_t zero = 0;
+    uint32_t high;
+    uint32_t i, j;
+
+    /* Row 0 is the 8 bit table. Entry (i << 8 | j) is the CRC of byte i followed by byte j,
+     * which is the CRC of byte i followed by a zero byte XOR the 8 bit table entry of j. */
+    for (i = 1; i < LOOK_UP_TABLE_SIZE; i++)
+    {
+        high = pfKernel(pData, CrcGetEntry(pData, i), &zero, 1);
+        for (j = 0; j < LOOK_UP_TABLE_SIZE; j++)
+        {
+            CrcSetEntry(pData, (i << 8) | j, high ^ CrcGetEntry(pData, j));
+        }
+    }
+}
+
+/**
+ * \ref CrcGetEntry
+ */
+static uint32_t CrcGetEntry(const ADI_CRC_DATA *pData, uint32_t index)
+{
+    uint32_t entry;
+
+    if (pData->crcCfg.crcType == ADI_CRC_TYPE_CRC32)
+    {
+        entry = ((const uint32_t *)pData->pLookUpTable)[index];
+    }
+    else
+    {
+        entry = ((const uint16_t *)pData->pLookUpTable)[index];
+    }
+
+    return entry;
+}
+
+/**
+ * \ref CrcSetEntry
+ */
+static void CrcSetEntry(ADI_CRC_DATA *pData, uint32_t index, uint32_t value)
+{
+    if (pData->crcCfg.crcType == ADI_CRC_TYPE_CRC32)
+    {
+        ((uint32_t *)pData->pTableMemory)[index] = value;
+    }
+    else
+    {
+        ((uint16_t *)pData->pTableMemory)[index] = (uint16_t)value;
     }
 }
 
+
+/**
+ * \ref CrcCalcTable
+ */
+static uint32_t CrcCalcTable(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
+                             uint16_t offset)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    uint32_t checksum;
+
+    checksum = pData->pfKernel(hCrc, pData->initialCrc, &pBuff[offset], numBytes);
+
+    return CrcFinalize(pData, checksum);
+}
+
+
 /**
  * @brief CRC configuration using a 512 bytes LUT with 8 bit inputs.
  *        The function calculates the 512 bytes (8 bit word) LUT based CRC
  * value.
  */
-static uint32_t Crc16CalcLUT8Bit(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
-                                 uint16_t offset)
+static uint32_t Crc16UpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                   uint32_t numBytes)
 {
     ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
-    uint16_t checksum = (uint16_t)pData->crcCfg.seed;
-    uint16_t finalXorValue = (uint16_t)pData->crcCfg.xorOut;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
     uint16_t byte;
     uint32_t i;
 
-    for (i = offset; i < (uint32_t)(offset + numBytes); i++)
+    for (i = 0; i < numBytes; i++)
     {
         byte = (uint16_t)(pBuff[i] ^ (checksum >> 8));
-        checksum = (uint16_t)(pData->pLookUpTable[byte] ^ ((uint16_t)(checksum << 8)));
+        checksum = (uint16_t)(pTable[byte] ^ ((uint16_t)(checksum << 8)));
+    }
+
+    return (uint32_t)checksum;
+}
+
+/**
+ * @brief Slicing-by-4. The CRC register is folded into the first two bytes of each 4 byte
+ *        block, so the four lookups of a block are independent of each other.
+ */
+static uint32_t Crc16UpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
+
+    while (numBytes >= 4)
+    {
+        checksum = (uint16_t)(pTable[(3 * LOOK_UP_TABLE_SIZE) + (pBuff[0] ^ (checksum >> 8))] ^
+                              pTable[(2 * LOOK_UP_TABLE_SIZE) + (pBuff[1] ^ (checksum & 0xFFu))] ^
+                              pTable[LOOK_UP_TABLE_SIZE + pBuff[2]] ^ pTable[pBuff[3]]);
+        pBuff += 4;
+        numBytes -= 4;
     }
 
-    return (uint32_t)(checksum ^ finalXorValue);
+    return Crc16UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
 }
 
 /**
- * \ref Crc8CalcLUT8Bit
+ * @brief Slicing-by-8, same as \ref Crc16UpdateSlice4 with 8 byte blocks.
  */
-static uint32_t Crc8CalcLUT8Bit(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
-                                uint16_t offset)
+static uint32_t Crc16UpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes)
 {
     ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
-    uint8_t checksum = (uint8_t)pData->crcCfg.seed;
-    uint8_t finalXorValue = (uint8_t)pData->crcCfg.xorOut;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
+
+    while (numBytes >= 8)
+    {
+        checksum = (uint16_t)(pTable[(7 * LOOK_UP_TABLE_SIZE) + (pBuff[0] ^ (checksum >> 8))] ^
+                              pTable[(6 * LOOK_UP_TABLE_SIZE) + (pBuff[1] ^ (checksum & 0xFFu))] ^
+                              pTable[(5 * LOOK_UP_TABLE_SIZE) + pBuff[2]] ^
+                              pTable[(4 * LOOK_UP_TABLE_SIZE) + pBuff[3]] ^
+                              pTable[(3 * LOOK_UP_TABLE_SIZE) + pBuff[4]] ^
+                              pTable[(2 * LOOK_UP_TABLE_SIZE) + pBuff[5]] ^
+                              pTable[LOOK_UP_TABLE_SIZE + pBuff[6]] ^ pTable[pBuff[7]]);
+        pBuff += 8;
+        numBytes -= 8;
+    }
+
+    return Crc16UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief 16 bit indexed table, one lookup per 2 bytes.
+ */
+static uint32_t Crc16UpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                    uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
+
+    while (numBytes >= 2)
+    {
+        checksum = pTable[(uint16_t)(((uint16_t)(pBuff[0] << 8) | pBuff[1]) ^ checksum)];
+        pBuff += 2;
+        numBytes -= 2;
+    }
+
+    return Crc16UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * \ref Crc8UpdateLUT8Bit
+ */
+static uint32_t Crc8UpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint8_t checksum = (uint8_t)crc;
     uint8_t byte;
     uint32_t i;
 
-    for (i = offset; i < (uint32_t)(offset + numBytes); i++)
+    for (i = 0; i < numBytes; i++)
     {
         byte = (uint8_t)(pBuff[i] ^ (checksum));
-        checksum = (uint8_t)(pData->pLookUpTable[byte] ^ ((uint16_t)(checksum << 8)));
+        checksum = (uint8_t)(pTable[byte]);
+    }
+    return (uint32_t)checksum;
+}
+
+/**
+ * @brief Slicing-by-4. The CRC register is folded into the first byte of each 4 byte block.
+ */
+static uint32_t Crc8UpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                 uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint8_t checksum = (uint8_t)crc;
+
+    while (numBytes >= 4)
+    {
+        checksum = (uint8_t)(pTable[(3 * LOOK_UP_TABLE_SIZE) + (uint8_t)(pBuff[0] ^ checksum)] ^
+                             pTable[(2 * LOOK_UP_TABLE_SIZE) + pBuff[1]] ^
+                             pTable[LOOK_UP_TABLE_SIZE + pBuff[2]] ^ pTable[pBuff[3]]);
+        pBuff += 4;
+        numBytes -= 4;
+    }
+
+    return Crc8UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief Slicing-by-8, same as \ref Crc8UpdateSlice4 with 8 byte blocks.
+ */
+static uint32_t Crc8UpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                 uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint8_t checksum = (uint8_t)crc;
+
+    while (numBytes >= 8)
+    {
+        checksum = (uint8_t)(pTable[(7 * LOOK_UP_TABLE_SIZE) + (uint8_t)(pBuff[0] ^ checksum)] ^
+                             pTable[(6 * LOOK_UP_TABLE_SIZE) + pBuff[1]] ^
+                             pTable[(5 * LOOK_UP_TABLE_SIZE) + pBuff[2]] ^
+                             pTable[(4 * LOOK_UP_TABLE_SIZE) + pBuff[3]] ^
+                             pTable[(3 * LOOK_UP_TABLE_SIZE) + pBuff[4]] ^
+                             pTable[(2 * LOOK_UP_TABLE_SIZE) + pBuff[5]] ^
+                             pTable[LOOK_UP_TABLE_SIZE + pBuff[6]] ^ pTable[pBuff[7]]);
+        pBuff += 8;
+        numBytes -= 8;
+    }
+
+    return Crc8UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief 16 bit indexed table, one lookup per 2 bytes.
+ */
+static uint32_t Crc8UpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                   uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint8_t checksum = (uint8_t)crc;
+
+    while (numBytes >= 2)
+    {
+        checksum = (uint8_t)pTable[((uint16_t)((uint8_t)(pBuff[0] ^ checksum)) << 8) | pBuff[1]];
+        pBuff += 2;
+        numBytes -= 2;
+    }
+
+    return Crc8UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * \ref Crc16ReflectedUpdateLUT8Bit
+ */
+static uint32_t Crc16ReflectedUpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                            const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
+    uint32_t i;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        checksum = (uint16_t)(pTable[(checksum ^ pBuff[i]) & 0xFFu] ^ (checksum >> 8));
+    }
+
+    return (uint32_t)checksum;
+}
+
+/**
+ * @brief Reflected slicing-by-4. The register is folded into the first two bytes of a block.
+ */
+static uint32_t Crc16ReflectedUpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
+
+    while (numBytes >= 4)
+    {
+        checksum = (uint16_t)(pTable[(3 * LOOK_UP_TABLE_SIZE) + ((checksum ^ pBuff[0]) & 0xFFu)] ^
+                              pTable[(2 * LOOK_UP_TABLE_SIZE) + ((checksum >> 8) ^ pBuff[1])] ^
+                              pTable[LOOK_UP_TABLE_SIZE + pBuff[2]] ^ pTable[pBuff[3]]);
+        pBuff += 4;
+        numBytes -= 4;
+    }
+
+    return Crc16ReflectedUpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief Reflected slicing-by-8, same as \ref Crc16ReflectedUpdateSlice4 with 8 byte blocks.
+ */
+static uint32_t Crc16ReflectedUpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
+
+    while (numBytes >= 8)
+    {
+        checksum = (uint16_t)(pTable[(7 * LOOK_UP_TABLE_SIZE) + ((checksum ^ pBuff[0]) & 0xFFu)] ^
+                              pTable[(6 * LOOK_UP_TABLE_SIZE) + ((checksum >> 8) ^ pBuff[1])] ^
+                              pTable[(5 * LOOK_UP_TABLE_SIZE) + pBuff[2]] ^
+                              pTable[(4 * LOOK_UP_TABLE_SIZE) + pBuff[3]] ^
+                              pTable[(3 * LOOK_UP_TABLE_SIZE) + pBuff[4]] ^
+                              pTable[(2 * LOOK_UP_TABLE_SIZE) + pBuff[5]] ^
+                              pTable[LOOK_UP_TABLE_SIZE + pBuff[6]] ^ pTable[pBuff[7]]);
+        pBuff += 8;
+        numBytes -= 8;
+    }
+
+    return Crc16ReflectedUpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief Reflected 16 bit indexed table, one lookup per 2 bytes. The table is indexed with the
+ *        first byte in the high byte, as for the non reflected table.
+ */
+static uint32_t Crc16ReflectedUpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                             const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint16_t *pTable = pData->pLookUpTable;
+    uint16_t checksum = (uint16_t)crc;
+    uint32_t index;
+
+    while (numBytes >= 2)
+    {
+        index = (((checksum ^ pBuff[0]) & 0xFFu) << 8) | (((checksum >> 8) ^ pBuff[1]) & 0xFFu);
+        checksum = pTable[index];
+        pBuff += 2;
+        numBytes -= 2;
     }
-    return (uint32_t)(checksum ^ finalXorValue);
+
+    return Crc16ReflectedUpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * \ref Crc32UpdateLUT8Bit
+ */
+static uint32_t Crc32UpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                   uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+    uint32_t i;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        checksum = pTable[(checksum >> 24) ^ pBuff[i]] ^ (checksum << 8);
+    }
+
+    return checksum;
+}
+
+/**
+ * @brief Slicing-by-4. The CRC register is folded into each 4 byte block, so the four lookups
+ *        of a block are independent of each other.
+ */
+static uint32_t Crc32UpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+
+    while (numBytes >= 4)
+    {
+        checksum ^= ((uint32_t)pBuff[0] << 24) | ((uint32_t)pBuff[1] << 16) |
+                    ((uint32_t)pBuff[2] << 8) | pBuff[3];
+        checksum = pTable[(3 * LOOK_UP_TABLE_SIZE) + (checksum >> 24)] ^
+                   pTable[(2 * LOOK_UP_TABLE_SIZE) + ((checksum >> 16) & 0xFFu)] ^
+                   pTable[LOOK_UP_TABLE_SIZE + ((checksum >> 8) & 0xFFu)] ^
+                   pTable[checksum & 0xFFu];
+        pBuff += 4;
+        numBytes -= 4;
+    }
+
+    return Crc32UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief Slicing-by-8, same as \ref Crc32UpdateSlice4 with 8 byte blocks.
+ */
+static uint32_t Crc32UpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                  uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+
+    while (numBytes >= 8)
+    {
+        checksum ^= ((uint32_t)pBuff[0] << 24) | ((uint32_t)pBuff[1] << 16) |
+                    ((uint32_t)pBuff[2] << 8) | pBuff[3];
+        checksum = pTable[(7 * LOOK_UP_TABLE_SIZE) + (checksum >> 24)] ^
+                   pTable[(6 * LOOK_UP_TABLE_SIZE) + ((checksum >> 16) & 0xFFu)] ^
+                   pTable[(5 * LOOK_UP_TABLE_SIZE) + ((checksum >> 8) & 0xFFu)] ^
+                   pTable[(4 * LOOK_UP_TABLE_SIZE) + (checksum & 0xFFu)] ^
+                   pTable[(3 * LOOK_UP_TABLE_SIZE) + pBuff[4]] ^
+                   pTable[(2 * LOOK_UP_TABLE_SIZE) + pBuff[5]] ^
+                   pTable[LOOK_UP_TABLE_SIZE + pBuff[6]] ^ pTable[pBuff[7]];
+        pBuff += 8;
+        numBytes -= 8;
+    }
+
+    return Crc32UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief 16 bit indexed table, one lookup per 2 bytes.
+ */
+static uint32_t Crc32UpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                    uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+
+    while (numBytes >= 2)
+    {
+        checksum = pTable[(checksum >> 16) ^ (((uint32_t)pBuff[0] << 8) | pBuff[1])] ^
+                   (checksum << 16);
+        pBuff += 2;
+        numBytes -= 2;
+    }
+
+    return Crc32UpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * \ref Crc32ReflectedUpdateLUT8Bit
+ */
+static uint32_t Crc32ReflectedUpdateLUT8Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                            const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+    uint32_t i;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        checksum = pTable[(checksum ^ pBuff[i]) & 0xFFu] ^ (checksum >> 8);
+    }
+
+    return checksum;
+}
+
+/**
+ * @brief Reflected slicing-by-4. The first byte of a block is in the low byte of the register.
+ */
+static uint32_t Crc32ReflectedUpdateSlice4(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+
+    while (numBytes >= 4)
+    {
+        checksum ^= (uint32_t)pBuff[0] | ((uint32_t)pBuff[1] << 8) | ((uint32_t)pBuff[2] << 16) |
+                    ((uint32_t)pBuff[3] << 24);
+        checksum = pTable[(3 * LOOK_UP_TABLE_SIZE) + (checksum & 0xFFu)] ^
+                   pTable[(2 * LOOK_UP_TABLE_SIZE) + ((checksum >> 8) & 0xFFu)] ^
+                   pTable[LOOK_UP_TABLE_SIZE + ((checksum >> 16) & 0xFFu)] ^
+                   pTable[checksum >> 24];
+        pBuff += 4;
+        numBytes -= 4;
+    }
+
+    return Crc32ReflectedUpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief Reflected slicing-by-8, same as \ref Crc32ReflectedUpdateSlice4 with 8 byte blocks.
+ */
+static uint32_t Crc32ReflectedUpdateSlice8(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                           const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+
+    while (numBytes >= 8)
+    {
+        checksum ^= (uint32_t)pBuff[0] | ((uint32_t)pBuff[1] << 8) | ((uint32_t)pBuff[2] << 16) |
+                    ((uint32_t)pBuff[3] << 24);
+        checksum = pTable[(7 * LOOK_UP_TABLE_SIZE) + (checksum & 0xFFu)] ^
+                   pTable[(6 * LOOK_UP_TABLE_SIZE) + ((checksum >> 8) & 0xFFu)] ^
+                   pTable[(5 * LOOK_UP_TABLE_SIZE) + ((checksum >> 16) & 0xFFu)] ^
+                   pTable[(4 * LOOK_UP_TABLE_SIZE) + (checksum >> 24)] ^
+                   pTable[(3 * LOOK_UP_TABLE_SIZE) + pBuff[4]] ^
+                   pTable[(2 * LOOK_UP_TABLE_SIZE) + pBuff[5]] ^
+                   pTable[LOOK_UP_TABLE_SIZE + pBuff[6]] ^ pTable[pBuff[7]];
+        pBuff += 8;
+        numBytes -= 8;
+    }
+
+    return Crc32ReflectedUpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
+}
+
+/**
+ * @brief Reflected 16 bit indexed table, one lookup per 2 bytes. The table is indexed with the
+ *        first byte in the high byte, as for the non reflected table.
+ */
+static uint32_t Crc32ReflectedUpdateLUT16Bit(ADI_CRC_HANDLE hCrc, uint32_t crc,
+                                             const uint8_t *pBuff, uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t checksum = crc;
+    uint32_t index;
+
+    while (numBytes >= 2)
+    {
+        index = (((checksum ^ pBuff[0]) & 0xFFu) << 8) | (((checksum >> 8) ^ pBuff[1]) & 0xFFu);
+        checksum = pTable[index] ^ (checksum >> 16);
+        pBuff += 2;
+        numBytes -= 2;
+    }
+
+    return Crc32ReflectedUpdateLUT8Bit(hCrc, checksum, pBuff, numBytes);
 }
 
 /**
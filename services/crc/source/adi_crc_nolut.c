@@ -5,18 +5,21 @@
 /**
  * @file     adi_crc_nolut.c
  * @brief    This file contains the routines for initializing and calculating
- *           software based CRC using non LUT based implementation.
+ *           software based CRC without a byte look up table. A 16 entry table
+ *           processes a nibble per step.
  * @{
  */
 
 /*=============  I N C L U D E S   =============*/
-#include "adi_crc.h"
+#include "adi_crc_private.h"
+#include "adi_crc_sw.h"
+#include <stdint.h>
 #include <string.h>
 
 /*============= D E F I N E S =============*/
 
-/** Isolate 16th bit*/
-#define MSB_SELECT (1u << 15) /* MSB_SELECT & uint16_t isolates the MSB of a 16 bit integer*/
+/** Number of entries of the nibble table */
+#define CRC_NIBBLE_TABLE_SIZE 16u
 
 /*============= F U N C T I O N S =============*/
 /**
@@ -25,26 +28,58 @@
 static ADI_CRC_RESULT CrcSetConfig(ADI_CRC_DATA *pData);
 
 /**
- * @brief Function to calculate CRC without LUT
+ * @brief Function to initialize the nibble table. Entry i holds the CRC register after shifting
+ * out nibble i, reflected if configured.
+ * @param pData         - Pointer to CRC data.
+ * @param numBits       - Width of the CRC.
+ */
+static void CrcInitNibbleTable(ADI_CRC_DATA *pData, uint32_t numBits);
+
+/**
+ * @brief Function to calculate the CRC with the kernel of the configuration.
  * @param hCrc          - Handle to the library instance.
- * @param pData         - Pointer to buffer
+ * @param pBuff         - Pointer to buffer
  * @param numBytes      - Number of bytes in the buffer
  * @param offset        - offset in the buffer to data to calculate CRC
  * @return - Returns calculated CRC
  */
-static uint32_t CRC16Calculate(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
-                               uint16_t offset);
+static uint32_t CrcCalcNibble(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
+                              uint16_t offset);
+
+/**
+ * @brief Kernels for CRC-8, CRC-16 and CRC-32. Update the CRC register with the bytes in the
+ * buffer, two nibble table lookups per byte.
+ * @param hCrc          - Handle to the library instance.
+ * @param crc           - CRC register.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @return - Returns updated CRC register
+ */
+static uint32_t CrcUpdateNibble(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                uint32_t numBytes);
+
+/**
+ * @brief Reflected kernel for CRC-8, CRC-16 and CRC-32. Updates the reflected CRC register
+ * with the bytes in the buffer. The kernel does not depend on the width as the register is
+ * shifted right.
+ * @param hCrc          - Handle to the library instance.
+ * @param crc           - Reflected CRC register.
+ * @param pBuff         - Pointer to buffer
+ * @param numBytes      - Number of bytes in the buffer
+ * @return - Returns updated CRC register
+ */
+static uint32_t CrcReflectedUpdateNibble(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                         uint32_t numBytes);
 
 /*=============  C O D E  =============*/
 /**
  * \ref adi_crc_OpenSw
  */
-ADI_CRC_RESULT adi_crc_OpenSw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_t stateMemorySize,
-                              void *pTempMemory, uint32_t tempMemorySize)
+ADI_CRC_RESULT adi_crc_OpenSw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_t stateMemorySize)
 {
     ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
     ADI_CRC_DATA *pCrcData = NULL;
-    uint32_t reqSize = sizeof(ADI_CRC_DATA);
+    uint32_t reqSize = ADI_CRC_SW_NOLUT_STATE_MEM_NUM_BYTES;
 
     /* Check the given pointers before we set their contents */
     if (phCrc == ((void *)NULL) || (pStateMemory == (void *)NULL))
@@ -65,13 +100,21 @@ ADI_CRC_RESULT adi_crc_OpenSw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_
         {
             pCrcData = (ADI_CRC_DATA *)pStateMemory;
             memset(pCrcData, 0, sizeof(ADI_CRC_DATA));
+            pCrcData->pfReset = adi_crc_ResetSw;
+            pCrcData->pfUpdate = adi_crc_UpdateSw;
+            pCrcData->pfFinalize = adi_crc_FinalizeSw;
+            pCrcData->pfCalc = (ADI_CRC_CALC_API_FUNC)adi_crc_CalculateSw;
+            pCrcData->pfConfig = adi_crc_SetConfigSw;
+            pCrcData->pfGetCrc = adi_crc_GetCrcSw;
+
+            // Nibble table is placed at the end of CrcData struct
+            pCrcData->pTableMemory = (uint8_t *)pStateMemory + sizeof(ADI_CRC_DATA);
+            pCrcData->pLookUpTable = pCrcData->pTableMemory;
+            pCrcData->lookUpTableSize = stateMemorySize - sizeof(ADI_CRC_DATA);
+
+            *phCrc = (ADI_CRC_HANDLE *)pCrcData;
         }
     }
-    if (status == ADI_CRC_RESULT_SUCCESS)
-    {
-        *phCrc = (ADI_CRC_HANDLE *)pCrcData;
-        CrcSetConfig(pCrcData);
-    }
 
     return status;
 }
@@ -82,6 +125,7 @@ ADI_CRC_RESULT adi_crc_OpenSw(ADI_CRC_HANDLE *phCrc, void *pStateMemory, uint32_
 ADI_CRC_RESULT adi_crc_SetConfigSw(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFIG *pConfig)
 {
     ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+
     ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
 
     if ((hCrc == NULL) || (pConfig == NULL))
@@ -91,7 +135,8 @@ ADI_CRC_RESULT adi_crc_SetConfigSw(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFIG *pConfig)
     else
     {
         memcpy(&pCrcData->crcCfg, pConfig, sizeof(pCrcData->crcCfg));
-        CrcSetConfig(pCrcData);
+        pCrcData->isStreaming = false;
+        status = CrcSetConfig(pCrcData);
     }
 
     return status;
@@ -100,20 +145,28 @@ ADI_CRC_RESULT adi_crc_SetConfigSw(ADI_CRC_HANDLE hCrc, ADI_CRC_CONFIG *pConfig)
 /**
  * \ref adi_crc_CalculateSw
  */
-ADI_CRC_RESULT adi_crc_CalculateSw(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint16_t numBytes,
+ADI_CRC_RESULT adi_crc_CalculateSw(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint32_t numBytes,
                                    uint16_t offset)
 {
     ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
-    ADI_CRC_DATA *pCrcData = NULL;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
 
     if (hCrc == NULL)
     {
         status = ADI_CRC_RESULT_NULL_PTR;
     }
+    else if (pCrcData->pFunc == NULL)
+    {
+        status = ADI_CRC_RESULT_INIT_FAILURE;
+    }
     else
     {
-        pCrcData = (ADI_CRC_DATA *)hCrc;
+        pCrcData->isStreaming = false;
         pCrcData->crcValue = pCrcData->pFunc(hCrc, pData, numBytes, offset);
+        if (pCrcData->crcCfg.pfCallback != NULL)
+        {
+            pCrcData->crcCfg.pfCallback(pCrcData->crcCfg.pCBData);
+        }
     }
 
     return status;
@@ -122,7 +175,7 @@ ADI_CRC_RESULT adi_crc_CalculateSw(ADI_CRC_HANDLE hCrc, uint8_t *pData, uint16_t
 /**
  * \ref adi_crc_GetCrcSw
  */
-ADI_CRC_RESULT adi_crc_GetCrcSw(ADI_CRC_HANDLE hCrc, volatile uint32_t *pData)
+ADI_CRC_RESULT adi_crc_GetCrcSw(ADI_CRC_HANDLE hCrc, uint32_t *pData)
 {
     ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
     ADI_CRC_DATA *pCrcData = NULL;
@@ -134,8 +187,100 @@ ADI_CRC_RESULT adi_crc_GetCrcSw(ADI_CRC_HANDLE hCrc, volatile uint32_t *pData)
     else
     {
         pCrcData = (ADI_CRC_DATA *)hCrc;
-        // Get CRC result
+        if (pCrcData->isStreaming)
+        {
+            /* crcValue holds the partial register until the stream is finalized */
+            status = ADI_CRC_RESULT_NOT_READY;
+        }
+        else
+        {
+            // Get CRC result
+            *pData = pCrcData->crcValue;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_UpdateSw
+ */
+ADI_CRC_RESULT adi_crc_UpdateSw(ADI_CRC_HANDLE hCrc, const uint8_t *pData, uint32_t numBytes)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || ((pData == NULL) && (numBytes > 0)))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->pfKernel == NULL)
+    {
+        status = ADI_CRC_RESULT_INIT_FAILURE;
+    }
+    else
+    {
+        if (!pCrcData->isStreaming)
+        {
+            pCrcData->crcValue = pCrcData->initialCrc;
+            pCrcData->isStreaming = true;
+        }
+        pCrcData->crcValue = pCrcData->pfKernel(hCrc, pCrcData->crcValue, pData, numBytes);
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_FinalizeSw
+ */
+ADI_CRC_RESULT adi_crc_FinalizeSw(ADI_CRC_HANDLE hCrc, uint32_t *pData)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if ((hCrc == NULL) || (pData == NULL))
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else if (pCrcData->pfKernel == NULL)
+    {
+        status = ADI_CRC_RESULT_INIT_FAILURE;
+    }
+    else
+    {
+        if (!pCrcData->isStreaming)
+        {
+            pCrcData->crcValue = pCrcData->initialCrc;
+        }
+        pCrcData->isStreaming = false;
+        pCrcData->crcValue = CrcFinalize(pCrcData, pCrcData->crcValue);
         *pData = pCrcData->crcValue;
+        if (pCrcData->crcCfg.pfCallback != NULL)
+        {
+            pCrcData->crcCfg.pfCallback(pCrcData->crcCfg.pCBData);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * \ref adi_crc_ResetSw
+ */
+ADI_CRC_RESULT adi_crc_ResetSw(ADI_CRC_HANDLE hCrc)
+{
+    ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    ADI_CRC_DATA *pCrcData = (ADI_CRC_DATA *)hCrc;
+
+    if (hCrc == NULL)
+    {
+        status = ADI_CRC_RESULT_NULL_PTR;
+    }
+    else
+    {
+        pCrcData->isStreaming = false;
+        pCrcData->crcValue = 0;
     }
 
     return status;
@@ -147,40 +292,149 @@ ADI_CRC_RESULT adi_crc_GetCrcSw(ADI_CRC_HANDLE hCrc, volatile uint32_t *pData)
 static ADI_CRC_RESULT CrcSetConfig(ADI_CRC_DATA *pData)
 {
     ADI_CRC_RESULT status = ADI_CRC_RESULT_SUCCESS;
+    uint32_t numBits = 0;
+
+    pData->pFunc = NULL;
+    pData->pfKernel = NULL;
+    pData->initialCrc = CrcGetInitialRegister(&pData->crcCfg);
 
     switch (pData->crcCfg.crcType)
     {
+    case ADI_CRC_TYPE_CRC8:
+        numBits = 8;
+        break;
     case ADI_CRC_TYPE_CRC16:
-        pData->pFunc = CRC16Calculate;
+        numBits = 16;
+        break;
+    case ADI_CRC_TYPE_CRC32:
+        numBits = 32;
         break;
     default:
         status = ADI_CRC_RESULT_FAILURE;
+        break;
+    }
+
+    if (status == ADI_CRC_RESULT_SUCCESS)
+    {
+        CrcInitNibbleTable(pData, numBits);
+        pData->pfKernel = pData->crcCfg.reversed ? CrcReflectedUpdateNibble : CrcUpdateNibble;
+        pData->pFunc = CrcCalcNibble;
     }
 
     return status;
 }
 
 /**
- * \ref CRC16Calculate
+ * \ref CrcInitNibbleTable
  */
-static uint32_t CRC16Calculate(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
-                               uint16_t offset)
+static void CrcInitNibbleTable(ADI_CRC_DATA *pData, uint32_t numBits)
 {
-    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
-    uint16_t checksum = (uint16_t)pData->crcCfg.seed;
-    uint16_t finalXorValue = (uint16_t)pData->crcCfg.xorOut;
-    uint16_t poly = (uint16_t)pData->crcCfg.poly;
-    uint32_t i;
-    uint16_t j;
-    for (i = offset; i < (uint32_t)(offset + numBytes); i++)
+    uint32_t *pTable = (uint32_t *)pData->pTableMemory;
+    uint32_t topBit = 1u << (numBits - 1u);
+    uint32_t mask = 0xFFFFFFFFu >> (32u - numBits);
+    uint32_t poly = pData->crcCfg.poly & mask;
+    uint32_t checkSum;
+    uint32_t i, j;
+
+    if (pData->crcCfg.reversed)
+    {
+        poly = CrcReflect(poly, numBits);
+        for (i = 0; i < CRC_NIBBLE_TABLE_SIZE; i++)
+        {
+            checkSum = i;
+            for (j = 0; j < 4; j++)
+            {
+                /* Shift out the LSB and XOR the reflected polynomial */
+                checkSum = (checkSum >> 1) ^ ((checkSum & 1u) * poly);
+            }
+            pTable[i] = checkSum;
+        }
+    }
+    else
     {
-        checksum ^= (uint16_t)(pBuff[i] << 8);
-        for (j = 8; j > 0; j--)
+        for (i = 0; i < CRC_NIBBLE_TABLE_SIZE; i++)
         {
-            checksum = (uint16_t)(checksum << 1) ^ ((checksum & MSB_SELECT) >> 15) * poly;
+            checkSum = i << (numBits - 4u);
+            for (j = 0; j < 4; j++)
+            {
+                /* Shift out the MSB and XOR the polynomial */
+                checkSum = (checkSum & topBit) ? ((checkSum << 1) ^ poly) : (checkSum << 1);
+            }
+            pTable[i] = checkSum & mask;
         }
     }
-    return (uint32_t)(checksum ^ finalXorValue);
+}
+
+/**
+ * \ref CrcCalcNibble
+ */
+static uint32_t CrcCalcNibble(ADI_CRC_HANDLE hCrc, uint8_t *pBuff, uint32_t numBytes,
+                              uint16_t offset)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    uint32_t checksum;
+
+    checksum = pData->pfKernel(hCrc, pData->initialCrc, &pBuff[offset], numBytes);
+
+    return CrcFinalize(pData, checksum);
+}
+
+/**
+ * \ref CrcUpdateNibble
+ */
+static uint32_t CrcUpdateNibble(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    /* Byte and nibble positions of the top of the register */
+    uint32_t byteShift = 24u;
+    uint32_t nibbleShift = 28u;
+    uint32_t mask = 0xFFFFFFFFu;
+    uint32_t i;
+
+    if (pData->crcCfg.crcType == ADI_CRC_TYPE_CRC8)
+    {
+        byteShift = 0u;
+        nibbleShift = 4u;
+        mask = 0xFFu;
+    }
+    else if (pData->crcCfg.crcType == ADI_CRC_TYPE_CRC16)
+    {
+        byteShift = 8u;
+        nibbleShift = 12u;
+        mask = 0xFFFFu;
+    }
+
+    crc &= mask;
+    for (i = 0; i < numBytes; i++)
+    {
+        crc ^= (uint32_t)pBuff[i] << byteShift;
+        crc = ((crc << 4) & mask) ^ pTable[crc >> nibbleShift];
+        crc = ((crc << 4) & mask) ^ pTable[crc >> nibbleShift];
+    }
+
+    return crc;
+}
+
+/**
+ * \ref CrcReflectedUpdateNibble
+ */
+static uint32_t CrcReflectedUpdateNibble(ADI_CRC_HANDLE hCrc, uint32_t crc, const uint8_t *pBuff,
+                                         uint32_t numBytes)
+{
+    ADI_CRC_DATA *pData = (ADI_CRC_DATA *)hCrc;
+    const uint32_t *pTable = pData->pLookUpTable;
+    uint32_t i;
+
+    for (i = 0; i < numBytes; i++)
+    {
+        crc ^= pBuff[i];
+        crc = (crc >> 4) ^ pTable[crc & 0xFu];
+        crc = (crc >> 4) ^ pTable[crc & 0xFu];
+    }
+
+    return crc;
 }
 
 /**
@@ -0,0 +1,130 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     adi_crc_tables.c
+ * @brief    This file contains the constant 8 bit look up tables of the common polynomials. The
+ *           tables are generated by the preprocessor and placed in flash.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+#include "adi_crc_private.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*============= D E F I N E S =============*/
+
+/*
+ * A table entry is linear in its index, so entry i is the XOR of the entries of the bits set in
+ * i. The entries of the single bits are a chain of CRC steps starting at the polynomial. The
+ * chain is kept in enumerators, so each step is evaluated once and the table expands to a few
+ * kilobytes of source. Enumerators are int, so the chain is held in 16-bit halves. Normal CRCs
+ * are computed with the polynomial aligned to bit 31 and shifted down to the width.
+ */
+
+/** Upper half of one MSB first CRC step */
+#define CRC_NEXT_HI(h, l, ph) (((((h) << 1) & 0xFFFF) | ((l) >> 15)) ^ (((h) >> 15) * (ph)))
+/** Lower half of one MSB first CRC step */
+#define CRC_NEXT_LO(h, l, pl) ((((l) << 1) & 0xFFFF) ^ (((h) >> 15) * (pl)))
+/** Upper half of one reflected CRC step */
+#define CRC_REFLECTED_NEXT_HI(h, l, ph) (((h) >> 1) ^ (((l) & 1) * (ph)))
+/** Lower half of one reflected CRC step */
+#define CRC_REFLECTED_NEXT_LO(h, l, pl) ((((l) >> 1) | (((h) & 1) << 15)) ^ (((l) & 1) * (pl)))
+
+/** Link k of the chain, one step after link j */
+#define CRC_LINK(n, k, j, NEXT, p)                                                                 \
+    n##_H##k = NEXT##_HI(n##_H##j, n##_L##j, (int)((p) >> 16)),                                    \
+    n##_L##k = NEXT##_LO(n##_H##j, n##_L##j, (int)((p)&0xFFFFu))
+
+/** Chain of the 8 single bit entries of polynomial p */
+#define CRC_CHAIN(n, NEXT, p)                                                                      \
+    enum                                                                                           \
+    {                                                                                              \
+        n##_H0 = (int)((p) >> 16),                                                                 \
+        n##_L0 = (int)((p)&0xFFFFu),                                                               \
+        CRC_LINK(n, 1, 0, NEXT, p),                                                                \
+        CRC_LINK(n, 2, 1, NEXT, p),                                                                \
+        CRC_LINK(n, 3, 2, NEXT, p),                                                                \
+        CRC_LINK(n, 4, 3, NEXT, p),                                                                \
+        CRC_LINK(n, 5, 4, NEXT, p),                                                                \
+        CRC_LINK(n, 6, 5, NEXT, p),                                                                \
+        CRC_LINK(n, 7, 6, NEXT, p)                                                                 \
+    }
+
+/** Link k of the chain n, if bit b of index i is set */
+#define CRC_SELECT(i, b, n, k)                                                                     \
+    ((((uint32_t)(i) >> (b)) & 1u) * (((uint32_t)n##_H##k << 16) | (uint32_t)n##_L##k))
+
+/** Entry i of a MSB first table. Bit k of the index is k steps from the polynomial. */
+#define CRC_ENTRY(n, i)                                                                            \
+    (CRC_SELECT(i, 0, n, 0) ^ CRC_SELECT(i, 1, n, 1) ^ CRC_SELECT(i, 2, n, 2) ^                    \
+     CRC_SELECT(i, 3, n, 3) ^ CRC_SELECT(i, 4, n, 4) ^ CRC_SELECT(i, 5, n, 5) ^                    \
+     CRC_SELECT(i, 6, n, 6) ^ CRC_SELECT(i, 7, n, 7))
+
+/** Entry i of a reflected table. Bit k of the index is 7 - k steps from the polynomial. */
+#define CRC_REFLECTED_ENTRY(n, i)                                                                  \
+    (CRC_SELECT(i, 0, n, 7) ^ CRC_SELECT(i, 1, n, 6) ^ CRC_SELECT(i, 2, n, 5) ^                    \
+     CRC_SELECT(i, 3, n, 4) ^ CRC_SELECT(i, 4, n, 3) ^ CRC_SELECT(i, 5, n, 2) ^                    \
+     CRC_SELECT(i, 6, n, 1) ^ CRC_SELECT(i, 7, n, 0))
+
+/** 16 entries of a table starting at index r */
+#define CRC_ROW(E, r)                                                                              \
+    E((r) + 0u), E((r) + 1u), E((r) + 2u), E((r) + 3u), E((r) + 4u), E((r) + 5u), E((r) + 6u),     \
+        E((r) + 7u), E((r) + 8u), E((r) + 9u), E((r) + 10u), E((r) + 11u), E((r) + 12u),           \
+        E((r) + 13u), E((r) + 14u), E((r) + 15u)
+
+/** The 256 entries of a table */
+#define CRC_TABLE(E)                                                                               \
+    CRC_ROW(E, 0u), CRC_ROW(E, 16u), CRC_ROW(E, 32u), CRC_ROW(E, 48u), CRC_ROW(E, 64u),            \
+        CRC_ROW(E, 80u), CRC_ROW(E, 96u), CRC_ROW(E, 112u), CRC_ROW(E, 128u), CRC_ROW(E, 144u),    \
+        CRC_ROW(E, 160u), CRC_ROW(E, 176u), CRC_ROW(E, 192u), CRC_ROW(E, 208u), CRC_ROW(E, 224u),  \
+        CRC_ROW(E, 240u)
+
+/*============= D A T A =============*/
+
+CRC_CHAIN(CRC8_07, CRC_NEXT, 0x07000000u);
+CRC_CHAIN(CRC16_1021, CRC_NEXT, 0x10210000u);
+/* 0xA001 is 0x8005 reflected */
+CRC_CHAIN(CRC16_REFLECTED_8005, CRC_REFLECTED_NEXT, 0xA001u);
+CRC_CHAIN(CRC32_04C11DB7, CRC_NEXT, 0x04C11DB7u);
+/* 0xEDB88320 is 0x04C11DB7 reflected */
+CRC_CHAIN(CRC32_REFLECTED_04C11DB7, CRC_REFLECTED_NEXT, 0xEDB88320u);
+
+/** Entry of the CRC-8 0x07 table */
+#define CRC8_07_ENTRY(i) (uint16_t)(CRC_ENTRY(CRC8_07, i) >> 24)
+/** Entry of the CRC-16 0x1021 table */
+#define CRC16_1021_ENTRY(i) (uint16_t)(CRC_ENTRY(CRC16_1021, i) >> 16)
+/** Entry of the reflected CRC-16 0x8005 table */
+#define CRC16_REFLECTED_8005_ENTRY(i) (uint16_t)(CRC_REFLECTED_ENTRY(CRC16_REFLECTED_8005, i))
+/** Entry of the CRC-32 0x04C11DB7 table */
+#define CRC32_04C11DB7_ENTRY(i) CRC_ENTRY(CRC32_04C11DB7, i)
+/** Entry of the reflected CRC-32 0x04C11DB7 table */
+#define CRC32_REFLECTED_04C11DB7_ENTRY(i) CRC_REFLECTED_ENTRY(CRC32_REFLECTED_04C11DB7, i)
+
+const uint16_t crcTable8Poly07[LOOK_UP_TABLE_SIZE] = {CRC_TABLE(CRC8_07_ENTRY)};
+
+const uint16_t crcTable16Poly1021[LOOK_UP_TABLE_SIZE] = {CRC_TABLE(CRC16_1021_ENTRY)};
+
+const uint16_t crcTable16ReflectedPoly8005[LOOK_UP_TABLE_SIZE] = {
+    CRC_TABLE(CRC16_REFLECTED_8005_ENTRY)};
+
+const uint32_t crcTable32Poly04C11DB7[LOOK_UP_TABLE_SIZE] = {CRC_TABLE(CRC32_04C11DB7_ENTRY)};
+
+const uint32_t crcTable32ReflectedPoly04C11DB7[LOOK_UP_TABLE_SIZE] = {
+    CRC_TABLE(CRC32_REFLECTED_04C11DB7_ENTRY)};
+
+const CRC_CONST_TABLE crcConstTables[] = {
+    {ADI_CRC_TYPE_CRC8, false, 0x07u, crcTable8Poly07},
+    {ADI_CRC_TYPE_CRC16, false, 0x1021u, crcTable16Poly1021},
+    {ADI_CRC_TYPE_CRC16, true, 0x8005u, crcTable16ReflectedPoly8005},
+    {ADI_CRC_TYPE_CRC32, false, 0x04C11DB7u, crcTable32Poly04C11DB7},
+    {ADI_CRC_TYPE_CRC32, true, 0x04C11DB7u, crcTable32ReflectedPoly04C11DB7},
+};
+
+const uint32_t crcNumConstTables = sizeof(crcConstTables) / sizeof(crcConstTables[0]);
+
+/**
+ * @}
+ */
@@ -6,6 +6,18 @@
  * @file   adi_circ_buf.h
  * @addtogroup ADI_UCOMM
  * @brief  Circular buffer routines
+ *
+ * The buffer is safe for one producer and one consumer running in different
+ * contexts (for example an ISR writing and the main loop reading) without locks.
+ * Each side publishes its index with release semantics after touching the data
+ * and reads the other side's index with acquire semantics before touching the
+ * data.
+ *
+ * Define CIRC_BUFF_POW2 to build the power-of-two mode. In this mode nSize must be
+ * a power of two, the indices run freely and are masked on access, and the whole
+ * buffer can be filled. Otherwise the indices wrap at nSize and
+ * \ref ADICircBufGetSpaceAvailable keeps a 4 element guard so that a full buffer
+ * is not mistaken for an empty one.
  * @{
  */
 
@@ -14,11 +26,46 @@
 
 /*============= I N C L U D E S =============*/
 #include <stdint.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*============= D E F I N E S =============*/
+
+#ifdef CIRC_BUFF_MEM_32_ALLIGN
+/** Size of one buffer element in bytes. Indices and size count elements. */
+#define ADI_CIRC_BUF_ELEMENT_SIZE 4u
+#else
+/** Size of one buffer element in bytes. Indices and size count elements. */
+#define ADI_CIRC_BUF_ELEMENT_SIZE 1u
+#endif
+
+/**
+ * @brief Loads a buffer index with acquire semantics
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define ADI_CIRC_BUF_LOAD_INDEX(pIndex) __atomic_load_n((pIndex), __ATOMIC_ACQUIRE)
+#elif !defined(__cplusplus) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define ADI_CIRC_BUF_LOAD_INDEX(pIndex) ADICircBufLoadAcquire(pIndex)
+#else
+#define ADI_CIRC_BUF_LOAD_INDEX(pIndex) (*(pIndex))
+#endif
+
+/**
+ * @brief Stores a buffer index with release semantics
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define ADI_CIRC_BUF_STORE_INDEX(pIndex, nValue)                                                   \
+    __atomic_store_n((pIndex), (nValue), __ATOMIC_RELEASE)
+#elif !defined(__cplusplus) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#define ADI_CIRC_BUF_STORE_INDEX(pIndex, nValue) ADICircBufStoreRelease((pIndex), (nValue))
+#else
+#define ADI_CIRC_BUF_STORE_INDEX(pIndex, nValue) (*(pIndex) = (nValue))
+#endif
+
 /*============= D A T A  T Y P E S =============*/
 
 /**
@@ -28,14 +75,83 @@ typedef struct __ADI_CIRC_BUF
 {
 
     uint8_t *pBase;                /**< Base pointer */
-    uint32_t nSize;                /**< Size of the buffer in bytes */
-    volatile uint32_t nReadIndex;  /**< Read index */
-    volatile uint32_t nWriteIndex; /**< Write index */
+    uint32_t nSize;                /**< Size of the buffer in bytes. Must be a power of two
+                                        when CIRC_BUFF_POW2 is defined. */
+    volatile uint32_t nReadIndex;  /**< Read index. Written only by the consumer. */
+    volatile uint32_t nWriteIndex; /**< Write index. Written only by the producer. */
 
 } ADI_CIRC_BUF;
 
 /*======= INLINE FUNCTIONS  ========*/
 
+#if !defined(__GNUC__) && !defined(__clang__) && !defined(__cplusplus) &&                         \
+    (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+/**
+ * @brief Loads an index and orders the following data accesses after it
+ * @param[in] pIndex - Pointer to the index
+ * @return Index value
+ */
+static inline uint32_t ADICircBufLoadAcquire(const volatile uint32_t *pIndex)
+{
+    uint32_t nIndex = *pIndex;
+    atomic_thread_fence(memory_order_acquire);
+    return nIndex;
+}
+
+/**
+ * @brief Orders the preceding data accesses before storing an index
+ * @param[in] pIndex - Pointer to the index
+ * @param[in] nIndex - Index value
+ */
+static inline void ADICircBufStoreRelease(volatile uint32_t *pIndex, uint32_t nIndex)
+{
+    atomic_thread_fence(memory_order_release);
+    *pIndex = nIndex;
+}
+#endif
+
+/**
+ * @brief Converts an index to an element offset into the buffer memory
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[in] nIndex - Read or write index
+ * @return Element offset. May be equal to nSize when CIRC_BUFF_POW2 is not defined.
+ */
+static inline uint32_t ADICircBufGetOffset(volatile ADI_CIRC_BUF *pCircBuf, uint32_t nIndex)
+{
+#ifdef CIRC_BUFF_POW2
+    return nIndex & (pCircBuf->nSize - 1u);
+#else
+    (void)pCircBuf;
+    return nIndex;
+#endif
+}
+
+/**
+ * @brief Advances a read or write index by a number of elements
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[in] nIndex - Current index
+ * @param[in] nNumElements - Number of elements to advance by
+ * @return Advanced index
+ */
+static inline uint32_t ADICircBufAdvance(volatile ADI_CIRC_BUF *pCircBuf, uint32_t nIndex,
+                                         uint32_t nNumElements)
+{
+#ifdef CIRC_BUFF_POW2
+    (void)pCircBuf;
+    nIndex += nNumElements;
+#else
+    uint32_t nSize = pCircBuf->nSize;
+
+    nIndex += nNumElements;
+    while (nIndex >= nSize)
+    {
+        nIndex -= nSize;
+    }
+#endif
+
+    return nIndex;
+}
+
 /**
  * @brief Gets the number of data bytes present in the circular buffer
  * @param[in] pCircBuf - Pointer to circular buffer structure
@@ -43,17 +159,18 @@ typedef struct __ADI_CIRC_BUF
  */
 static inline int32_t ADICircBufGetNumBytesAvailable(volatile ADI_CIRC_BUF *pCircBuf)
 {
-    uint32_t nReadOffset = pCircBuf->nReadIndex;
-    uint32_t nWriteOffset = pCircBuf->nWriteIndex;
-    uint32_t nSize = pCircBuf->nSize;
+    uint32_t nReadOffset = ADI_CIRC_BUF_LOAD_INDEX(&pCircBuf->nReadIndex);
+    uint32_t nWriteOffset = ADI_CIRC_BUF_LOAD_INDEX(&pCircBuf->nWriteIndex);
     int32_t nDataAvailable;
 
     nDataAvailable = (int32_t)(nWriteOffset - nReadOffset);
 
+#ifndef CIRC_BUFF_POW2
     if (nDataAvailable < 0)
     {
-        nDataAvailable += nSize;
+        nDataAvailable += pCircBuf->nSize;
     }
+#endif
 
     return nDataAvailable;
 }
@@ -65,17 +182,21 @@ static inline int32_t ADICircBufGetNumBytesAvailable(volatile ADI_CIRC_BUF *pCir
  */
 static inline int32_t ADICircBufGetSpaceAvailable(volatile ADI_CIRC_BUF *pCircBuf)
 {
-    uint32_t nReadOffset = pCircBuf->nReadIndex;
-    uint32_t nWriteOffset = pCircBuf->nWriteIndex;
+    uint32_t nReadOffset = ADI_CIRC_BUF_LOAD_INDEX(&pCircBuf->nReadIndex);
+    uint32_t nWriteOffset = ADI_CIRC_BUF_LOAD_INDEX(&pCircBuf->nWriteIndex);
     uint32_t nSize = pCircBuf->nSize;
     int32_t nSpaceAvailable;
 
+#ifdef CIRC_BUFF_POW2
+    nSpaceAvailable = (int32_t)(nSize - (nWriteOffset - nReadOffset));
+#else
     nSpaceAvailable = (int32_t)(nReadOffset - nWriteOffset - 4u);
 
     if (nSpaceAvailable < 0)
     {
         nSpaceAvailable += nSize;
     }
+#endif
 
     return nSpaceAvailable;
 }
@@ -93,7 +214,8 @@ static inline int32_t ADICircBufRead(volatile ADI_CIRC_BUF *pCircBuf, volatile u
     int32_t nResult = 0;
     uint32_t i = 0;
 
-    uint32_t nOffset = pCircBuf->nReadIndex;
+    uint32_t nIndex = pCircBuf->nReadIndex;
+    uint32_t nOffset = ADICircBufGetOffset(pCircBuf, nIndex);
     uint32_t nSize = pCircBuf->nSize;
     int32_t nNumBytesAvailable = ADICircBufGetNumBytesAvailable(pCircBuf);
 #ifdef CIRC_BUFF_MEM_32_ALLIGN
@@ -119,14 +241,14 @@ static inline int32_t ADICircBufRead(volatile ADI_CIRC_BUF *pCircBuf, volatile u
 
             nOffset++;
         }
+        ADI_CIRC_BUF_STORE_INDEX(&pCircBuf->nReadIndex,
+                                 ADICircBufAdvance(pCircBuf, nIndex, nReqBytes));
     }
     else
     {
         nResult = 1;
     }
 
-    pCircBuf->nReadIndex = nOffset;
-
     return nResult;
 }
 
@@ -144,7 +266,8 @@ static inline int32_t ADICircBufWrite(volatile ADI_CIRC_BUF *pCircBuf,
     uint32_t i = 0;
 
     uint32_t nSpaceAvailable = (uint32_t)ADICircBufGetSpaceAvailable(pCircBuf);
-    uint32_t nOffset = pCircBuf->nWriteIndex;
+    uint32_t nIndex = pCircBuf->nWriteIndex;
+    uint32_t nOffset = ADICircBufGetOffset(pCircBuf, nIndex);
     uint32_t nSize = pCircBuf->nSize;
 #ifdef CIRC_BUFF_MEM_32_ALLIGN
     uint32_t *pBase = (uint32_t *)pCircBuf->pBase;
@@ -166,7 +289,8 @@ static inline int32_t ADICircBufWrite(volatile ADI_CIRC_BUF *pCircBuf,
             pBase[nOffset] = pSrc[i];
             nOffset++;
         }
-        pCircBuf->nWriteIndex = nOffset;
+        ADI_CIRC_BUF_STORE_INDEX(&pCircBuf->nWriteIndex,
+                                 ADICircBufAdvance(pCircBuf, nIndex, nNumBytes));
     }
     else
     {
@@ -189,7 +313,7 @@ static inline int32_t ADICircBufQuery(volatile ADI_CIRC_BUF *pCircBuf, volatile
     uint32_t i = 0;
 
     uint32_t nSize = pCircBuf->nSize;
-    uint32_t nOffset = pCircBuf->nReadIndex;
+    uint32_t nOffset = ADICircBufGetOffset(pCircBuf, pCircBuf->nReadIndex);
 #ifdef CIRC_BUFF_MEM_32_ALLIGN
     uint32_t *pBase = (uint32_t *)pCircBuf->pBase;
     uint32_t *pDst = (uint32_t *)pDstAddr;
@@ -220,6 +344,269 @@ static inline int32_t ADICircBufQuery(volatile ADI_CIRC_BUF *pCircBuf, volatile
     return nResult;
 }
 
+/**
+ * @brief Copies elements out of the buffer starting at an offset, using at most two
+ * contiguous spans. Does not update any index.
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[in] nIndex - Read index to start copying from
+ * @param[out] pDst - Pointer to store the elements
+ * @param[in] nNumElements - Number of elements to copy
+ */
+static inline void ADICircBufCopyFrom(volatile ADI_CIRC_BUF *pCircBuf, uint32_t nIndex,
+                                      uint8_t *pDst, uint32_t nNumElements)
+{
+    uint8_t *pBase = pCircBuf->pBase;
+    uint32_t nSize = pCircBuf->nSize;
+    uint32_t nOffset = ADICircBufGetOffset(pCircBuf, nIndex);
+    uint32_t nFirstSpan;
+
+    if (nOffset >= nSize)
+    {
+        nOffset -= nSize;
+    }
+
+    nFirstSpan = nSize - nOffset;
+    if (nFirstSpan > nNumElements)
+    {
+        nFirstSpan = nNumElements;
+    }
+
+    memcpy(pDst, &pBase[nOffset * ADI_CIRC_BUF_ELEMENT_SIZE],
+           nFirstSpan * ADI_CIRC_BUF_ELEMENT_SIZE);
+    memcpy(&pDst[nFirstSpan * ADI_CIRC_BUF_ELEMENT_SIZE], pBase,
+           (nNumElements - nFirstSpan) * ADI_CIRC_BUF_ELEMENT_SIZE);
+}
+
+/**
+ * @brief Copies elements into the buffer starting at an offset, using at most two
+ * contiguous spans. Does not update any index.
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[in] nIndex - Write index to start copying to
+ * @param[in] pSrc - Pointer to the elements
+ * @param[in] nNumElements - Number of elements to copy
+ */
+static inline void ADICircBufCopyTo(volatile ADI_CIRC_BUF *pCircBuf, uint32_t nIndex,
+                                    const uint8_t *pSrc, uint32_t nNumElements)
+{
+    uint8_t *pBase = pCircBuf->pBase;
+    uint32_t nSize = pCircBuf->nSize;
+    uint32_t nOffset = ADICircBufGetOffset(pCircBuf, nIndex);
+    uint32_t nFirstSpan;
+
+    if (nOffset >= nSize)
+    {
+        nOffset -= nSize;
+    }
+
+    nFirstSpan = nSize - nOffset;
+    if (nFirstSpan > nNumElements)
+    {
+        nFirstSpan = nNumElements;
+    }
+
+    memcpy(&pBase[nOffset * ADI_CIRC_BUF_ELEMENT_SIZE], pSrc,
+           nFirstSpan * ADI_CIRC_BUF_ELEMENT_SIZE);
+    memcpy(pBase, &pSrc[nFirstSpan * ADI_CIRC_BUF_ELEMENT_SIZE],
+           (nNumElements - nFirstSpan) * ADI_CIRC_BUF_ELEMENT_SIZE);
+}
+
+/**
+ * @brief Reads data from buffer and updates read index. Same as \ref ADICircBufRead
+ * but copies the data in at most two contiguous spans.
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[out] pDstAddr - Pointer to store the required bytes
+ * @param[in] nReqBytes - Number of required bytes
+ * @return 0 -  Success , 1 - Not enough bytes in buffer
+ */
+static inline int32_t ADICircBufReadBulk(volatile ADI_CIRC_BUF *pCircBuf, uint8_t *pDstAddr,
+                                         uint32_t nReqBytes)
+{
+    int32_t nResult = 0;
+    uint32_t nIndex = pCircBuf->nReadIndex;
+    uint32_t nNumBytesAvailable = (uint32_t)ADICircBufGetNumBytesAvailable(pCircBuf);
+    uint32_t nReqElements = nReqBytes / ADI_CIRC_BUF_ELEMENT_SIZE;
+
+    if (nNumBytesAvailable >= nReqElements)
+    {
+        ADICircBufCopyFrom(pCircBuf, nIndex, pDstAddr, nReqElements);
+        ADI_CIRC_BUF_STORE_INDEX(&pCircBuf->nReadIndex,
+                                 ADICircBufAdvance(pCircBuf, nIndex, nReqElements));
+    }
+    else
+    {
+        nResult = 1;
+    }
+
+    return nResult;
+}
+
+/**
+ * @brief Writes data to buffer and updates write index. Same as \ref ADICircBufWrite
+ * but copies the data in at most two contiguous spans.
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[in] pSrcAddr - Pointer to the bytes
+ * @param[in] nNumBytes - Number of bytes to write
+ * @return 0 -  Success , 1 - Not enough space in buffer
+ */
+static inline int32_t ADICircBufWriteBulk(volatile ADI_CIRC_BUF *pCircBuf, const uint8_t *pSrcAddr,
+                                          uint32_t nNumBytes)
+{
+    int32_t nResult = 0;
+    uint32_t nSpaceAvailable = (uint32_t)ADICircBufGetSpaceAvailable(pCircBuf);
+    uint32_t nIndex = pCircBuf->nWriteIndex;
+    uint32_t nNumElements = nNumBytes / ADI_CIRC_BUF_ELEMENT_SIZE;
+
+    if (nSpaceAvailable >= nNumElements)
+    {
+        ADICircBufCopyTo(pCircBuf, nIndex, pSrcAddr, nNumElements);
+        ADI_CIRC_BUF_STORE_INDEX(&pCircBuf->nWriteIndex,
+                                 ADICircBufAdvance(pCircBuf, nIndex, nNumElements));
+    }
+    else
+    {
+        nResult = 1;
+    }
+
+    return nResult;
+}
+
+/**
+ * @brief Reads data from buffer but do not update read index. Same as
+ * \ref ADICircBufQuery but copies the data in at most two contiguous spans.
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[out] pDstAddr - Pointer to store the required bytes
+ * @param[in] nReqBytes - Number of required bytes
+ * @return 0 -  Success , 1 - Not enough bytes in buffer
+ */
+static inline int32_t ADICircBufQueryBulk(volatile ADI_CIRC_BUF *pCircBuf, uint8_t *pDstAddr,
+                                          uint32_t nReqBytes)
+{
+    int32_t nResult = 0;
+    uint32_t nNumBytesAvailable = (uint32_t)ADICircBufGetNumBytesAvailable(pCircBuf);
+    uint32_t nReqElements = nReqBytes / ADI_CIRC_BUF_ELEMENT_SIZE;
+
+    if (nNumBytesAvailable >= nReqElements)
+    {
+        ADICircBufCopyFrom(pCircBuf, pCircBuf->nReadIndex, pDstAddr, nReqElements);
+    }
+    else
+    {
+        nResult = 1;
+    }
+
+    return nResult;
+}
+
+/**
+ * @brief Gets the contiguous free span at the write index. The producer can fill the
+ * span directly (for example by DMA) and publish it with \ref ADICircBufCommitWrite.
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[out] ppRegion - Pointer to store the start of the free span
+ * @param[out] pNumBytes - Pointer to store the size of the free span in bytes
+ * @return 0 -  Success , 1 - No space in buffer
+ */
+static inline int32_t ADICircBufGetWriteRegion(volatile ADI_CIRC_BUF *pCircBuf, uint8_t **ppRegion,
+                                               uint32_t *pNumBytes)
+{
+    uint32_t nSpaceAvailable = (uint32_t)ADICircBufGetSpaceAvailable(pCircBuf);
+    uint32_t nOffset = ADICircBufGetOffset(pCircBuf, pCircBuf->nWriteIndex);
+    uint32_t nSize = pCircBuf->nSize;
+
+    if (nOffset >= nSize)
+    {
+        nOffset -= nSize;
+    }
+    if (nSpaceAvailable > nSize - nOffset)
+    {
+        nSpaceAvailable = nSize - nOffset;
+    }
+
+    *ppRegion = &pCircBuf->pBase[nOffset * ADI_CIRC_BUF_ELEMENT_SIZE];
+    *pNumBytes = nSpaceAvailable * ADI_CIRC_BUF_ELEMENT_SIZE;
+
+    return (nSpaceAvailable > 0) ? 0 : 1;
+}
+
+/**
+ * @brief Publishes bytes written into the span returned by \ref ADICircBufGetWriteRegion
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[in] nNumBytes - Number of bytes written
+ * @return 0 -  Success , 1 - Not enough space in buffer
+ */
+static inline int32_t ADICircBufCommitWrite(volatile ADI_CIRC_BUF *pCircBuf, uint32_t nNumBytes)
+{
+    int32_t nResult = 0;
+    uint32_t nSpaceAvailable = (uint32_t)ADICircBufGetSpaceAvailable(pCircBuf);
+    uint32_t nNumElements = nNumBytes / ADI_CIRC_BUF_ELEMENT_SIZE;
+
+    if (nSpaceAvailable >= nNumElements)
+    {
+        ADI_CIRC_BUF_STORE_INDEX(&pCircBuf->nWriteIndex,
+                                 ADICircBufAdvance(pCircBuf, pCircBuf->nWriteIndex, nNumElements));
+    }
+    else
+    {
+        nResult = 1;
+    }
+
+    return nResult;
+}
+
+/**
+ * @brief Gets the contiguous filled span at the read index. The consumer can parse the
+ * span in place and release it with \ref ADICircBufConsume.
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[out] ppRegion - Pointer to store the start of the filled span
+ * @param[out] pNumBytes - Pointer to store the size of the filled span in bytes
+ * @return 0 -  Success , 1 - No data in buffer
+ */
+static inline int32_t ADICircBufGetReadRegion(volatile ADI_CIRC_BUF *pCircBuf, uint8_t **ppRegion,
+                                              uint32_t *pNumBytes)
+{
+    uint32_t nNumBytesAvailable = (uint32_t)ADICircBufGetNumBytesAvailable(pCircBuf);
+    uint32_t nOffset = ADICircBufGetOffset(pCircBuf, pCircBuf->nReadIndex);
+    uint32_t nSize = pCircBuf->nSize;
+
+    if (nOffset >= nSize)
+    {
+        nOffset -= nSize;
+    }
+    if (nNumBytesAvailable > nSize - nOffset)
+    {
+        nNumBytesAvailable = nSize - nOffset;
+    }
+
+    *ppRegion = &pCircBuf->pBase[nOffset * ADI_CIRC_BUF_ELEMENT_SIZE];
+    *pNumBytes = nNumBytesAvailable * ADI_CIRC_BUF_ELEMENT_SIZE;
+
+    return (nNumBytesAvailable > 0) ? 0 : 1;
+}
+
+/**
+ * @brief Releases bytes read from the span returned by \ref ADICircBufGetReadRegion
+ * @param[in] pCircBuf - Pointer to circular buffer structure
+ * @param[in] nNumBytes - Number of bytes consumed
+ * @return 0 -  Success , 1 - Not enough bytes in buffer
+ */
+static inline int32_t ADICircBufConsume(volatile ADI_CIRC_BUF *pCircBuf, uint32_t nNumBytes)
+{
+    int32_t nResult = 0;
+    uint32_t nNumBytesAvailable = (uint32_t)ADICircBufGetNumBytesAvailable(pCircBuf);
+    uint32_t nNumElements = nNumBytes / ADI_CIRC_BUF_ELEMENT_SIZE;
+
+    if (nNumBytesAvailable >= nNumElements)
+    {
+        ADI_CIRC_BUF_STORE_INDEX(&pCircBuf->nReadIndex,
+                                 ADICircBufAdvance(pCircBuf, pCircBuf->nReadIndex, nNumElements));
+    }
+    else
+    {
+        nResult = 1;
+    }
+
+    return nResult;
+}
+
 /**
  * @brief Flushes nNumBytes of data from the circular buffer
  * @param[in] pCircBuf - Pointer to circular buffer structure
@@ -237,12 +624,8 @@ static inline int32_t ADICircBufFlush(ADI_CIRC_BUF *pCircBuf, uint32_t nNumBytes
         nNumBytes = nNumBytesAvailable;
     }
 
-    pCircBuf->nReadIndex += nNumBytes;
-
-    if (pCircBuf->nReadIndex >= pCircBuf->nSize)
-    {
-        pCircBuf->nReadIndex -= pCircBuf->nSize;
-    }
+    ADI_CIRC_BUF_STORE_INDEX(&pCircBuf->nReadIndex,
+                             ADICircBufAdvance(pCircBuf, pCircBuf->nReadIndex, nNumBytes));
 
     return nResult;
 }
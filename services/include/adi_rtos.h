@@ -0,0 +1,73 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file        adi_rtos.h
+ * @brief       wrapper for cmsis os locking and event flags
+ *
+ * With CMSIS_OS2 defined the services guard each handle with a recursive mutex and signal
+ * their callbacks through event flags. Without it the macros compile to nothing for bare metal
+ * builds with a single thread of execution.
+ * @{
+ */
+
+#ifndef ADI_RTOS_H_
+#define ADI_RTOS_H_
+
+#ifdef CMSIS_OS2
+#include "cmsis_os2.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stdint.h>
+
+/*============= D E F I N E S =============*/
+#ifdef CMSIS_OS2
+/** mutex guarding a service handle */
+typedef osMutexId_t ADI_RTOS_MUTEX;
+/** event flags of a service handle */
+typedef osEventFlagsId_t ADI_RTOS_EVENT;
+/** creates a recursive mutex with priority inheritance, NULL on failure */
+#define ADI_RTOS_MUTEX_NEW(mutex)                                                                  \
+    ((mutex) = osMutexNew(&(const osMutexAttr_t){NULL, osMutexRecursive | osMutexPrioInherit,     \
+                                                 NULL, 0}))
+/** waits for the mutex, may be nested in the same thread. Ignored in interrupt context. */
+#define ADI_RTOS_LOCK(mutex) ((void)osMutexAcquire((mutex), osWaitForever))
+/** releases the mutex */
+#define ADI_RTOS_UNLOCK(mutex) ((void)osMutexRelease(mutex))
+/** creates event flags, NULL on failure */
+#define ADI_RTOS_EVENT_NEW(event) ((event) = osEventFlagsNew(NULL))
+/** sets event flags, also from interrupt context */
+#define ADI_RTOS_EVENT_SET(event, flags) ((void)osEventFlagsSet((event), (flags)))
+/** 1 if a mutex or event flags were created, 0 if the RTOS ran out of objects */
+#define ADI_RTOS_IS_CREATED(id) ((id) != NULL)
+#else
+/** no mutex without an RTOS */
+typedef uint8_t ADI_RTOS_MUTEX;
+/** no event flags without an RTOS */
+typedef uint8_t ADI_RTOS_EVENT;
+/** no mutex without an RTOS */
+#define ADI_RTOS_MUTEX_NEW(mutex) ((void)(mutex))
+/** no locking without an RTOS */
+#define ADI_RTOS_LOCK(mutex) ((void)(mutex))
+/** no locking without an RTOS */
+#define ADI_RTOS_UNLOCK(mutex) ((void)(mutex))
+/** no event flags without an RTOS */
+#define ADI_RTOS_EVENT_NEW(event) ((void)(event))
+/** no event flags without an RTOS */
+#define ADI_RTOS_EVENT_SET(event, flags) ((void)(event), (void)(flags))
+/** nothing to create without an RTOS */
+#define ADI_RTOS_IS_CREATED(id) ((void)(id), 1)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADI_RTOS_H_ */
+/**
+ * @}
+ */
@@ -14,10 +14,15 @@
  * MAX32670 controller.
  *
  * Typical API usage:
- * 1. **Create the NVM Instance**: Call adi_nvm_Create() to create an NVM service instance.
+ * 1. **Create the NVM Instance**: Call adi_nvm_Create() to create an NVM service instance. The
+ *    state memory sets the size of the transfer buffers, and the temporary memory can be shared
+ *    by several instances.
  * 2. **Configure the NVM**: Populate an ADI_NVM_CONFIG structure with required function pointers.
  * 3. **Initialize the NVM**: Call adi_nvm_Init() to configure the service.
  * 4. Use APIs to read, write and erase the data of NVM.
+ *
+ * When CMSIS_OS2 is defined, each handle holds a recursive mutex and the APIs may be called from
+ * several threads. The callbacks run in interrupt context and do not take the mutex.
  * @{
  */
 
@@ -74,15 +79,35 @@ typedef int32_t (*ADI_NVM_READ_FUNC)(void *, uint8_t *, uint32_t, uint8_t *);
 typedef int32_t (*ADI_NVM_ERASE_FUNC)(void *, uint32_t);
 /** Function pointer definition for suspend */
 typedef uint16_t (*ADI_NVM_CRC_FUNC)(void *, uint8_t *, uint32_t);
+/** Function pointer definition for a streaming receive. Arguments are the user handle, the command
+ * header and its length, the data buffer and its length, and the buffer and length for the bytes
+ * that follow the data. All three segments must be transferred with the chip select held. */
+typedef int32_t (*ADI_NVM_READ_STREAM_FUNC)(void *, uint8_t *, uint32_t, uint8_t *, uint32_t,
+                                            uint8_t *, uint32_t);
+/** Function pointer definition for completion of an asynchronous request. Arguments are the user
+ * handle, the command and data pointer of the request, and the status of the request. */
+typedef void (*ADI_NVM_CALLBACK_FUNC)(void *, ADI_NVM_CMD, uint8_t *, ADI_NVM_STATUS);
+/** Function pointer definition to continue a CRC over the next chunk of data */
+typedef uint16_t (*ADI_NVM_CRC_UPDATE_FUNC)(void *, uint16_t, uint8_t *, uint32_t);
+
+/** Device backend of an NVM instance. The contents are internal to the service. */
+typedef struct NvmDeviceOps ADI_NVM_DEVICE;
+
+/** MB85RS FRAM backend. Available when the service is built with USE_NVM_FRAM. */
+extern const ADI_NVM_DEVICE adi_nvm_DeviceMb85rs;
+/** MAX32670 flash backend. Available when the service is built with USE_NVM_FLASH. */
+extern const ADI_NVM_DEVICE adi_nvm_DeviceFlcMax32670;
 
 /**
  * NVM configurations
  */
 typedef struct
 {
-    /** Function Pointer to start transmission */
+    /** Function Pointer to transmit. The transfer must be complete when it returns, as the
+     * blocking APIs reuse the buffer right away. */
     ADI_NVM_WRITE_FUNC pfWrite;
-    /** Function Pointer to start transmission and get response */
+    /** Function Pointer to transmit and get the response. The response must be received when it
+     * returns, as the blocking APIs check it right away. */
     ADI_NVM_READ_FUNC pfRead;
     /** Function Pointer to calculate the CRC for the command packet*/
     ADI_NVM_CRC_FUNC pfCalculateCrc;
@@ -90,6 +115,38 @@ typedef struct
     ADI_NVM_ERASE_FUNC pfErase;
     /** user handle*/
     void *hUser;
+    /** Optional function pointer to continue the CRC over the next chunk of data. When set, reads
+     * check each chunk as it is received instead of recomputing pfCalculateCrc over the whole
+     * buffer. It must produce the same result as pfCalculateCrc when started from crcSeed. */
+    ADI_NVM_CRC_UPDATE_FUNC pfUpdateCrc;
+    /** Initial CRC value passed to pfUpdateCrc for the first chunk */
+    uint16_t crcSeed;
+    /** Optional function pointer for a streaming read. On devices that support a continuous
+     * read (MB85RS), a read is then sent with one command header and received directly into the
+     * caller's buffer (for example by DMA) instead of in chunks of #ADI_NVM_MAX_SIZE through
+     * the internal buffers. The data is then checked in the caller's buffer, so its content is
+     * undefined when #ADI_NVM_STATUS_CRC_MISMATCH is returned. As for pfRead, the data must be
+     * received when it returns. */
+    ADI_NVM_READ_STREAM_FUNC pfReadStream;
+    /** Function pointer called when a request of #adi_nvm_WriteAsync or #adi_nvm_ReadAsync is
+     * finished. It may be called from the context of #adi_nvm_TxCallBack and #adi_nvm_RxCallBack
+     * and may queue further requests. */
+    ADI_NVM_CALLBACK_FUNC pfCallback;
+    /** Device backend of the instance, for example &#adi_nvm_DeviceMb85rs. Each instance can use
+     * a different device. It is read by #adi_nvm_Init. */
+    const ADI_NVM_DEVICE *pDevice;
+    /** Optional function pointer to start a transmission of the queued requests and return, for
+     * example by DMA. #adi_nvm_TxCallBack must be called when the transfer is complete. Set to
+     * NULL to transfer the queued requests with pfWrite. */
+    ADI_NVM_WRITE_FUNC pfWriteAsync;
+    /** Optional function pointer to start a read of the queued requests and return.
+     * #adi_nvm_RxCallBack must be called when the response is received. Set to NULL to transfer
+     * the queued requests with pfRead. */
+    ADI_NVM_READ_FUNC pfReadAsync;
+    /** Optional function pointer to start a streaming read of the queued requests and return.
+     * Used only when pfReadStream is set. #adi_nvm_RxCallBack must be called when the data is
+     * received. Set to NULL to transfer the queued requests with pfReadStream. */
+    ADI_NVM_READ_STREAM_FUNC pfReadStreamAsync;
 
 } ADI_NVM_CONFIG;
 
@@ -108,6 +165,69 @@ typedef struct
     int32_t numBlocks;
 } ADI_NVM_BLOCK_DATA;
 
+/**
+ * Record kept in RAM by the write-back cache. The application fills addr, numBytes and pData, the
+ * remaining fields are managed by the service.
+ */
+typedef struct
+{
+    /** Address of the record in NVM. Reads and writes with the same address and numBytes are
+     * served from pData. */
+    uint32_t addr;
+    /** Number of data bytes of the record, without CRC */
+    uint32_t numBytes;
+    /** Pointer to numBytes bytes of RAM holding the copy of the record */
+    uint8_t *pData;
+    /** Offset of the first byte modified since the record was last written to NVM. The record
+     * is written from here to its CRC. */
+    uint32_t dirtyStart;
+    /** Set when pData holds modifications that are not yet written to NVM */
+    uint8_t isDirty;
+    /** Set when pData holds the content of the record */
+    uint8_t isValid;
+} ADI_NVM_CACHE_RECORD;
+
+/**
+ * Configuration of the write-back cache.
+ */
+typedef struct
+{
+    /** Pointer to the records to keep in RAM. Records must not overlap. */
+    ADI_NVM_CACHE_RECORD *pRecords;
+    /** Number of records */
+    uint32_t numRecords;
+    /** Number of modified bytes after which #adi_nvm_Write writes the cache to NVM. 0 to write
+     * only from #adi_nvm_Flush and #adi_nvm_CacheTick. */
+    uint32_t maxDirtyBytes;
+    /** Time after which #adi_nvm_CacheTick writes the modified records, in the unit of its
+     * elapsed argument. 0 to disable. */
+    uint32_t flushPeriod;
+} ADI_NVM_CACHE_CONFIG;
+
+/** Number of bytes of the header at the start of each slot of a committed record */
+#define ADI_NVM_COMMIT_HEADER_NUM_BYTES 8
+
+/**
+ * Record kept in two slots, A and B. Each commit writes the slot that does not hold the newest
+ * copy, with its header and data covered by the CRC, so a torn write leaves the previous copy
+ * intact. The header holds a sequence number protected by its own CRC and is written after the
+ * data, so the newest copy is found from the headers and then checked with the record CRC.
+ */
+typedef struct
+{
+    /** Addresses of slots A and B. Each slot takes #ADI_NVM_COMMIT_HEADER_NUM_BYTES + numBytes +
+     * #ADI_NVM_NUM_BYTES_CRC bytes. */
+    uint32_t slotAddr[2];
+    /** Number of data bytes of the record, without header and CRC */
+    uint32_t numBytes;
+    /** Sequence number of the newest copy, set by #adi_nvm_CommitRecover and #adi_nvm_Commit */
+    uint32_t sequence;
+    /** Slot holding the newest copy, 0 for A and 1 for B */
+    uint8_t activeSlot;
+    /** Set when a slot holds a copy of the record */
+    uint8_t isValid;
+} ADI_NVM_COMMIT_RECORD;
+
 /** @} */
 
 /** @defgroup   NVMAPI Service API
@@ -131,23 +251,36 @@ typedef struct
  * in the application. So it is recommended that it is not allocated in the
  * stack.
  * @param[in]  stateMemorySize -  Size of the memory pointed by pStateMemory
- * This must be at least #ADI_NVM_STATE_MEM_NUM_BYTES bytes.
+ * This must be at least #ADI_NVM_STATE_MEM_NUM_BYTES_FOR(#ADI_NVM_MIN_TRANSFER_NUM_BYTES) bytes.
+ * The memory after the internal state is split into the transmit and receive buffers, so
+ * #ADI_NVM_STATE_MEM_NUM_BYTES_FOR(n) gives transfers of n bytes and
+ * #ADI_NVM_STATE_MEM_NUM_BYTES the default of #ADI_NVM_MAX_SIZE bytes. Larger buffers split
+ * records into fewer transfers.
+ * @param[in]  pTempMemory    -  Pointer to temporary memory (must be 32-bit aligned). It is only
+ * used while a blocking API runs, so one buffer can be shared by all handles that are not used
+ * concurrently.
+ * @param[in]  tempMemorySize -  Size of the memory pointed by pTempMemory. This must be at least
+ * #ADI_NVM_TEMP_MEM_NUM_BYTES_FOR(n) bytes for transfers of n bytes.
  * #adi_nvm_SetConfig can also be used to set the configuration at a later point.
  * @return  #ADI_NVM_STATUS_SUCCESS\n
  * #ADI_NVM_STATUS_NULL_PTR \n
  * #ADI_NVM_STATUS_INSUFFICIENT_STATE_MEMORY \n
+ * #ADI_NVM_STATUS_INSUFFICIENT_TEMP_MEMORY \n
  */
-ADI_NVM_STATUS adi_nvm_Create(ADI_NVM_HANDLE *phNvm, void *pStateMemory, uint32_t stateMemorySize);
+ADI_NVM_STATUS adi_nvm_Create(ADI_NVM_HANDLE *phNvm, void *pStateMemory, uint32_t stateMemorySize,
+                              void *pTempMemory, uint32_t tempMemorySize);
 
 /**
  * @brief Initializes NVM Service.
  * Before calling this API, its recommended to call #adi_nvm_Create to create the instance and also
  * to populate configurations #ADI_NVM_CONFIG from application accordingly.
+ * The RTOS mutex of the handle is created by the first call and kept by later calls.
  * @param[in] hNvm 		- NVM service handle
  * @param[in] pConfig - Pointer to NVM service configuration.
  * @return  #ADI_NVM_STATUS_SUCCESS\n
  * #ADI_NVM_STATUS_NULL_PTR \n
  * #ADI_NVM_STATUS_INVALID_PRODUCT_ID \n
+ * #ADI_NVM_STATUS_INIT_FAILED if the RTOS could not create the mutex of the handle \n
  * #ADI_NVM_STATUS_COMM_ERROR
  */
 ADI_NVM_STATUS adi_nvm_Init(ADI_NVM_HANDLE hNvm, ADI_NVM_CONFIG *pConfig);
@@ -156,6 +289,7 @@ ADI_NVM_STATUS adi_nvm_Init(ADI_NVM_HANDLE hNvm, ADI_NVM_CONFIG *pConfig);
  * @brief Sets Configuration to NVM.
  * Before calling this API, its recommended to call #adi_nvm_Create to create the instance and also
  * to populate configurations #ADI_NVM_CONFIG from application accordingly.
+ * The RTOS mutex of the handle is created by the first call and kept by later calls.
  * @param[in] hNvm 		- NVM service handle
  * @param[in] pConfig - Pointer to NVM service configuration.
  * @return  #ADI_NVM_STATUS_SUCCESS\n
@@ -194,6 +328,10 @@ ADI_NVM_STATUS adi_nvm_WriteBlock(ADI_NVM_HANDLE hNvm, ADI_NVM_BLOCK_DATA *pBloc
                                   uint32_t addr);
 /**
  *  @brief Read data + CRC from NVM and verifies CRC.
+ * A record that fits in one transfer is checked in the internal buffers, so pData is left
+ * unchanged when #ADI_NVM_STATUS_CRC_MISMATCH is returned. Larger records are copied to pData
+ * chunk by chunk as they arrive, and pfReadStream receives the record into pData directly, so in
+ * these cases the content of pData is undefined when #ADI_NVM_STATUS_CRC_MISMATCH is returned.
  *
  * @param[in] hNvm       - 	NVM handle
  * @param[in]  addr     -	  address to where data to be written
@@ -210,6 +348,8 @@ ADI_NVM_STATUS adi_nvm_Read(ADI_NVM_HANDLE hNvm, uint32_t addr, uint32_t numByte
 
 /**
  *  @brief Reads a block of data in a continuous memory region from the NVM and verifies CRC.
+ * As for #adi_nvm_Read, the content of pBlockData is undefined when
+ * #ADI_NVM_STATUS_CRC_MISMATCH is returned.
  *
  * @param[in] hNvm       - 	NVM handle
  * @param[in] addr       -	Start address from where the data is to be read
@@ -239,7 +379,9 @@ ADI_NVM_STATUS adi_nvm_Erase(ADI_NVM_HANDLE hNvm, uint32_t addr);
 
 /**
  *  @brief Erases block of data in the FRAM by corrupting CRC. This API finds the CRC position based
- * on the start address given and the numBlocks and numBytes fields in the pBlockData.
+ * on the start address given and the numBlocks and numBytes fields in the pBlockData. On devices
+ * with continuous access, such as MB85RS, the whole region is filled with 0xFF in as few
+ * transactions as the buffer allows instead of one transaction per CRC.
  *
  * @param[in] hNvm        -	NVM handle
  * @param[in]  addr     	-  start address from where data to be erased
@@ -255,7 +397,53 @@ ADI_NVM_STATUS adi_nvm_EraseBlock(ADI_NVM_HANDLE hNvm, uint32_t addr,
                                   ADI_NVM_BLOCK_DATA *pBlockData);
 
 /**
- *  @brief TX Callback.
+ *  @brief Queues a write of data with CRC to NVM and returns without waiting for it.
+ * The request is transferred with pfWriteAsync, which may start the transfer (for example by DMA)
+ * and return. #adi_nvm_TxCallBack must be called when the transfer is complete. Without
+ * pfWriteAsync the request is transferred with pfWrite and finished before this function
+ * returns. pfCallback of the configuration is called with the status when the request is
+ * finished. Requests are finished in the order they are queued. While requests are queued the
+ * blocking APIs return #ADI_NVM_STATUS_BUSY.
+ *
+ * @param[in] hNvm     -   	NVM handle
+ * @param[in]  pData    - 	Pointer to data. It must stay valid until pfCallback is called.
+ * @param[in]  addr     -	  address to where data to be written
+ * @param[in]  numBytes  -  number of bytes to write
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_QUEUE_FULL
+ */
+ADI_NVM_STATUS adi_nvm_WriteAsync(ADI_NVM_HANDLE hNvm, uint8_t *pData, uint32_t addr,
+                                  uint32_t numBytes);
+
+/**
+ *  @brief Queues a read of data + CRC from NVM and returns without waiting for it.
+ * The request is transferred with pfReadAsync or pfReadStreamAsync, which may start the transfer
+ * and return. #adi_nvm_RxCallBack must be called when the received data is available. Without
+ * them the request is transferred with pfRead or pfReadStream and finished before this function
+ * returns. pfCallback of the configuration is called with the status of the CRC verification
+ * when the request is finished. As for #adi_nvm_Read, the content of pData may be undefined
+ * when the status is #ADI_NVM_STATUS_CRC_MISMATCH.
+ *
+ * @param[in] hNvm       - 	NVM handle
+ * @param[in]  addr     -	  address from where data to be read
+ * @param[in] 	numBytes -   number of bytes to read
+ * @param[out]  pData     -	Pointer to read data from NVM. It must stay valid until pfCallback
+ * is called.
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_QUEUE_FULL
+ */
+ADI_NVM_STATUS adi_nvm_ReadAsync(ADI_NVM_HANDLE hNvm, uint32_t addr, uint32_t numBytes,
+                                 uint8_t *pData);
+
+/**
+ *  @brief TX Callback. Call this when a transfer started by pfWriteAsync is complete. The next
+ * transfer of the queued requests is started from this context.
  * @param[in] hNvm    -    	NVM handle
  *
  * @return  #ADI_NVM_STATUS_SUCCESS\n
@@ -264,7 +452,9 @@ ADI_NVM_STATUS adi_nvm_EraseBlock(ADI_NVM_HANDLE hNvm, uint32_t addr,
 ADI_NVM_STATUS adi_nvm_TxCallBack(ADI_NVM_HANDLE hNvm);
 
 /**
- *  @brief RX Callback.
+ *  @brief RX Callback. Call this when a transfer started by pfReadAsync or pfReadStreamAsync is
+ * complete.
+ * The next transfer of the queued requests is started from this context.
  * @param[in] hNvm     -   	NVM handle
  *
  * @return  #ADI_NVM_STATUS_SUCCESS\n
@@ -272,6 +462,108 @@ ADI_NVM_STATUS adi_nvm_TxCallBack(ADI_NVM_HANDLE hNvm);
  */
 ADI_NVM_STATUS adi_nvm_RxCallBack(ADI_NVM_HANDLE hNvm);
 
+/**
+ *  @brief Enables the write-back cache. Each record is loaded from NVM. Afterwards
+ * #adi_nvm_Write and #adi_nvm_Read of a record only access RAM, and modified bytes are written to
+ * NVM by #adi_nvm_Flush, by #adi_nvm_CacheTick or when maxDirtyBytes is reached. Other APIs that
+ * touch a record first write its modifications, and a write that partly covers a record also
+ * drops the copy. Cached records must not be accessed with the asynchronous APIs.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in] pCacheConfig  - Pointer to the cache configuration. It must stay valid while the
+ * cache is enabled. NULL writes the modified records and disables the cache.
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS adi_nvm_SetCache(ADI_NVM_HANDLE hNvm, ADI_NVM_CACHE_CONFIG *pCacheConfig);
+
+/**
+ *  @brief Writes the modified records of the cache to NVM. Each record is written from its first
+ * modified byte to its CRC in one write. Call this for example from a power-fail warning.
+ *
+ * @param[in] hNvm          - NVM handle
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS adi_nvm_Flush(ADI_NVM_HANDLE hNvm);
+
+/**
+ *  @brief Advances the time of the cache and writes the modified records when flushPeriod has
+ * elapsed since they were last written.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in] elapsed       - Time since the previous call, in the unit of flushPeriod.
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS adi_nvm_CacheTick(ADI_NVM_HANDLE hNvm, uint32_t elapsed);
+
+/**
+ *  @brief Finds the newest copy of each committed record from the headers of its two slots and
+ * verifies its record CRC. If it does not match, the copy in the other slot is used and the next
+ * #adi_nvm_Commit overwrites the torn one. The record CRC is read through the internal buffers
+ * and is only verified for slots of more than one transfer if pfUpdateCrc is configured. Call
+ * this at startup, before #adi_nvm_Commit and #adi_nvm_CommitRead.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in,out] pRecords  - Pointer to the records. slotAddr and numBytes must be set.
+ * @param[in] numRecords    - Number of records
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS adi_nvm_CommitRecover(ADI_NVM_HANDLE hNvm, ADI_NVM_COMMIT_RECORD *pRecords,
+                                     uint32_t numRecords);
+
+/**
+ *  @brief Writes a new copy of a record into the slot that does not hold the newest copy, with the
+ * next sequence number. The previous copy is kept until the next commit.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in,out] pRecord   - Pointer to the record
+ * @param[in] pBuffer       - Pointer to #ADI_NVM_COMMIT_HEADER_NUM_BYTES + numBytes bytes. The
+ * data follows the header space, which is filled by this API.
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS adi_nvm_Commit(ADI_NVM_HANDLE hNvm, ADI_NVM_COMMIT_RECORD *pRecord,
+                              uint8_t *pBuffer);
+
+/**
+ *  @brief Reads the newest copy of a record. If its CRC does not match, for example after a write
+ * torn by a power failure, the copy in the other slot is read and becomes the newest.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in,out] pRecord   - Pointer to the record
+ * @param[out] pBuffer      - Pointer to #ADI_NVM_COMMIT_HEADER_NUM_BYTES + numBytes bytes. The
+ * data is read after the header.
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH if no slot holds a valid copy \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS adi_nvm_CommitRead(ADI_NVM_HANDLE hNvm, ADI_NVM_COMMIT_RECORD *pRecord,
+                                  uint8_t *pBuffer);
+
 /**
  *  @brief Closes NVM service.
  *
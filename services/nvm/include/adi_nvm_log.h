@@ -0,0 +1,150 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file        adi_nvm_log.h
+ * @brief       Log-structured record store for the MAX32670 flash.
+ * @details
+ * Records are identified by a record ID and appended to a log spread over a set of flash pages,
+ * each with a header and CRC. An update programs a new copy at the end of the log instead of
+ * erasing a page, and a RAM index from record ID to the latest copy makes reads a single
+ * transfer. The pages are used in turn, so erases are spread evenly over them. When the log
+ * runs out of erased pages, the oldest page is compacted: its live records are copied to the end
+ * of the log and the page is erased. #adi_nvm_LogCompact does this ahead of time.
+ *
+ * The log is available when the flash backend is built (USE_NVM_FLASH). pfWrite must program
+ * the given bytes without erasing the page, and pfErase is called with the page number to erase.
+ * @addtogroup NVMAPI
+ * @{
+ */
+
+#ifndef __ADI_NVM_LOG_H__
+#define __ADI_NVM_LOG_H__
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_nvm.h"
+#include "adi_nvm_status.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*=============  D E F I N E S  =============*/
+
+/** Maximum number of data bytes of a record in the log. With transfer buffers smaller than
+ * #ADI_NVM_MAX_SIZE the record, its 6 header and CRC bytes rounded up to 16 bytes, and the 3
+ * byte flash header must fit in the transfer buffer. */
+#define ADI_NVM_LOG_MAX_RECORD_NUM_BYTES 490
+
+/** Number of bytes of RAM needed for the index of numRecordIds records */
+#define ADI_NVM_LOG_INDEX_NUM_BYTES(numRecordIds) ((numRecordIds) * sizeof(uint32_t))
+
+/**
+ * Log configuration
+ */
+typedef struct
+{
+    /** First flash page used by the log */
+    uint32_t firstPage;
+    /** Number of consecutive flash pages used by the log. Must be at least 2. */
+    uint32_t numPages;
+    /** Number of erased pages #adi_nvm_LogCompact keeps available. At least one page is always
+     * kept erased for compaction. */
+    uint32_t numSparePages;
+    /** Pointer to the RAM index, #ADI_NVM_LOG_INDEX_NUM_BYTES bytes. It must stay valid while
+     * the log is used. */
+    uint32_t *pIndex;
+    /** Number of record IDs. Record IDs are 0 to numRecordIds - 1. */
+    uint32_t numRecordIds;
+} ADI_NVM_LOG_CONFIG;
+
+/*=============  P U B L I C   P R O T O T Y P E S  =============*/
+
+/**
+ * @brief Opens the log. The page headers are read to find the order of the pages, and the
+ * records in the log are scanned to build the index. Pages that are not part of the log are
+ * erased. Call this after #adi_nvm_Init.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in] pLogConfig    - Pointer to log configuration
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_ADDRESS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_PAGE_ERASE_FAILED \n
+ * #ADI_NVM_STATUS_INIT_FAILED if the instance does not use #adi_nvm_DeviceFlcMax32670 \n
+ * #ADI_NVM_STATUS_BUSY if a queued request is in progress
+ */
+ADI_NVM_STATUS adi_nvm_LogInit(ADI_NVM_HANDLE hNvm, ADI_NVM_LOG_CONFIG *pLogConfig);
+
+/**
+ * @brief Appends a new copy of a record to the log and points the index to it. The oldest page
+ * is compacted first if the log would otherwise be left without an erased page.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in] recordId      - ID of the record
+ * @param[in] pData         - Pointer to data
+ * @param[in] numBytes      - Number of bytes, at most #ADI_NVM_LOG_MAX_RECORD_NUM_BYTES
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_ADDRESS \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_PAGE_ERASE_FAILED \n
+ * #ADI_NVM_STATUS_LOG_FULL \n
+ * #ADI_NVM_STATUS_INIT_FAILED if the log is not open \n
+ * #ADI_NVM_STATUS_BUSY if a queued request is in progress
+ */
+ADI_NVM_STATUS adi_nvm_LogWrite(ADI_NVM_HANDLE hNvm, uint32_t recordId, uint8_t *pData,
+                                uint32_t numBytes);
+
+/**
+ * @brief Reads the latest copy of a record and verifies its CRC.
+ *
+ * @param[in] hNvm          - NVM handle
+ * @param[in] recordId      - ID of the record
+ * @param[out] pData        - Pointer to read data
+ * @param[in] numBytes      - Number of bytes. Must match the size the record was written with.
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_INVALID_ADDRESS \n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH if the record was never written or is corrupted \n
+ * #ADI_NVM_STATUS_INIT_FAILED if the log is not open \n
+ * #ADI_NVM_STATUS_BUSY if a queued request is in progress
+ */
+ADI_NVM_STATUS adi_nvm_LogRead(ADI_NVM_HANDLE hNvm, uint32_t recordId, uint8_t *pData,
+                               uint32_t numBytes);
+
+/**
+ * @brief Compacts the oldest page if fewer than numSparePages pages are erased. At most one page
+ * is compacted per call, so it can be called from the idle loop.
+ *
+ * @param[in] hNvm          - NVM handle
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_PAGE_ERASE_FAILED \n
+ * #ADI_NVM_STATUS_LOG_FULL if the oldest page holds only live records \n
+ * #ADI_NVM_STATUS_INIT_FAILED if the log is not open \n
+ * #ADI_NVM_STATUS_BUSY if a queued request is in progress
+ */
+ADI_NVM_STATUS adi_nvm_LogCompact(ADI_NVM_HANDLE hNvm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_NVM_LOG_H__ */
+
+/**
+ * @}
+ */
@@ -13,15 +13,29 @@
 #ifndef __ADI_NVM_MEMORY_H__
 #define __ADI_NVM_MEMORY_H__
 
+#include "adi_nvm_private.h"
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/** State memory required in bytes for the library. Allocate a buffer aligned
+/** State memory required in bytes for the library without the transfer buffers */
+#define ADI_NVM_STATE_MEM_BASE_NUM_BYTES ((sizeof(ADI_NVM_INFO) + 3u) & ~3u)
+/** State memory required in bytes for transmit and receive buffers of transferNumBytes bytes
+ * each, a multiple of 4 of at least #ADI_NVM_MIN_TRANSFER_NUM_BYTES. Allocate a buffer aligned
  * to 32 bit boundary */
-#define ADI_NVM_STATE_MEM_NUM_BYTES 0x820
+#define ADI_NVM_STATE_MEM_NUM_BYTES_FOR(transferNumBytes)                                          \
+    (ADI_NVM_STATE_MEM_BASE_NUM_BYTES + 2u * (transferNumBytes))
+/** State memory required in bytes for the library with the default transfer buffers of
+ * #ADI_NVM_MAX_SIZE bytes. Allocate a buffer aligned to 32 bit boundary */
+#define ADI_NVM_STATE_MEM_NUM_BYTES ADI_NVM_STATE_MEM_NUM_BYTES_FOR(ADI_NVM_MAX_SIZE)
+/** Temporary memory required in bytes for transfer buffers of transferNumBytes bytes. Allocate a
+ * buffer aligned to 32 bit boundary */
+#define ADI_NVM_TEMP_MEM_NUM_BYTES_FOR(transferNumBytes) (transferNumBytes)
+/** Temporary memory required in bytes with the default transfer buffers. Allocate a buffer
+ * aligned to 32 bit boundary */
+#define ADI_NVM_TEMP_MEM_NUM_BYTES ADI_NVM_TEMP_MEM_NUM_BYTES_FOR(ADI_NVM_MAX_SIZE)
 
 /** @} */
 #ifdef __cplusplus
@@ -19,16 +19,61 @@ extern "C" {
 #endif
 
 #include "adi_nvm.h"
+#include "adi_nvm_log.h"
 #include "adi_nvm_status.h"
+#include "adi_rtos.h"
 
-/** Maximum size of buffer to store */
+/** Default size of the transfer buffers */
 #define ADI_NVM_MAX_SIZE 512
 
+/** Minimum size of the transfer buffers */
+#define ADI_NVM_MIN_TRANSFER_NUM_BYTES 64
+
+/** Number of bytes of the transfer buffers reserved for the header and CRC of a chunk */
+#define NVM_CHUNK_OVERHEAD_NUM_BYTES 6
+
+/** Number of requests that can be queued with the asynchronous APIs */
+#define ADI_NVM_QUEUE_NUM_REQUESTS 4
+
 /** Function pointer type for formatting data to be sent to the NVM device (internal use). */
 typedef uint32_t (*NvmFormatFunc)(void *, uint8_t *);
 /** Function pointer type for the internal erase function called by the erase API. */
 typedef ADI_NVM_STATUS (*NvmEraseFunc)(void *, uint32_t);
 
+/**
+ * Request queued by the asynchronous APIs
+ */
+typedef struct
+{
+    /** Command of the request, #ADI_NVM_WRITE or #ADI_NVM_READ */
+    ADI_NVM_CMD cmd;
+    /** Pointer to data of the request */
+    uint8_t *pData;
+    /** Address of the record */
+    uint32_t addr;
+    /** Number of bytes of the record */
+    uint32_t numBytes;
+} NvmRequest;
+
+/**
+ * State of the log-structured record store
+ */
+typedef struct
+{
+    /** Log configuration. pIndex is NULL when the log is not open. */
+    ADI_NVM_LOG_CONFIG config;
+    /** Index of the oldest page of the log, from firstPage */
+    uint32_t tailPage;
+    /** Index of the page records are appended to, from firstPage */
+    uint32_t headPage;
+    /** Number of pages in the log, the others are erased */
+    uint32_t numActivePages;
+    /** Offset in the head page where the next record is programmed */
+    uint32_t writeOffset;
+    /** Sequence number of the head page */
+    uint32_t headSequence;
+} NvmLog;
+
 /**
  * NVM info
  */
@@ -36,18 +81,24 @@ typedef struct
 {
     /** NVM configuration*/
     ADI_NVM_CONFIG config;
+    /** Device backend the fields below are copied from by #adi_nvm_Init */
+    const ADI_NVM_DEVICE *pDevice;
     /** Function pointer to the device-specific internal function to be called. */
     NvmFormatFunc pfFormat;
     /** Function pointer to the device-specific internal function to be called. */
     NvmEraseFunc pfEraseFn;
     /** Maximum number of bytes the function can write to NVM device. */
     uint32_t maxNumBytes;
-    /** Tx Data to be sent */
-    uint8_t txData[ADI_NVM_MAX_SIZE];
-    /** Rx data received */
-    uint8_t rxData[ADI_NVM_MAX_SIZE];
-    /** temporary buffer. */
-    uint8_t tempBuffer[ADI_NVM_MAX_SIZE];
+    /** Tx Data to be sent, transferNumBytes bytes in the state memory */
+    uint8_t *txData;
+    /** Rx data received, transferNumBytes bytes in the state memory */
+    uint8_t *rxData;
+    /** temporary buffer. Temporary memory that may be shared with other handles. */
+    uint8_t *tempBuffer;
+    /** Size of txData and rxData */
+    uint32_t transferNumBytes;
+    /** Maximum number of data bytes in one chunk. Leaves room for the header and CRC in txData. */
+    uint32_t maxChunkNumBytes;
     /** buffer to be filled with 0xFF to erase contents in FRAM */
     uint8_t eraseData[NUM_CRC_BYTES];
     /** product id of device */
@@ -56,8 +107,58 @@ typedef struct
     uint8_t isErase;
     /** Offset in the rxData buffer where the data starts */
     uint16_t rxOffset;
+    /** Set by the device when the address keeps incrementing for as long as a transfer runs, so
+     * any length and consecutive records can be read or written with a single command header */
+    uint8_t isContinuousAccess;
+    /** Requests queued by the asynchronous APIs */
+    NvmRequest queue[ADI_NVM_QUEUE_NUM_REQUESTS];
+    /** Number of requests queued since create. Only written by the API. */
+    volatile uint32_t queueWriteCount;
+    /** Number of requests finished since create. Only written by the queue engine. */
+    volatile uint32_t queueReadCount;
+    /** Offset in the record of the chunk in flight */
+    uint32_t requestOffset;
+    /** Number of data bytes of the chunk in flight */
+    uint32_t requestChunkSize;
+    /** CRC of the request in progress */
+    uint16_t requestCrc;
+    /** Set from the first queued request until the queue is found empty */
+    volatile uint8_t isQueueActive;
+    /** Set while the queue engine is starting transfers */
+    volatile uint8_t isQueueRunning;
+    /** Set by the callbacks when a transfer completes while isQueueRunning is set */
+    volatile uint8_t isTransferDone;
+    /** Configuration of the write-back cache. pRecords is NULL when the cache is disabled. */
+    ADI_NVM_CACHE_CONFIG cache;
+    /** Number of bytes the modified records of the cache will write */
+    uint32_t cacheDirtyBytes;
+    /** Time elapsed since the cache was last written */
+    uint32_t cacheElapsed;
+    /** Log-structured record store of the flash backend */
+    NvmLog log;
+    /** Serialises the API calls of several threads when CMSIS_OS2 is defined */
+    ADI_RTOS_MUTEX lock;
 } ADI_NVM_INFO;
 
+/**
+ * Operations and parameters of a device backend
+ */
+struct NvmDeviceOps
+{
+    /** Initializes the device, for example checks its ID. NULL if nothing is required. */
+    ADI_NVM_STATUS (*pfInit)(ADI_NVM_INFO *pInfo);
+    /** Formats the command header of a transfer */
+    NvmFormatFunc pfFormat;
+    /** Erases the record at an address */
+    NvmEraseFunc pfErase;
+    /** Maximum number of data bytes of a record */
+    uint32_t maxNumBytes;
+    /** Offset in the rxData buffer where the data starts */
+    uint16_t rxOffset;
+    /** Set when the address keeps incrementing for as long as a transfer runs */
+    uint8_t isContinuousAccess;
+};
+
 #ifdef __cplusplus
 }
 #endif
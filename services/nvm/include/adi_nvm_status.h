@@ -73,7 +73,17 @@ typedef enum
     /** Invalid address received */
     ADI_NVM_STATUS_INVALID_ADDRESS,
     /** Erase failed */
-    ADI_NVM_STATUS_PAGE_ERASE_FAILED
+    ADI_NVM_STATUS_PAGE_ERASE_FAILED,
+    /** Queue of asynchronous requests is full */
+    ADI_NVM_STATUS_QUEUE_FULL,
+    /** Blocking API called while asynchronous requests are in progress */
+    ADI_NVM_STATUS_BUSY,
+    /** Live records of the log fill all its pages */
+    ADI_NVM_STATUS_LOG_FULL,
+    /** Temporary memory provided to #adi_nvm_Create is less than required memory
+     * for the transfer buffers.
+     */
+    ADI_NVM_STATUS_INSUFFICIENT_TEMP_MEMORY
 } ADI_NVM_STATUS;
 
 /** @} */
@@ -0,0 +1,110 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file    nvm_cache.h
+ * @brief   Write-back RAM cache of NVM records
+ * @addtogroup  ADI_NVM
+ */
+
+#ifndef __NVM_CACHE_H__
+#define __NVM_CACHE_H__
+
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adi_nvm_private.h"
+#include "adi_nvm_status.h"
+
+/**
+ *  @brief Sets the cache configuration and loads the records from NVM.
+ *
+ *  @param[in] pInfo 		- pointer to NVM data
+ *  @param[in] pCacheConfig - pointer to the cache configuration, NULL to disable the cache
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmCacheInit(ADI_NVM_INFO *pInfo, ADI_NVM_CACHE_CONFIG *pCacheConfig);
+
+/**
+ *  @brief Writes a record into the cache if it is one of the cached records.
+ *
+ *  @param[in] pInfo 		- pointer to NVM data
+ * 	@param[in]  pData     	Pointer to data
+ * 	@param[in]  addr     	  address of the record
+ * 	@param[in]  numBytes    number of bytes of the record
+ * 	@param[out] pIsCached   set to 1 if the write was done in the cache
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmCacheWrite(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t numBytes,
+                             uint8_t *pIsCached);
+
+/**
+ *  @brief Reads a record from the cache if it is one of the cached records.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in]  addr     	  address of the record
+ * @param[in] 	numBytes    number of bytes of the record
+ * @param[out]  pData     	Pointer to read data
+ * @param[out]  pIsCached   set to 1 if the read was done from the cache
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+ADI_NVM_STATUS NvmCacheRead(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes, uint8_t *pData,
+                            uint8_t *pIsCached);
+
+/**
+ *  @brief Writes the modifications of cached records overlapping an NVM region that is about to
+ * be accessed without the cache.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in]  addr     	  start address of the region
+ * @param[in] 	numBytes    number of bytes of the region, including CRCs
+ * @param[in]  isWrite      1 if the region is modified, which also drops the cached copies
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmCacheSync(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes,
+                            uint8_t isWrite);
+
+/**
+ *  @brief Writes all modified records of the cache to NVM.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmCacheFlush(ADI_NVM_INFO *pInfo);
+
+/**
+ *  @brief Advances the time of the cache and writes the modified records when the flush period
+ * has elapsed.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] elapsed       - time since the previous call
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmCacheTick(ADI_NVM_INFO *pInfo, uint32_t elapsed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NVM_CACHE_H__ */
+
+/*
+** EOF
+*/
@@ -0,0 +1,76 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file    nvm_commit.h
+ * @brief   Records committed alternately to two slots
+ * @addtogroup  ADI_NVM
+ */
+
+#ifndef __NVM_COMMIT_H__
+#define __NVM_COMMIT_H__
+
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adi_nvm_private.h"
+#include "adi_nvm_status.h"
+
+/**
+ *  @brief Reads the headers of both slots of a record and selects the newest copy whose record
+ * CRC matches.
+ *
+ *  @param[in] pInfo 		- pointer to NVM data
+ *  @param[in,out] pRecord  - pointer to the record
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS NvmCommitRecover(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord);
+
+/**
+ *  @brief Writes a record with the next sequence number into the slot not holding the newest copy.
+ * The data and the record CRC are written first and the header last.
+ *
+ *  @param[in] pInfo 		- pointer to NVM data
+ *  @param[in,out] pRecord  - pointer to the record
+ *  @param[in] pBuffer      - pointer to the header space followed by the data
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS NvmCommitWrite(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                              uint8_t *pBuffer);
+
+/**
+ *  @brief Reads the newest copy of a record, falling back to the other slot on a CRC mismatch.
+ *
+ *  @param[in] pInfo 		- pointer to NVM data
+ *  @param[in,out] pRecord  - pointer to the record
+ *  @param[out] pBuffer     - pointer to the header space followed by the data
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH \n
+ * #ADI_NVM_STATUS_BUSY
+ */
+ADI_NVM_STATUS NvmCommitRead(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                             uint8_t *pBuffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NVM_COMMIT_H__ */
+
+/*
+** EOF
+*/
@@ -34,32 +34,43 @@ typedef struct
 } NvmDeviceCmdFormat;
 
 /**
- * @brief Initializes NVM Service.
+ * @brief Initializes NVM Service. Copies the parameters of the device backend in the configuration
+ * and initializes the device.
  * @param[in] pInfo 		- pointer to NVM data
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_NULL_PTR if no device backend is configured \n
+ * status of the device initialization
  */
 ADI_NVM_STATUS NvmInit(ADI_NVM_INFO *pInfo);
 
 /**
- *  @brief Initializes device-specific parameters, such as assigning internal function pointers for
- * NVM format and erase operations.
+ *  @brief Performs a write operation in the non volatile memory device
  *
  *  @param[in] pInfo 		- pointer to NVM data
+ * 	@param[in]  pData     	Pointer to data
+ * 	@param[in]  addr     	  address to where data to be written
+ * 	@param[in]  numBytes    number of bytes to write
  *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
  */
-ADI_NVM_STATUS NvmDeviceInit(ADI_NVM_INFO *pInfo);
+ADI_NVM_STATUS NvmWrite(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t numBytes);
 
 /**
- *  @brief Performs a write operation in the non volatile memory device
+ *  @brief Writes the data of a record from startOffset to its end followed by the CRC of the
+ * whole record. Bytes before startOffset are expected to be in NVM already.
  *
  *  @param[in] pInfo 		- pointer to NVM data
- * 	@param[in]  pData     	Pointer to data
- * 	@param[in]  addr     	  address to where data to be written
- * 	@param[in]  numBytes    number of bytes to write
+ * 	@param[in]  pData     	Pointer to data of the whole record
+ * 	@param[in]  addr     	  address of the record
+ * 	@param[in]  numBytes    number of bytes of the record
+ * 	@param[in]  startOffset offset of the first byte to write
  *
  * @return  #ADI_NVM_STATUS_SUCCESS\n
  * #ADI_NVM_STATUS_COMM_ERROR
  */
-ADI_NVM_STATUS NvmWrite(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t numBytes);
+ADI_NVM_STATUS NvmWriteRange(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t numBytes,
+                             uint32_t startOffset);
 
 /**
  *  @brief Performs a read operation in the non volatile memory device
@@ -75,6 +86,123 @@ ADI_NVM_STATUS NvmWrite(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint
  */
 ADI_NVM_STATUS NvmRead(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes, uint8_t *pData);
 
+/**
+ *  @brief Reads the first bytes of a record without checking its CRC.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in]  addr     	  address of the record
+ * @param[in] 	numBytes    number of bytes to read, at most one chunk
+ * @param[out]  pData     	Pointer to read data
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmReadHeader(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes,
+                             uint8_t *pData);
+
+/**
+ *  @brief Writes the first bytes of a record without its CRC. The CRC of the record must already
+ * cover them.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in]  pData     	Pointer to the bytes to write
+ * @param[in]  addr     	  address of the record
+ * @param[in] 	numBytes    number of bytes to write, at most one chunk
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmWriteHeader(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr,
+                              uint32_t numBytes);
+
+/**
+ *  @brief Reads a record chunk by chunk through the internal buffers and verifies its CRC
+ * without copying it out.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in]  addr     	  address of the record
+ * @param[in] 	numBytes    number of bytes of the record
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS if the record does not fit in one transfer and
+ * pfUpdateCrc is not configured \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+ADI_NVM_STATUS NvmVerify(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes);
+
+/**
+ *  @brief Writes consecutive records with their CRCs as one stream with a command header per
+ * transfer of up to #ADI_NVM_MAX_SIZE bytes. Only for devices with isContinuousAccess set.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pBlockData    - Pointer to the block data structure containing the data
+ * @param[in] addr          - Starting address in the NVM
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmWriteBlock(ADI_NVM_INFO *pInfo, ADI_NVM_BLOCK_DATA *pBlockData, uint32_t addr);
+
+/**
+ *  @brief Reads consecutive records with their CRCs as one stream and verifies them. Only for
+ * devices with isContinuousAccess set.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] addr          - Starting address in the NVM
+ * @param[out] pBlockData   - Pointer to the block data structure where the data will be stored
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+ADI_NVM_STATUS NvmReadBlock(ADI_NVM_INFO *pInfo, uint32_t addr, ADI_NVM_BLOCK_DATA *pBlockData);
+
+/**
+ *  @brief Invalidates consecutive records by filling the whole region, data and CRCs, with 0xFF
+ * as one stream with a command header per transfer of up to #ADI_NVM_MAX_SIZE bytes. Only for
+ * devices with isContinuousAccess set.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] addr          - Starting address in the NVM
+ * @param[in] pBlockData    - Pointer to the block data structure. Only numBlocks and numBytes
+ * are used.
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+ADI_NVM_STATUS NvmEraseBlock(ADI_NVM_INFO *pInfo, uint32_t addr, ADI_NVM_BLOCK_DATA *pBlockData);
+
+/**
+ *  @brief Queues a read or write request and starts it if the queue is idle.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] cmd           - #ADI_NVM_WRITE or #ADI_NVM_READ
+ * @param[in]  pData     	Pointer to data. It must stay valid until the request is finished.
+ * @param[in]  addr     	  address of the record
+ * @param[in] 	numBytes    number of bytes of the record
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS \n
+ * #ADI_NVM_STATUS_QUEUE_FULL
+ */
+ADI_NVM_STATUS NvmQueueRequest(ADI_NVM_INFO *pInfo, ADI_NVM_CMD cmd, uint8_t *pData,
+                               uint32_t addr, uint32_t numBytes);
+
+/**
+ *  @brief Continues the queued request after the transfer started by it is complete.
+ *
+ * @param[in] pInfo 		- pointer to NVM data
+ *
+ * @return  #ADI_NVM_STATUS_SUCCESS
+ */
+ADI_NVM_STATUS NvmQueueTransferDone(ADI_NVM_INFO *pInfo);
+
 #ifdef __cplusplus
 }
 #endif
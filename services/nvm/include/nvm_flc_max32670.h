@@ -0,0 +1,32 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file    nvm_flc_max32670.h
+ * @brief   Definitions of the MAX32670 flash shared by the flash backend sources
+ * @addtogroup  ADI_NVM
+ */
+
+#ifndef __NVM_FLC_MAX32670_H__
+#define __NVM_FLC_MAX32670_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Total size of the non-volatile memory */
+#define NVM_FLC_PAGE_SIZE 8192
+
+/** Number of bytes for the header to be included (pgeNum + offset) to send to Flash */
+#define FLASH_HEADER_NUM_BYTES 3
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NVM_FLC_MAX32670_H__ */
+
+/*
+** EOF
+*/
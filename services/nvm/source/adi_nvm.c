@@ -9,19 +9,31 @@
  */
 
 #include "adi_nvm.h"
+#include "adi_nvm_memory.h"
 #include "adi_nvm_private.h"
+#include "nvm_cache.h"
+#include "nvm_commit.h"
 #include "nvm_device.h"
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
-ADI_NVM_STATUS adi_nvm_Create(ADI_NVM_HANDLE *phNvm, void *pStateMemory, uint32_t stateMemorySize)
+/**
+ * @brief Returns the number of bytes in NVM covered by the blocks including their CRCs.
+ * @param[in] pBlockData - Pointer to block data
+ * @return Number of bytes.
+ */
+static uint32_t NvmBlockRegionSize(ADI_NVM_BLOCK_DATA *pBlockData);
+
+ADI_NVM_STATUS adi_nvm_Create(ADI_NVM_HANDLE *phNvm, void *pStateMemory, uint32_t stateMemorySize,
+                              void *pTempMemory, uint32_t tempMemorySize)
 {
     ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
     ADI_NVM_INFO *pInfo = NULL;
-    uint32_t reqSize = sizeof(ADI_NVM_INFO);
+    uint32_t reqSize = ADI_NVM_STATE_MEM_NUM_BYTES_FOR(ADI_NVM_MIN_TRANSFER_NUM_BYTES);
+    uint32_t transferNumBytes;
     /* Check the given pointers before we set their contents */
-    if ((phNvm == (void *)NULL) || (pStateMemory == (void *)NULL))
+    if ((phNvm == (void *)NULL) || (pStateMemory == (void *)NULL) || (pTempMemory == (void *)NULL))
     {
         return ADI_NVM_STATUS_NULL_PTR;
     }
@@ -34,11 +46,23 @@ ADI_NVM_STATUS adi_nvm_Create(ADI_NVM_HANDLE *phNvm, void *pStateMemory, uint32_
         {
             return ADI_NVM_STATUS_INSUFFICIENT_STATE_MEMORY;
         }
+        // The memory after ADI_NVM_INFO is split between txData and rxData, keeping rxData 32 bit
+        // aligned.
+        transferNumBytes = ((stateMemorySize - ADI_NVM_STATE_MEM_BASE_NUM_BYTES) / 2) & ~3u;
+        if (tempMemorySize < ADI_NVM_TEMP_MEM_NUM_BYTES_FOR(transferNumBytes))
+        {
+            return ADI_NVM_STATUS_INSUFFICIENT_TEMP_MEMORY;
+        }
         else
         {
             pInfo = (ADI_NVM_INFO *)pStateMemory;
             *phNvm = (ADI_NVM_HANDLE *)pInfo;
             memset(pInfo, 0, sizeof(ADI_NVM_INFO));
+            pInfo->txData = (uint8_t *)pStateMemory + ADI_NVM_STATE_MEM_BASE_NUM_BYTES;
+            pInfo->rxData = pInfo->txData + transferNumBytes;
+            pInfo->tempBuffer = (uint8_t *)pTempMemory;
+            pInfo->transferNumBytes = transferNumBytes;
+            pInfo->maxChunkNumBytes = transferNumBytes - NVM_CHUNK_OVERHEAD_NUM_BYTES;
         }
     }
     return status;
@@ -56,7 +80,19 @@ ADI_NVM_STATUS adi_nvm_Init(ADI_NVM_HANDLE hNvm, ADI_NVM_CONFIG *pConfig)
     else
     {
         pInfo->config = *pConfig;
-        NvmInit(pInfo);
+        /* The mutex of an earlier adi_nvm_Init may be held by another task, so keep it. */
+        if (ADI_RTOS_IS_CREATED(pInfo->lock) == 0)
+        {
+            ADI_RTOS_MUTEX_NEW(pInfo->lock);
+        }
+        if (ADI_RTOS_IS_CREATED(pInfo->lock) == 0)
+        {
+            status = ADI_NVM_STATUS_INIT_FAILED;
+        }
+        else
+        {
+            status = NvmInit(pInfo);
+        }
     }
     return status;
 }
@@ -71,7 +107,9 @@ ADI_NVM_STATUS adi_nvm_SetConfig(ADI_NVM_HANDLE hNvm, ADI_NVM_CONFIG *pConfig)
     }
     else
     {
+        ADI_RTOS_LOCK(pInfo->lock);
         pInfo->config = *pConfig;
+        ADI_RTOS_UNLOCK(pInfo->lock);
     }
     return status;
 }
@@ -80,13 +118,20 @@ ADI_NVM_STATUS adi_nvm_Write(ADI_NVM_HANDLE hNvm, uint8_t *pData, uint32_t addr,
 {
     ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
     ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    uint8_t isCached = 0;
     if (hNvm == NULL)
     {
         status = ADI_NVM_STATUS_NULL_PTR;
     }
     else
     {
-        status = NvmWrite(pInfo, pData, addr, numBytes);
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmCacheWrite(pInfo, pData, addr, numBytes, &isCached);
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (isCached == 0))
+        {
+            status = NvmWrite(pInfo, pData, addr, numBytes);
+        }
+        ADI_RTOS_UNLOCK(pInfo->lock);
     }
 
     return status;
@@ -105,20 +150,33 @@ ADI_NVM_STATUS adi_nvm_WriteBlock(ADI_NVM_HANDLE hNvm, ADI_NVM_BLOCK_DATA *pBloc
     }
     else
     {
-        // Write data from pBlockData to NVM starting from the given address in a contiguous memory
-        // region, including CRC. For each block, the data is written from pBlockData at the
-        // corresponding offset determined by incrAddress. The address in NVM is incremented by the
-        // size of each block (numBytes) plus the size of the CRC (ADI_NVM_NUM_BYTES_CRC).
-        for (i = 0; i < pBlockData->numBlocks; i++)
+        ADI_RTOS_LOCK(pInfo->lock);
+        // Modified cached records in the region are written first.
+        status = NvmCacheSync(pInfo, addr, NvmBlockRegionSize(pBlockData), 1);
+
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (pInfo->isContinuousAccess == 1))
+        {
+            status = NvmWriteBlock(pInfo, pBlockData, addr);
+        }
+        else if (status == ADI_NVM_STATUS_SUCCESS)
         {
-            pWriteData = pBlockData->pData + pBlockData->incrAddress * i;
-            status = NvmWrite(pInfo, pWriteData, addr, pBlockData->numBytes);
-            if (status != ADI_NVM_STATUS_SUCCESS)
+            // Write data from pBlockData to NVM starting from the given address in a contiguous
+            // memory region, including CRC. For each block, the data is written from pBlockData at
+            // the corresponding offset determined by incrAddress. The address in NVM is incremented
+            // by the size of each block (numBytes) plus the size of the CRC
+            // (ADI_NVM_NUM_BYTES_CRC).
+            for (i = 0; i < pBlockData->numBlocks; i++)
             {
-                break;
+                pWriteData = pBlockData->pData + pBlockData->incrAddress * i;
+                status = NvmWrite(pInfo, pWriteData, addr, pBlockData->numBytes);
+                if (status != ADI_NVM_STATUS_SUCCESS)
+                {
+                    break;
+                }
+                addr += pBlockData->numBytes + ADI_NVM_NUM_BYTES_CRC;
             }
-            addr += pBlockData->numBytes + ADI_NVM_NUM_BYTES_CRC;
         }
+        ADI_RTOS_UNLOCK(pInfo->lock);
     }
     return status;
 }
@@ -127,13 +185,20 @@ ADI_NVM_STATUS adi_nvm_Read(ADI_NVM_HANDLE hNvm, uint32_t addr, uint32_t numByte
 {
     ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
     ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    uint8_t isCached = 0;
     if (hNvm == NULL)
     {
         status = ADI_NVM_STATUS_NULL_PTR;
     }
     else
     {
-        status = NvmRead(pInfo, addr, numBytes, pData);
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmCacheRead(pInfo, addr, numBytes, pData, &isCached);
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (isCached == 0))
+        {
+            status = NvmRead(pInfo, addr, numBytes, pData);
+        }
+        ADI_RTOS_UNLOCK(pInfo->lock);
     }
     return status;
 }
@@ -150,20 +215,32 @@ ADI_NVM_STATUS adi_nvm_ReadBlock(ADI_NVM_HANDLE hNvm, uint32_t addr, ADI_NVM_BLO
     }
     else
     {
-        // Read data from NVM starting from the given address in a contiguous memory region,
-        // including CRC. For each block, the data is stored in pBlockData at the corresponding
-        // offset determined by incrAddress. The address in NVM is incremented by the size of each
-        // block (numBytes) plus the size of the CRC (ADI_NVM_NUM_BYTES_CRC).
-        for (i = 0; i < pBlockData->numBlocks; i++)
+        ADI_RTOS_LOCK(pInfo->lock);
+        // Modified cached records in the region are written first.
+        status = NvmCacheSync(pInfo, addr, NvmBlockRegionSize(pBlockData), 0);
+
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (pInfo->isContinuousAccess == 1))
+        {
+            status = NvmReadBlock(pInfo, addr, pBlockData);
+        }
+        else if (status == ADI_NVM_STATUS_SUCCESS)
         {
-            pReadData = pBlockData->pData + pBlockData->incrAddress * i;
-            status = NvmRead(pInfo, addr, pBlockData->numBytes, pReadData);
-            if (status != ADI_NVM_STATUS_SUCCESS)
+            // Read data from NVM starting from the given address in a contiguous memory region,
+            // including CRC. For each block, the data is stored in pBlockData at the corresponding
+            // offset determined by incrAddress. The address in NVM is incremented by the size of
+            // each block (numBytes) plus the size of the CRC (ADI_NVM_NUM_BYTES_CRC).
+            for (i = 0; i < pBlockData->numBlocks; i++)
             {
-                break;
+                pReadData = pBlockData->pData + pBlockData->incrAddress * i;
+                status = NvmRead(pInfo, addr, pBlockData->numBytes, pReadData);
+                if (status != ADI_NVM_STATUS_SUCCESS)
+                {
+                    break;
+                }
+                addr += pBlockData->numBytes + ADI_NVM_NUM_BYTES_CRC;
             }
-            addr += pBlockData->numBytes + ADI_NVM_NUM_BYTES_CRC;
         }
+        ADI_RTOS_UNLOCK(pInfo->lock);
     }
     return status;
 }
@@ -178,7 +255,15 @@ ADI_NVM_STATUS adi_nvm_Erase(ADI_NVM_HANDLE hNvm, uint32_t addr)
     }
     else
     {
-        status = pInfo->pfEraseFn(pInfo, addr);
+        ADI_RTOS_LOCK(pInfo->lock);
+        // Modified cached records in the region are written first.
+        status = NvmCacheSync(pInfo, addr, ADI_NVM_NUM_BYTES_CRC, 1);
+
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            status = pInfo->pfEraseFn(pInfo, addr);
+        }
+        ADI_RTOS_UNLOCK(pInfo->lock);
     }
     return status;
 }
@@ -195,26 +280,247 @@ ADI_NVM_STATUS adi_nvm_EraseBlock(ADI_NVM_HANDLE hNvm, uint32_t addr,
     }
     else
     {
-        pInfo->isErase = 1;
-        // Corrupt the CRC in NVM starting from the given address in a contiguous memory region.
-        // For each block, the address determined by the number of  bytes present and the size of
-        // the CRC (ADI_NVM_NUM_BYTES_CRC).
-        memset(&pInfo->eraseData[0], 0xff, ADI_NVM_NUM_BYTES_CRC);
-        for (j = 0; j < pBlockData->numBlocks; j++)
+        ADI_RTOS_LOCK(pInfo->lock);
+        // Modified cached records in the region are written first.
+        status = NvmCacheSync(pInfo, addr, NvmBlockRegionSize(pBlockData), 1);
+
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (pInfo->isContinuousAccess == 1) &&
+            (pBlockData->numBlocks > 0) &&
+            (pBlockData->numBytes + ADI_NVM_NUM_BYTES_CRC <= pInfo->maxChunkNumBytes))
         {
-            addr += pBlockData->numBytes;
-            status = pInfo->pfEraseFn(pInfo, addr);
-            if (status != ADI_NVM_STATUS_SUCCESS)
+            // Records fit in a chunk, so filling the whole region takes no more transactions than
+            // writing each CRC, and usually far fewer.
+            status = NvmEraseBlock(pInfo, addr, pBlockData);
+        }
+        else if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            pInfo->isErase = 1;
+            // Corrupt the CRC in NVM starting from the given address in a contiguous memory region.
+            // For each block, the address determined by the number of  bytes present and the size
+            // of the CRC (ADI_NVM_NUM_BYTES_CRC).
+            memset(&pInfo->eraseData[0], 0xff, ADI_NVM_NUM_BYTES_CRC);
+            for (j = 0; j < pBlockData->numBlocks; j++)
+            {
+                addr += pBlockData->numBytes;
+                status = pInfo->pfEraseFn(pInfo, addr);
+                if (status != ADI_NVM_STATUS_SUCCESS)
+                {
+                    break;
+                }
+                addr += ADI_NVM_NUM_BYTES_CRC;
+            }
+            pInfo->isErase = 0;
+        }
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_WriteAsync(ADI_NVM_HANDLE hNvm, uint8_t *pData, uint32_t addr,
+                                  uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if ((hNvm == NULL) || (pData == NULL))
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmQueueRequest(pInfo, ADI_NVM_WRITE, pData, addr, numBytes);
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_ReadAsync(ADI_NVM_HANDLE hNvm, uint32_t addr, uint32_t numBytes,
+                                 uint8_t *pData)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if ((hNvm == NULL) || (pData == NULL))
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmQueueRequest(pInfo, ADI_NVM_READ, pData, addr, numBytes);
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_TxCallBack(ADI_NVM_HANDLE hNvm)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if (hNvm == NULL)
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        status = NvmQueueTransferDone(pInfo);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_RxCallBack(ADI_NVM_HANDLE hNvm)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if (hNvm == NULL)
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        status = NvmQueueTransferDone(pInfo);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_SetCache(ADI_NVM_HANDLE hNvm, ADI_NVM_CACHE_CONFIG *pCacheConfig)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    uint32_t i;
+    if (hNvm == NULL)
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else if (pCacheConfig != NULL)
+    {
+        if ((pCacheConfig->pRecords == NULL) && (pCacheConfig->numRecords != 0))
+        {
+            status = ADI_NVM_STATUS_NULL_PTR;
+        }
+        for (i = 0; (status == ADI_NVM_STATUS_SUCCESS) && (i < pCacheConfig->numRecords); i++)
+        {
+            if (pCacheConfig->pRecords[i].pData == NULL)
+            {
+                status = ADI_NVM_STATUS_NULL_PTR;
+            }
+            else if ((pCacheConfig->pRecords[i].numBytes == 0) ||
+                     (pCacheConfig->pRecords[i].numBytes > pInfo->maxNumBytes))
             {
-                break;
+                status = ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
             }
-            addr += ADI_NVM_NUM_BYTES_CRC;
         }
-        pInfo->isErase = 0;
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmCacheInit(pInfo, pCacheConfig);
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_Flush(ADI_NVM_HANDLE hNvm)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if (hNvm == NULL)
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmCacheFlush(pInfo);
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_CacheTick(ADI_NVM_HANDLE hNvm, uint32_t elapsed)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if (hNvm == NULL)
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmCacheTick(pInfo, elapsed);
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_CommitRecover(ADI_NVM_HANDLE hNvm, ADI_NVM_COMMIT_RECORD *pRecords,
+                                     uint32_t numRecords)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    uint32_t i;
+    if ((hNvm == NULL) || ((pRecords == NULL) && (numRecords != 0)))
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        for (i = 0; (status == ADI_NVM_STATUS_SUCCESS) && (i < numRecords); i++)
+        {
+            status = NvmCommitRecover(pInfo, &pRecords[i]);
+        }
+        ADI_RTOS_UNLOCK(pInfo->lock);
     }
     return status;
 }
 
+ADI_NVM_STATUS adi_nvm_Commit(ADI_NVM_HANDLE hNvm, ADI_NVM_COMMIT_RECORD *pRecord,
+                              uint8_t *pBuffer)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if ((hNvm == NULL) || (pRecord == NULL) || (pBuffer == NULL))
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmCommitWrite(pInfo, pRecord, pBuffer);
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_CommitRead(ADI_NVM_HANDLE hNvm, ADI_NVM_COMMIT_RECORD *pRecord,
+                                  uint8_t *pBuffer)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    if ((hNvm == NULL) || (pRecord == NULL) || (pBuffer == NULL))
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        ADI_RTOS_LOCK(pInfo->lock);
+        status = NvmCommitRead(pInfo, pRecord, pBuffer);
+        ADI_RTOS_UNLOCK(pInfo->lock);
+    }
+    return status;
+}
+
+uint32_t NvmBlockRegionSize(ADI_NVM_BLOCK_DATA *pBlockData)
+{
+    uint32_t size = 0;
+    if (pBlockData->numBlocks > 0)
+    {
+        size = (pBlockData->numBytes + ADI_NVM_NUM_BYTES_CRC) * (uint32_t)pBlockData->numBlocks;
+    }
+    return size;
+}
+
 /**
  * @}
  */
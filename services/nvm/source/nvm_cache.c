@@ -0,0 +1,273 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file    nvm_cache.c
+ * @brief   Write-back RAM cache of NVM records. Writes of a cached record only update RAM and
+ * track the first modified byte. Modified records are written from that byte to their CRC.
+ * @{
+ */
+
+#include "nvm_cache.h"
+#include "adi_nvm.h"
+#include "adi_nvm_private.h"
+#include "adi_nvm_status.h"
+#include "nvm_device.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Finds the cached record with the given address and size.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] addr          - address of the record
+ * @param[in] numBytes      - number of bytes of the record
+ * @return Pointer to the record, NULL if it is not cached.
+ */
+static ADI_NVM_CACHE_RECORD *NvmCacheFind(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes);
+
+/**
+ * @brief Writes a modified record to NVM.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pRecord       - pointer to the record
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+static ADI_NVM_STATUS NvmCacheFlushRecord(ADI_NVM_INFO *pInfo, ADI_NVM_CACHE_RECORD *pRecord);
+
+ADI_NVM_STATUS NvmCacheInit(ADI_NVM_INFO *pInfo, ADI_NVM_CACHE_CONFIG *pCacheConfig)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_CACHE_RECORD *pRecord;
+    uint32_t i;
+
+    // Modifications of the previous configuration are written before it is replaced.
+    status = NvmCacheFlush(pInfo);
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pInfo->cache.pRecords = NULL;
+        pInfo->cacheDirtyBytes = 0;
+        pInfo->cacheElapsed = 0;
+        if (pCacheConfig != NULL)
+        {
+            for (i = 0; i < pCacheConfig->numRecords; i++)
+            {
+                pRecord = &pCacheConfig->pRecords[i];
+                pRecord->isDirty = 0;
+                pRecord->isValid = 0;
+                pRecord->dirtyStart = 0;
+                status = NvmRead(pInfo, pRecord->addr, pRecord->numBytes, pRecord->pData);
+                if (status == ADI_NVM_STATUS_SUCCESS)
+                {
+                    pRecord->isValid = 1;
+                }
+                else if (status == ADI_NVM_STATUS_CRC_MISMATCH)
+                {
+                    // Record not written yet, it is loaded by the first write.
+                    status = ADI_NVM_STATUS_SUCCESS;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            if (status == ADI_NVM_STATUS_SUCCESS)
+            {
+                pInfo->cache = *pCacheConfig;
+            }
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCacheWrite(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t numBytes,
+                             uint8_t *pIsCached)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_CACHE_RECORD *pRecord;
+    uint32_t first = 0;
+
+    *pIsCached = 0;
+    pRecord = NvmCacheFind(pInfo, addr, numBytes);
+    if (pRecord == NULL)
+    {
+        status = NvmCacheSync(pInfo, addr, numBytes + NUM_CRC_BYTES, 1);
+    }
+    else
+    {
+        *pIsCached = 1;
+        // Unchanged leading bytes need not be written again.
+        if (pRecord->isValid == 1)
+        {
+            while ((first < numBytes) && (pRecord->pData[first] == pData[first]))
+            {
+                first++;
+            }
+        }
+        if (first < numBytes)
+        {
+            memcpy(&pRecord->pData[first], &pData[first], numBytes - first);
+            pRecord->isValid = 1;
+            if (pRecord->isDirty == 0)
+            {
+                pRecord->isDirty = 1;
+                pRecord->dirtyStart = first;
+                pInfo->cacheDirtyBytes += numBytes - first;
+            }
+            else if (first < pRecord->dirtyStart)
+            {
+                pInfo->cacheDirtyBytes += pRecord->dirtyStart - first;
+                pRecord->dirtyStart = first;
+            }
+            if ((pInfo->cache.maxDirtyBytes != 0) &&
+                (pInfo->cacheDirtyBytes >= pInfo->cache.maxDirtyBytes))
+            {
+                status = NvmCacheFlush(pInfo);
+            }
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCacheRead(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes, uint8_t *pData,
+                            uint8_t *pIsCached)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_CACHE_RECORD *pRecord;
+
+    *pIsCached = 0;
+    pRecord = NvmCacheFind(pInfo, addr, numBytes);
+    if (pRecord == NULL)
+    {
+        status = NvmCacheSync(pInfo, addr, numBytes + NUM_CRC_BYTES, 0);
+    }
+    else
+    {
+        *pIsCached = 1;
+        if (pRecord->isValid == 0)
+        {
+            status = NvmRead(pInfo, addr, numBytes, pRecord->pData);
+            if (status == ADI_NVM_STATUS_SUCCESS)
+            {
+                pRecord->isValid = 1;
+            }
+        }
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            memcpy(pData, pRecord->pData, numBytes);
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCacheSync(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes,
+                            uint8_t isWrite)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_CACHE_RECORD *pRecord;
+    uint32_t i;
+
+    if (pInfo->cache.pRecords != NULL)
+    {
+        for (i = 0; i < pInfo->cache.numRecords; i++)
+        {
+            pRecord = &pInfo->cache.pRecords[i];
+            if ((addr < pRecord->addr + pRecord->numBytes + NUM_CRC_BYTES) &&
+                (pRecord->addr < addr + numBytes))
+            {
+                // Write the modifications first so that the access sees them, or overrides them.
+                if (pRecord->isDirty == 1)
+                {
+                    status = NvmCacheFlushRecord(pInfo, pRecord);
+                    if (status != ADI_NVM_STATUS_SUCCESS)
+                    {
+                        break;
+                    }
+                }
+                if (isWrite == 1)
+                {
+                    pRecord->isValid = 0;
+                }
+            }
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCacheFlush(ADI_NVM_INFO *pInfo)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint32_t i;
+
+    if (pInfo->cache.pRecords != NULL)
+    {
+        for (i = 0; i < pInfo->cache.numRecords; i++)
+        {
+            if (pInfo->cache.pRecords[i].isDirty == 1)
+            {
+                status = NvmCacheFlushRecord(pInfo, &pInfo->cache.pRecords[i]);
+                if (status != ADI_NVM_STATUS_SUCCESS)
+                {
+                    break;
+                }
+            }
+        }
+        pInfo->cacheElapsed = 0;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCacheTick(ADI_NVM_INFO *pInfo, uint32_t elapsed)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+
+    if ((pInfo->cache.pRecords != NULL) && (pInfo->cache.flushPeriod != 0))
+    {
+        pInfo->cacheElapsed += elapsed;
+        if (pInfo->cacheElapsed >= pInfo->cache.flushPeriod)
+        {
+            status = NvmCacheFlush(pInfo);
+        }
+    }
+    return status;
+}
+
+ADI_NVM_CACHE_RECORD *NvmCacheFind(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes)
+{
+    ADI_NVM_CACHE_RECORD *pFound = NULL;
+    uint32_t i;
+
+    if (pInfo->cache.pRecords != NULL)
+    {
+        for (i = 0; i < pInfo->cache.numRecords; i++)
+        {
+            if ((pInfo->cache.pRecords[i].addr == addr) &&
+                (pInfo->cache.pRecords[i].numBytes == numBytes))
+            {
+                pFound = &pInfo->cache.pRecords[i];
+                break;
+            }
+        }
+    }
+    return pFound;
+}
+
+ADI_NVM_STATUS NvmCacheFlushRecord(ADI_NVM_INFO *pInfo, ADI_NVM_CACHE_RECORD *pRecord)
+{
+    ADI_NVM_STATUS status;
+
+    status =
+        NvmWriteRange(pInfo, pRecord->pData, pRecord->addr, pRecord->numBytes, pRecord->dirtyStart);
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pInfo->cacheDirtyBytes -= pRecord->numBytes - pRecord->dirtyStart;
+        pRecord->isDirty = 0;
+        pRecord->dirtyStart = 0;
+    }
+    return status;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,296 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file    nvm_commit.c
+ * @brief   Records committed alternately to two slots. Each slot is one NVM record:
+ *
+ *     [sequence : 4][numBytes : 2][header CRC : 2][data : numBytes][CRC : 2]
+ *
+ * The header CRC covers the sequence number and numBytes. The record CRC covers the header and
+ * data. A commit writes the data and the record CRC first and the header last, so a write torn
+ * before the header leaves the older header of the slot in place. The newest copy is selected from
+ * the headers and its record CRC is verified before it becomes active.
+ * @{
+ */
+
+#include "nvm_commit.h"
+#include "adi_nvm.h"
+#include "adi_nvm_private.h"
+#include "adi_nvm_status.h"
+#include "nvm_cache.h"
+#include "nvm_device.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/** Number of bytes of the header covered by the header CRC */
+#define NVM_COMMIT_HEADER_CRC_OFFSET 6
+
+/**
+ * @brief Checks the number of data bytes of a record.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pRecord       - pointer to the record
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_NUM_REGISTERS
+ */
+static ADI_NVM_STATUS NvmCommitCheckSize(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord);
+
+/**
+ * @brief Checks a slot header.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pRecord       - pointer to the record
+ * @param[in] pHeader       - pointer to #ADI_NVM_COMMIT_HEADER_NUM_BYTES bytes of header
+ * @param[out] pSequence    - sequence number of the header
+ * @return 1 if the header CRC matches and the header belongs to a record of this size.
+ */
+static uint8_t NvmCommitCheckHeader(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                                    uint8_t *pHeader, uint32_t *pSequence);
+
+/**
+ * @brief Reads a slot and checks its header and CRC.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pRecord       - pointer to the record
+ * @param[in] slot          - slot to read
+ * @param[out] pBuffer      - pointer to the header space followed by the data
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+static ADI_NVM_STATUS NvmCommitReadSlot(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                                        uint8_t slot, uint8_t *pBuffer);
+
+/**
+ * @brief Verifies the record CRC of a slot without copying it out.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pRecord       - pointer to the record
+ * @param[in] slot          - slot to verify
+ * @return  #ADI_NVM_STATUS_SUCCESS, also if the slot cannot be read through the internal buffers
+ * without pfUpdateCrc\n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+static ADI_NVM_STATUS NvmCommitVerifySlot(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                                          uint8_t slot);
+
+ADI_NVM_STATUS NvmCommitRecover(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord)
+{
+    ADI_NVM_STATUS status;
+    uint8_t header[ADI_NVM_COMMIT_HEADER_NUM_BYTES];
+    uint32_t sequence[2] = {0, 0};
+    uint32_t newestSequence = 0;
+    uint8_t isValid[2] = {0, 0};
+    uint8_t slot;
+
+    status = NvmCommitCheckSize(pInfo, pRecord);
+    for (slot = 0; (status == ADI_NVM_STATUS_SUCCESS) && (slot < 2); slot++)
+    {
+        status = NvmCacheSync(pInfo, pRecord->slotAddr[slot], ADI_NVM_COMMIT_HEADER_NUM_BYTES, 0);
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            status = NvmReadHeader(pInfo, pRecord->slotAddr[slot], ADI_NVM_COMMIT_HEADER_NUM_BYTES,
+                                   header);
+        }
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            isValid[slot] = NvmCommitCheckHeader(pInfo, pRecord, header, &sequence[slot]);
+        }
+    }
+
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        // The sequence number wraps, so the newer copy is the one ahead by less than half the
+        // range.
+        if ((isValid[0] == 1) && (isValid[1] == 1))
+        {
+            slot = ((int32_t)(sequence[1] - sequence[0]) > 0) ? 1 : 0;
+        }
+        else
+        {
+            slot = (isValid[1] == 1) ? 1 : 0;
+        }
+        newestSequence = sequence[slot];
+        // A valid header over torn data is skipped, so that the next commit overwrites that slot
+        // and not the other one, which may hold the only intact copy.
+        if (isValid[slot] == 1)
+        {
+            status = NvmCommitVerifySlot(pInfo, pRecord, slot);
+        }
+        if (status == ADI_NVM_STATUS_CRC_MISMATCH)
+        {
+            isValid[slot] = 0;
+            slot = (slot == 0) ? 1 : 0;
+            status = ADI_NVM_STATUS_SUCCESS;
+            if (isValid[slot] == 1)
+            {
+                status = NvmCommitVerifySlot(pInfo, pRecord, slot);
+            }
+        }
+        if (status == ADI_NVM_STATUS_CRC_MISMATCH)
+        {
+            isValid[slot] = 0;
+            status = ADI_NVM_STATUS_SUCCESS;
+        }
+    }
+
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pRecord->isValid = isValid[slot];
+        // A torn copy keeps its sequence number, so the next commit is numbered ahead of it.
+        pRecord->sequence = newestSequence;
+        // Without a copy the first commit goes to slot A.
+        pRecord->activeSlot = (isValid[slot] == 1) ? slot : 1;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCommitWrite(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                              uint8_t *pBuffer)
+{
+    ADI_NVM_STATUS status;
+    uint8_t slot = (pRecord->activeSlot == 0) ? 1 : 0;
+    uint32_t sequence = pRecord->sequence + 1;
+    uint32_t slotNumBytes = ADI_NVM_COMMIT_HEADER_NUM_BYTES + pRecord->numBytes;
+    uint16_t crc;
+
+    status = NvmCommitCheckSize(pInfo, pRecord);
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pBuffer[0] = (uint8_t)sequence;
+        pBuffer[1] = (uint8_t)(sequence >> 8);
+        pBuffer[2] = (uint8_t)(sequence >> 16);
+        pBuffer[3] = (uint8_t)(sequence >> 24);
+        pBuffer[4] = (uint8_t)pRecord->numBytes;
+        pBuffer[5] = (uint8_t)(pRecord->numBytes >> 8);
+        crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pBuffer,
+                                           NVM_COMMIT_HEADER_CRC_OFFSET);
+        pBuffer[6] = (uint8_t)(crc & 0xFF);
+        pBuffer[7] = (uint8_t)((crc >> 8) & 0xFF);
+        status = NvmCacheSync(pInfo, pRecord->slotAddr[slot], slotNumBytes + NUM_CRC_BYTES, 1);
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        // The data and the record CRC, which covers the new header, are written before the header,
+        // so until the header is complete the slot still carries its older sequence number.
+        status = NvmWriteRange(pInfo, pBuffer, pRecord->slotAddr[slot], slotNumBytes,
+                               ADI_NVM_COMMIT_HEADER_NUM_BYTES);
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        status = NvmWriteHeader(pInfo, pBuffer, pRecord->slotAddr[slot],
+                                ADI_NVM_COMMIT_HEADER_NUM_BYTES);
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pRecord->activeSlot = slot;
+        pRecord->sequence = sequence;
+        pRecord->isValid = 1;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCommitRead(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                             uint8_t *pBuffer)
+{
+    ADI_NVM_STATUS status;
+    uint8_t otherSlot = (pRecord->activeSlot == 0) ? 1 : 0;
+
+    status = NvmCommitCheckSize(pInfo, pRecord);
+    if ((status == ADI_NVM_STATUS_SUCCESS) && (pRecord->isValid == 0))
+    {
+        status = ADI_NVM_STATUS_CRC_MISMATCH;
+    }
+    else if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        status = NvmCommitReadSlot(pInfo, pRecord, pRecord->activeSlot, pBuffer);
+        if (status == ADI_NVM_STATUS_CRC_MISMATCH)
+        {
+            // The newest copy was torn, the previous one is still intact. sequence is kept so
+            // that the next commit overwrites the torn copy with a higher sequence number.
+            status = NvmCommitReadSlot(pInfo, pRecord, otherSlot, pBuffer);
+            if (status == ADI_NVM_STATUS_SUCCESS)
+            {
+                pRecord->activeSlot = otherSlot;
+            }
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCommitCheckSize(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    // numBytes is stored in 16 bits of the header.
+    if ((pRecord->numBytes == 0) || (pRecord->numBytes > 0xFFFF) ||
+        (pRecord->numBytes + ADI_NVM_COMMIT_HEADER_NUM_BYTES > pInfo->maxNumBytes))
+    {
+        status = ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    return status;
+}
+
+uint8_t NvmCommitCheckHeader(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                             uint8_t *pHeader, uint32_t *pSequence)
+{
+    uint8_t isValid = 0;
+    uint16_t crc;
+    uint16_t expectedCrc;
+    uint32_t numBytes;
+
+    crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pHeader, NVM_COMMIT_HEADER_CRC_OFFSET);
+    expectedCrc = ((uint16_t)pHeader[6]) | ((uint16_t)pHeader[7] << 8);
+    numBytes = ((uint32_t)pHeader[4]) | ((uint32_t)pHeader[5] << 8);
+    if ((crc == expectedCrc) && (numBytes == pRecord->numBytes))
+    {
+        *pSequence = ((uint32_t)pHeader[0]) | ((uint32_t)pHeader[1] << 8) |
+                     ((uint32_t)pHeader[2] << 16) | ((uint32_t)pHeader[3] << 24);
+        isValid = 1;
+    }
+    return isValid;
+}
+
+ADI_NVM_STATUS NvmCommitReadSlot(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                                 uint8_t slot, uint8_t *pBuffer)
+{
+    ADI_NVM_STATUS status;
+    uint32_t slotNumBytes = ADI_NVM_COMMIT_HEADER_NUM_BYTES + pRecord->numBytes;
+    uint32_t sequence;
+
+    status = NvmCacheSync(pInfo, pRecord->slotAddr[slot], slotNumBytes + NUM_CRC_BYTES, 0);
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        status = NvmRead(pInfo, pRecord->slotAddr[slot], slotNumBytes, pBuffer);
+    }
+    if ((status == ADI_NVM_STATUS_SUCCESS) &&
+        (NvmCommitCheckHeader(pInfo, pRecord, pBuffer, &sequence) == 0))
+    {
+        status = ADI_NVM_STATUS_CRC_MISMATCH;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCommitVerifySlot(ADI_NVM_INFO *pInfo, ADI_NVM_COMMIT_RECORD *pRecord,
+                                   uint8_t slot)
+{
+    ADI_NVM_STATUS status;
+    uint32_t slotNumBytes = ADI_NVM_COMMIT_HEADER_NUM_BYTES + pRecord->numBytes;
+
+    status = NvmCacheSync(pInfo, pRecord->slotAddr[slot], slotNumBytes + NUM_CRC_BYTES, 0);
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        status = NvmVerify(pInfo, pRecord->slotAddr[slot], slotNumBytes);
+    }
+    if (status == ADI_NVM_STATUS_INVALID_NUM_REGISTERS)
+    {
+        // Without pfUpdateCrc a slot of more than one transfer can only be checked by
+        // #NvmCommitRead. As the header is written last, the header alone still identifies the
+        // newest complete copy.
+        status = ADI_NVM_STATUS_SUCCESS;
+    }
+    return status;
+}
+
+/**
+ * @}
+ */
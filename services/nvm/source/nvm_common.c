@@ -16,29 +16,166 @@
 #include <stdint.h>
 #include <string.h>
 
+/**
+ * @brief Formats the command header for a chunk into txData.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] cmd           - command of the chunk
+ * @param[in] addr     	    - address of the record
+ * @param[in] offset        - offset of the chunk in the record
+ * @return Number of header bytes written to txData.
+ */
+static uint16_t NvmFormatChunk(ADI_NVM_INFO *pInfo, ADI_NVM_CMD cmd, uint32_t addr,
+                               uint32_t offset);
+
+/**
+ * @brief Fills txData with the header and data of the next chunk to be written. The CRC is added
+ * after the last chunk.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pData         - Pointer to data of the record
+ * @param[in] addr     	    - address of the record
+ * @param[in] offset        - offset of the chunk in the record
+ * @param[in] bytesRemain   - number of bytes of the record from offset
+ * @param[in] crc           - CRC of the record
+ * @param[out] pChunkSize   - number of data bytes in the chunk
+ * @return Number of bytes of txData to send.
+ */
+static uint32_t NvmPrepareWriteChunk(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr,
+                                     uint32_t offset, uint32_t bytesRemain, uint16_t crc,
+                                     uint32_t *pChunkSize);
+
+/**
+ * @brief Fills txData with the header of the next chunk to be read. The CRC is read after the
+ * last chunk.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] addr     	    - address of the record
+ * @param[in] offset        - offset of the chunk in the record
+ * @param[in] bytesRemain   - number of bytes of the record from offset
+ * @param[out] pChunkSize   - number of data bytes in the chunk
+ * @return Number of bytes to transfer.
+ */
+static uint32_t NvmPrepareReadChunk(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t offset,
+                                    uint32_t bytesRemain, uint32_t *pChunkSize);
+
+/**
+ * @brief Continues the CRC over a chunk received in rxData and copies it to pData. The last chunk
+ * is copied only if the CRC of the record matches, so a record of one chunk is left unchanged in
+ * pData on a mismatch. The earlier chunks of a larger record are already in pData, as the
+ * internal buffers hold only one transfer.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[out] pData        - Pointer to data of the record
+ * @param[in] numBytes      - number of bytes of the record
+ * @param[in] offset        - offset of the chunk in the record
+ * @param[in] chunkSize     - number of data bytes in the chunk
+ * @param[in,out] pCrc      - CRC of the record up to offset
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+static ADI_NVM_STATUS NvmCheckReadChunk(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t numBytes,
+                                        uint32_t offset, uint32_t chunkSize, uint16_t *pCrc);
+
+/**
+ * @brief Verifies the CRC of a record with its CRC following the data, before it is copied out.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pRecord       - Pointer to data of the record followed by its CRC
+ * @param[in] numBytes      - number of data bytes of the record
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+static ADI_NVM_STATUS NvmCheckRecord(ADI_NVM_INFO *pInfo, uint8_t *pRecord, uint32_t numBytes);
+
+/**
+ * @brief Verifies the CRC of a record received by a streaming read. The data is in pData and the
+ * CRC in rxData.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pData         - Pointer to data of the record
+ * @param[in] numBytes      - number of bytes of the record
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_CRC_MISMATCH
+ */
+static ADI_NVM_STATUS NvmCheckReadStream(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t numBytes);
+
+/**
+ * @brief Returns whether reads are done with a single streaming transfer.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @return 1 if the streaming read is used, 0 otherwise.
+ */
+static uint8_t NvmIsStreamRead(ADI_NVM_INFO *pInfo);
+
+/**
+ * @brief Starts the next transfer of the request at the head of the queue.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+static ADI_NVM_STATUS NvmQueueStartTransfer(ADI_NVM_INFO *pInfo);
+
+/**
+ * @brief Processes a completed transfer of the request at the head of the queue and finishes the
+ * request if it was the last transfer or if it failed.
+ * @param[in] pInfo 		- pointer to NVM data
+ */
+static void NvmQueueCompleteTransfer(ADI_NVM_INFO *pInfo);
+
+/**
+ * @brief Reports the status of the request at the head of the queue and removes it.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] status        - status of the request
+ */
+static void NvmQueueFinish(ADI_NVM_INFO *pInfo, ADI_NVM_STATUS status);
+
+/**
+ * @brief Starts transfers until one is in flight or the queue is empty.
+ * @param[in] pInfo 		- pointer to NVM data
+ */
+static void NvmQueueRun(ADI_NVM_INFO *pInfo);
+
 ADI_NVM_STATUS NvmInit(ADI_NVM_INFO *pInfo)
 {
     ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
-    status = NvmDeviceInit(pInfo);
+    const ADI_NVM_DEVICE *pDevice = pInfo->config.pDevice;
+    if (pDevice == NULL)
+    {
+        status = ADI_NVM_STATUS_NULL_PTR;
+    }
+    else
+    {
+        pInfo->pDevice = pDevice;
+        pInfo->pfFormat = pDevice->pfFormat;
+        pInfo->pfEraseFn = pDevice->pfErase;
+        pInfo->maxNumBytes = pDevice->maxNumBytes;
+        pInfo->rxOffset = pDevice->rxOffset;
+        pInfo->isContinuousAccess = pDevice->isContinuousAccess;
+        if (pDevice->pfInit != NULL)
+        {
+            status = pDevice->pfInit(pInfo);
+        }
+    }
     return status;
 }
 
 ADI_NVM_STATUS NvmWrite(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t numBytes)
+{
+    return NvmWriteRange(pInfo, pData, addr, numBytes, 0);
+}
+
+ADI_NVM_STATUS NvmWriteRange(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t numBytes,
+                             uint32_t startOffset)
 {
     ADI_NVM_STATUS nvmStatus = ADI_NVM_STATUS_SUCCESS;
     int32_t status = 0;
     uint16_t crc;
-    uint32_t maxChunkData = ADI_NVM_MAX_SIZE - 6;
-    uint16_t headerLen = 0;
-    NvmDeviceCmdFormat format;
-    if ((numBytes > pInfo->maxNumBytes) || (numBytes == 0))
+    if ((numBytes > pInfo->maxNumBytes) || (numBytes == 0) || (startOffset >= numBytes))
     {
         return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
     }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
     else
     {
-        uint32_t bytesRemain = numBytes;
-        uint32_t offset = 0;
+        uint32_t bytesRemain = numBytes - startOffset;
+        uint32_t offset = startOffset;
         uint32_t chunkSize;
         uint32_t numBytesToSend;
         crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, (uint8_t *)pData, numBytes);
@@ -47,33 +184,8 @@ ADI_NVM_STATUS NvmWrite(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint
         // for the last chunk data add CRC bytes.
         while (bytesRemain > 0)
         {
-            chunkSize = (bytesRemain > maxChunkData) ? maxChunkData : bytesRemain;
-            // formats the data to be sent
-            if (pInfo->pfFormat != NULL)
-            {
-                NvmDeviceCmdFormat *pFormat = &format;
-                pFormat->addr = addr;
-                pFormat->offset = offset;
-                pFormat->cmd = ADI_NVM_WRITE;
-                headerLen = pInfo->pfFormat(pFormat, pInfo->txData);
-            }
-            // Copy chunk data
-            memcpy(&pInfo->txData[headerLen], &pData[offset], chunkSize);
-
-            // Number of bytes to send: 4 address/offset + chunkSize
-            numBytesToSend = headerLen + chunkSize;
-
-            if (pInfo->isErase == 0)
-            {
-                // For the last chunk, add CRC bytes
-                if (bytesRemain == chunkSize)
-                {
-                    pInfo->txData[chunkSize + headerLen] = (uint8_t)(crc & 0xFF);
-                    pInfo->txData[chunkSize + headerLen + 1] = (uint8_t)((crc >> 8) & 0xFF);
-                    numBytesToSend += NUM_CRC_BYTES; // Add CRC bytes
-                }
-            }
-
+            numBytesToSend =
+                NvmPrepareWriteChunk(pInfo, pData, addr, offset, bytesRemain, crc, &chunkSize);
             status = pInfo->config.pfWrite(pInfo->config.hUser, &pInfo->txData[0], numBytesToSend);
             if (status != 0)
             {
@@ -94,16 +206,32 @@ ADI_NVM_STATUS NvmRead(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes, ui
     uint32_t numBytesToSend;
     uint32_t bytesRemain;
     uint32_t offset = 0;
-    uint32_t maxChunkData = ADI_NVM_MAX_SIZE - 6;
     uint32_t chunkSize;
-    uint16_t headerLen = 0;
-    uint16_t crc;
-    uint16_t expectedCrc;
-    NvmDeviceCmdFormat format;
+    uint16_t headerLen;
+    uint16_t crc = pInfo->config.crcSeed;
     if ((numBytes > pInfo->maxNumBytes) || (numBytes == 0))
     {
         return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
     }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
+    else if (NvmIsStreamRead(pInfo) == 1)
+    {
+        // Data is clocked straight into pData and the CRC that follows it into rxData.
+        headerLen = NvmFormatChunk(pInfo, ADI_NVM_READ, addr, 0);
+        status = pInfo->config.pfReadStream(pInfo->config.hUser, &pInfo->txData[0], headerLen,
+                                            pData, numBytes, &pInfo->rxData[0], NUM_CRC_BYTES);
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            status = NvmCheckReadStream(pInfo, pData, numBytes);
+        }
+        else
+        {
+            status = ADI_NVM_STATUS_COMM_ERROR;
+        }
+    }
     else
     {
         // If the numBytes is greater than the maximum chunk size, split the read into chunks and
@@ -111,62 +239,751 @@ ADI_NVM_STATUS NvmRead(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes, ui
         bytesRemain = numBytes;
         while (bytesRemain > 0)
         {
-            chunkSize = (bytesRemain > maxChunkData) ? maxChunkData : bytesRemain;
-            // formats the data to be sent
-            if (pInfo->pfFormat != NULL)
+            numBytesToSend = NvmPrepareReadChunk(pInfo, addr, offset, bytesRemain, &chunkSize);
+            status = pInfo->config.pfRead(pInfo->config.hUser, &pInfo->txData[0], numBytesToSend,
+                                          &pInfo->rxData[0]);
+            if (status != ADI_NVM_STATUS_SUCCESS)
             {
-                NvmDeviceCmdFormat *pFormat = &format;
-                pFormat->addr = addr;
-                pFormat->offset = offset;
-                pFormat->cmd = ADI_NVM_READ;
-                headerLen = pInfo->pfFormat(pFormat, pInfo->txData);
+                status = ADI_NVM_STATUS_COMM_ERROR;
+                break;
             }
-            // For the last chunk, verify CRC.
-            numBytesToSend = chunkSize + headerLen;
-            if (bytesRemain == chunkSize)
+            status = NvmCheckReadChunk(pInfo, pData, numBytes, offset, chunkSize, &crc);
+            if (status != ADI_NVM_STATUS_SUCCESS)
             {
-                numBytesToSend += NUM_CRC_BYTES;
+                break;
             }
-            status = pInfo->config.pfRead(pInfo->config.hUser, &pInfo->txData[0], numBytesToSend,
-                                          &pInfo->rxData[0]);
-            if (status == ADI_NVM_STATUS_SUCCESS)
+
+            offset += chunkSize;
+            bytesRemain -= chunkSize;
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmReadHeader(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes,
+                             uint8_t *pData)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint16_t headerLen;
+    int32_t transferStatus;
+
+    if ((numBytes > pInfo->maxChunkNumBytes) || (numBytes == 0))
+    {
+        return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
+    headerLen = NvmFormatChunk(pInfo, ADI_NVM_READ, addr, 0);
+    transferStatus = pInfo->config.pfRead(pInfo->config.hUser, &pInfo->txData[0],
+                                          headerLen + numBytes, &pInfo->rxData[0]);
+    if (transferStatus != 0)
+    {
+        status = ADI_NVM_STATUS_COMM_ERROR;
+    }
+    else
+    {
+        memcpy(pData, &pInfo->rxData[pInfo->rxOffset], numBytes);
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmWriteHeader(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr,
+                              uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint16_t headerLen;
+    int32_t transferStatus;
+
+    if ((numBytes > pInfo->maxChunkNumBytes) || (numBytes == 0))
+    {
+        return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
+    headerLen = NvmFormatChunk(pInfo, ADI_NVM_WRITE, addr, 0);
+    memcpy(&pInfo->txData[headerLen], pData, numBytes);
+    transferStatus =
+        pInfo->config.pfWrite(pInfo->config.hUser, &pInfo->txData[0], headerLen + numBytes);
+    if (transferStatus != 0)
+    {
+        status = ADI_NVM_STATUS_COMM_ERROR;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmVerify(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint32_t numBytesToSend;
+    uint32_t bytesRemain = numBytes;
+    uint32_t offset = 0;
+    uint32_t chunkSize = 0;
+    uint16_t crc = pInfo->config.crcSeed;
+    uint16_t expectedCrc;
+    uint8_t *pChunk = &pInfo->rxData[pInfo->rxOffset];
+
+    if ((numBytes > pInfo->maxNumBytes) || (numBytes == 0) ||
+        ((pInfo->config.pfUpdateCrc == NULL) && (numBytes > pInfo->maxChunkNumBytes)))
+    {
+        return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
+    while (bytesRemain > 0)
+    {
+        numBytesToSend = NvmPrepareReadChunk(pInfo, addr, offset, bytesRemain, &chunkSize);
+        if (pInfo->config.pfRead(pInfo->config.hUser, &pInfo->txData[0], numBytesToSend,
+                                 &pInfo->rxData[0]) != 0)
+        {
+            status = ADI_NVM_STATUS_COMM_ERROR;
+            break;
+        }
+        if (pInfo->config.pfUpdateCrc != NULL)
+        {
+            crc = pInfo->config.pfUpdateCrc(pInfo->config.hUser, crc, pChunk, chunkSize);
+        }
+        else
+        {
+            crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pChunk, chunkSize);
+        }
+        offset += chunkSize;
+        bytesRemain -= chunkSize;
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        // Extract the received 16-bit CRC (little-endian: low byte first)
+        expectedCrc = ((uint16_t)pChunk[chunkSize]) | ((uint16_t)pChunk[chunkSize + 1] << 8);
+        if (crc != expectedCrc)
+        {
+            status = ADI_NVM_STATUS_CRC_MISMATCH;
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmWriteBlock(ADI_NVM_INFO *pInfo, ADI_NVM_BLOCK_DATA *pBlockData, uint32_t addr)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint32_t numBytes = pBlockData->numBytes;
+    uint32_t recordSize = numBytes + NUM_CRC_BYTES;
+    uint32_t streamSize;
+    uint32_t streamOffset = 0;
+    uint32_t block = 0;
+    uint32_t blockOffset = 0;
+    uint32_t chunkSize;
+    uint32_t pos;
+    uint32_t n;
+    int32_t transferStatus;
+    uint16_t headerLen;
+    uint16_t crc = 0;
+    uint8_t *pBlock;
+    uint8_t *pChunk;
+
+    if ((numBytes > pInfo->maxNumBytes) || (numBytes == 0) || (pBlockData->numBlocks <= 0) ||
+        ((uint32_t)pBlockData->numBlocks > (pInfo->maxNumBytes + NUM_CRC_BYTES) / recordSize))
+    {
+        return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
+    // The records are consecutive in NVM, so [data][crc][data][crc]... is sent as one stream
+    // split only where txData is full.
+    streamSize = recordSize * (uint32_t)pBlockData->numBlocks;
+    while (streamOffset < streamSize)
+    {
+        chunkSize = streamSize - streamOffset;
+        if (chunkSize > pInfo->maxChunkNumBytes)
+        {
+            chunkSize = pInfo->maxChunkNumBytes;
+        }
+        headerLen = NvmFormatChunk(pInfo, ADI_NVM_WRITE, addr, streamOffset);
+        pChunk = &pInfo->txData[headerLen];
+        pos = 0;
+        while (pos < chunkSize)
+        {
+            pBlock = pBlockData->pData + pBlockData->incrAddress * block;
+            if (blockOffset < numBytes)
             {
-                if (bytesRemain == chunkSize)
+                if (blockOffset == 0)
                 {
-                    memcpy(&pInfo->tempBuffer[0], &pData[offset], chunkSize);
-                    memcpy(&pData[offset], &pInfo->rxData[pInfo->rxOffset], chunkSize);
-                    crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, (uint8_t *)pData,
-                                                       numBytes);
-                    // Extract the received 16-bit CRC (little-endian: low byte first)
-                    expectedCrc = ((uint16_t)pInfo->rxData[chunkSize + pInfo->rxOffset]) |
-                                  ((uint16_t)pInfo->rxData[chunkSize + pInfo->rxOffset + 1] << 8);
+                    crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pBlock, numBytes);
+                }
+                n = numBytes - blockOffset;
+                if (n > chunkSize - pos)
+                {
+                    n = chunkSize - pos;
+                }
+                memcpy(&pChunk[pos], &pBlock[blockOffset], n);
+            }
+            else
+            {
+                // CRC bytes, low byte first
+                pChunk[pos] = (uint8_t)(crc >> (8 * (blockOffset - numBytes)));
+                n = 1;
+            }
+            pos += n;
+            blockOffset += n;
+            if (blockOffset == recordSize)
+            {
+                block++;
+                blockOffset = 0;
+            }
+        }
+        transferStatus =
+            pInfo->config.pfWrite(pInfo->config.hUser, &pInfo->txData[0], headerLen + chunkSize);
+        if (transferStatus != 0)
+        {
+            status = ADI_NVM_STATUS_COMM_ERROR;
+            break;
+        }
+        streamOffset += chunkSize;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmReadBlock(ADI_NVM_INFO *pInfo, uint32_t addr, ADI_NVM_BLOCK_DATA *pBlockData)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint32_t numBytes = pBlockData->numBytes;
+    uint32_t recordSize = numBytes + NUM_CRC_BYTES;
+    uint32_t streamSize;
+    uint32_t streamOffset = 0;
+    uint32_t block = 0;
+    uint32_t blockOffset = 0;
+    uint32_t chunkSize;
+    uint32_t pos;
+    uint32_t n;
+    int32_t transferStatus;
+    uint16_t crc = pInfo->config.crcSeed;
+    uint16_t expectedCrc = 0;
+    uint8_t *pBlock;
+    uint8_t *pChunk;
+
+    if ((numBytes > pInfo->maxNumBytes) || (numBytes == 0) || (pBlockData->numBlocks <= 0) ||
+        ((uint32_t)pBlockData->numBlocks > (pInfo->maxNumBytes + NUM_CRC_BYTES) / recordSize))
+    {
+        return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
+    streamSize = recordSize * (uint32_t)pBlockData->numBlocks;
+    while ((streamOffset < streamSize) && (status == ADI_NVM_STATUS_SUCCESS))
+    {
+        chunkSize = streamSize - streamOffset;
+        if (chunkSize > pInfo->maxChunkNumBytes)
+        {
+            chunkSize = pInfo->maxChunkNumBytes;
+        }
+        n = chunkSize + NvmFormatChunk(pInfo, ADI_NVM_READ, addr, streamOffset);
+        transferStatus =
+            pInfo->config.pfRead(pInfo->config.hUser, &pInfo->txData[0], n, &pInfo->rxData[0]);
+        if (transferStatus != 0)
+        {
+            status = ADI_NVM_STATUS_COMM_ERROR;
+            break;
+        }
+        pChunk = &pInfo->rxData[pInfo->rxOffset];
+        pos = 0;
+        while ((pos < chunkSize) && (status == ADI_NVM_STATUS_SUCCESS))
+        {
+            pBlock = pBlockData->pData + pBlockData->incrAddress * block;
+            if ((blockOffset == 0) && (chunkSize - pos >= recordSize))
+            {
+                // The whole record is in rxData, copy it only if its CRC matches.
+                status = NvmCheckRecord(pInfo, &pChunk[pos], numBytes);
+                if (status == ADI_NVM_STATUS_SUCCESS)
+                {
+                    memcpy(pBlock, &pChunk[pos], numBytes);
+                }
+                n = recordSize;
+            }
+            else if (blockOffset < numBytes)
+            {
+                // The record continues in the next chunk, its data is checked in pData.
+                n = numBytes - blockOffset;
+                if (n > chunkSize - pos)
+                {
+                    n = chunkSize - pos;
+                }
+                if (pInfo->config.pfUpdateCrc != NULL)
+                {
+                    crc = pInfo->config.pfUpdateCrc(pInfo->config.hUser, crc, &pChunk[pos], n);
+                }
+                memcpy(&pBlock[blockOffset], &pChunk[pos], n);
+            }
+            else
+            {
+                // CRC bytes, low byte first
+                expectedCrc |= (uint16_t)((uint16_t)pChunk[pos] << (8 * (blockOffset - numBytes)));
+                n = 1;
+                if (blockOffset + 1 == recordSize)
+                {
+                    if (pInfo->config.pfUpdateCrc == NULL)
+                    {
+                        crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pBlock, numBytes);
+                    }
                     if (crc != expectedCrc)
                     {
-                        // retrieve the orginal content if the CRC is mismatched.
-                        memcpy(&pData[offset], &pInfo->tempBuffer[0], chunkSize);
                         status = ADI_NVM_STATUS_CRC_MISMATCH;
-                        break;
                     }
                 }
-                else
-                {
-                    // Not last chunk: just copy data
-                    memcpy(&pData[offset], &pInfo->rxData[pInfo->rxOffset], chunkSize);
-                }
+            }
+            pos += n;
+            blockOffset += n;
+            if (blockOffset == recordSize)
+            {
+                block++;
+                blockOffset = 0;
+                crc = pInfo->config.crcSeed;
+                expectedCrc = 0;
+            }
+        }
+        streamOffset += chunkSize;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmEraseBlock(ADI_NVM_INFO *pInfo, uint32_t addr, ADI_NVM_BLOCK_DATA *pBlockData)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint32_t streamSize;
+    uint32_t streamOffset = 0;
+    uint32_t chunkSize;
+    int32_t transferStatus;
+    uint16_t headerLen;
+
+    if ((pBlockData->numBytes == 0) || (pBlockData->numBlocks <= 0))
+    {
+        return ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        return ADI_NVM_STATUS_BUSY;
+    }
+    // The whole region is filled with 0xFF, data and CRC slots alike, so the number of
+    // transactions depends on the size of the region rather than on the number of blocks.
+    streamSize = (pBlockData->numBytes + NUM_CRC_BYTES) * (uint32_t)pBlockData->numBlocks;
+    while (streamOffset < streamSize)
+    {
+        chunkSize = streamSize - streamOffset;
+        if (chunkSize > pInfo->maxChunkNumBytes)
+        {
+            chunkSize = pInfo->maxChunkNumBytes;
+        }
+        headerLen = NvmFormatChunk(pInfo, ADI_NVM_WRITE, addr, streamOffset);
+        memset(&pInfo->txData[headerLen], 0xFF, chunkSize);
+        transferStatus =
+            pInfo->config.pfWrite(pInfo->config.hUser, &pInfo->txData[0], headerLen + chunkSize);
+        if (transferStatus != 0)
+        {
+            status = ADI_NVM_STATUS_COMM_ERROR;
+            break;
+        }
+        streamOffset += chunkSize;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmQueueRequest(ADI_NVM_INFO *pInfo, ADI_NVM_CMD cmd, uint8_t *pData,
+                               uint32_t addr, uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmRequest *pRequest;
+    if ((numBytes > pInfo->maxNumBytes) || (numBytes == 0))
+    {
+        status = ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if ((pInfo->queueWriteCount - pInfo->queueReadCount) >= ADI_NVM_QUEUE_NUM_REQUESTS)
+    {
+        status = ADI_NVM_STATUS_QUEUE_FULL;
+    }
+    else
+    {
+        pRequest = &pInfo->queue[pInfo->queueWriteCount % ADI_NVM_QUEUE_NUM_REQUESTS];
+        pRequest->cmd = cmd;
+        pRequest->pData = pData;
+        pRequest->addr = addr;
+        pRequest->numBytes = numBytes;
+        pInfo->queueWriteCount++;
+        // The queue is only marked idle once the callback has found it empty, so either the
+        // callback picks up this request or it is started here.
+        if (pInfo->isQueueActive == 0)
+        {
+            pInfo->isQueueActive = 1;
+            NvmQueueRun(pInfo);
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmQueueTransferDone(ADI_NVM_INFO *pInfo)
+{
+    if (pInfo->isQueueActive == 1)
+    {
+        if (pInfo->isQueueRunning == 1)
+        {
+            // The transport completed inside pfWriteAsync/pfReadAsync, NvmQueueRun continues the
+            // request.
+            pInfo->isTransferDone = 1;
+        }
+        else
+        {
+            NvmQueueCompleteTransfer(pInfo);
+            NvmQueueRun(pInfo);
+        }
+    }
+    return ADI_NVM_STATUS_SUCCESS;
+}
+
+void NvmQueueRun(ADI_NVM_INFO *pInfo)
+{
+    ADI_NVM_STATUS status;
+    // A transport that completes inside pfWriteAsync/pfReadAsync calls the callback before
+    // returning, and the blocking pfWrite/pfRead complete before returning. Either way only
+    // isTransferDone is set and the request is continued in this loop, so the stack does not grow
+    // with the number of chunks.
+    pInfo->isQueueRunning = 1;
+    while (pInfo->isQueueRunning == 1)
+    {
+        if (pInfo->queueReadCount == pInfo->queueWriteCount)
+        {
+            pInfo->isQueueRunning = 0;
+            pInfo->isQueueActive = 0;
+        }
+        else
+        {
+            pInfo->isTransferDone = 0;
+            status = NvmQueueStartTransfer(pInfo);
+            if (status != ADI_NVM_STATUS_SUCCESS)
+            {
+                NvmQueueFinish(pInfo, status);
             }
             else
             {
-                status = ADI_NVM_STATUS_COMM_ERROR;
-                break;
+                if (pInfo->isTransferDone == 0)
+                {
+                    pInfo->isQueueRunning = 0;
+                    // The transfer may have completed just before isQueueRunning was cleared.
+                    if (pInfo->isTransferDone == 1)
+                    {
+                        pInfo->isQueueRunning = 1;
+                    }
+                }
+                if (pInfo->isQueueRunning == 1)
+                {
+                    NvmQueueCompleteTransfer(pInfo);
+                }
             }
+        }
+    }
+}
 
-            offset += chunkSize;
-            bytesRemain -= chunkSize;
+ADI_NVM_STATUS NvmQueueStartTransfer(ADI_NVM_INFO *pInfo)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    int32_t transferStatus;
+    uint32_t numBytesToSend;
+    uint16_t headerLen;
+    NvmRequest *pRequest = &pInfo->queue[pInfo->queueReadCount % ADI_NVM_QUEUE_NUM_REQUESTS];
+    uint32_t bytesRemain = pRequest->numBytes - pInfo->requestOffset;
+
+    if (pRequest->cmd == ADI_NVM_WRITE)
+    {
+        if (pInfo->requestOffset == 0)
+        {
+            pInfo->requestCrc =
+                pInfo->config.pfCalculateCrc(pInfo->config.hUser, pRequest->pData,
+                                             pRequest->numBytes);
+        }
+        numBytesToSend = NvmPrepareWriteChunk(pInfo, pRequest->pData, pRequest->addr,
+                                              pInfo->requestOffset, bytesRemain,
+                                              pInfo->requestCrc, &pInfo->requestChunkSize);
+        if (pInfo->config.pfWriteAsync != NULL)
+        {
+            transferStatus = pInfo->config.pfWriteAsync(pInfo->config.hUser, &pInfo->txData[0],
+                                                        numBytesToSend);
+        }
+        else
+        {
+            transferStatus =
+                pInfo->config.pfWrite(pInfo->config.hUser, &pInfo->txData[0], numBytesToSend);
+            pInfo->isTransferDone = 1;
+        }
+    }
+    else if (NvmIsStreamRead(pInfo) == 1)
+    {
+        headerLen = NvmFormatChunk(pInfo, ADI_NVM_READ, pRequest->addr, 0);
+        pInfo->requestChunkSize = pRequest->numBytes;
+        if (pInfo->config.pfReadStreamAsync != NULL)
+        {
+            transferStatus = pInfo->config.pfReadStreamAsync(
+                pInfo->config.hUser, &pInfo->txData[0], headerLen, pRequest->pData,
+                pRequest->numBytes, &pInfo->rxData[0], NUM_CRC_BYTES);
+        }
+        else
+        {
+            transferStatus = pInfo->config.pfReadStream(pInfo->config.hUser, &pInfo->txData[0],
+                                                        headerLen, pRequest->pData,
+                                                        pRequest->numBytes, &pInfo->rxData[0],
+                                                        NUM_CRC_BYTES);
+            pInfo->isTransferDone = 1;
         }
     }
+    else
+    {
+        if (pInfo->requestOffset == 0)
+        {
+            pInfo->requestCrc = pInfo->config.crcSeed;
+        }
+        numBytesToSend = NvmPrepareReadChunk(pInfo, pRequest->addr, pInfo->requestOffset,
+                                             bytesRemain, &pInfo->requestChunkSize);
+        if (pInfo->config.pfReadAsync != NULL)
+        {
+            transferStatus = pInfo->config.pfReadAsync(pInfo->config.hUser, &pInfo->txData[0],
+                                                       numBytesToSend, &pInfo->rxData[0]);
+        }
+        else
+        {
+            transferStatus = pInfo->config.pfRead(pInfo->config.hUser, &pInfo->txData[0],
+                                                  numBytesToSend, &pInfo->rxData[0]);
+            pInfo->isTransferDone = 1;
+        }
+    }
+
+    if (transferStatus != 0)
+    {
+        status = ADI_NVM_STATUS_COMM_ERROR;
+    }
     return status;
 }
 
+void NvmQueueCompleteTransfer(ADI_NVM_INFO *pInfo)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmRequest *pRequest = &pInfo->queue[pInfo->queueReadCount % ADI_NVM_QUEUE_NUM_REQUESTS];
+
+    if (pRequest->cmd == ADI_NVM_READ)
+    {
+        if (NvmIsStreamRead(pInfo) == 1)
+        {
+            status = NvmCheckReadStream(pInfo, pRequest->pData, pRequest->numBytes);
+        }
+        else
+        {
+            status = NvmCheckReadChunk(pInfo, pRequest->pData, pRequest->numBytes,
+                                       pInfo->requestOffset, pInfo->requestChunkSize,
+                                       &pInfo->requestCrc);
+        }
+    }
+    pInfo->requestOffset += pInfo->requestChunkSize;
+    if ((status != ADI_NVM_STATUS_SUCCESS) || (pInfo->requestOffset == pRequest->numBytes))
+    {
+        NvmQueueFinish(pInfo, status);
+    }
+}
+
+void NvmQueueFinish(ADI_NVM_INFO *pInfo, ADI_NVM_STATUS status)
+{
+    NvmRequest *pRequest = &pInfo->queue[pInfo->queueReadCount % ADI_NVM_QUEUE_NUM_REQUESTS];
+    ADI_NVM_CMD cmd = pRequest->cmd;
+    uint8_t *pData = pRequest->pData;
+
+    pInfo->requestOffset = 0;
+    // Free the slot before the callback so that the callback can queue the next request.
+    pInfo->queueReadCount++;
+    if (pInfo->config.pfCallback != NULL)
+    {
+        pInfo->config.pfCallback(pInfo->config.hUser, cmd, pData, status);
+    }
+}
+
+uint16_t NvmFormatChunk(ADI_NVM_INFO *pInfo, ADI_NVM_CMD cmd, uint32_t addr, uint32_t offset)
+{
+    uint16_t headerLen = 0;
+    NvmDeviceCmdFormat format;
+    // formats the data to be sent
+    if (pInfo->pfFormat != NULL)
+    {
+        NvmDeviceCmdFormat *pFormat = &format;
+        pFormat->addr = addr;
+        pFormat->offset = offset;
+        pFormat->cmd = cmd;
+        headerLen = (uint16_t)pInfo->pfFormat(pFormat, pInfo->txData);
+    }
+    return headerLen;
+}
+
+uint32_t NvmPrepareWriteChunk(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t addr, uint32_t offset,
+                              uint32_t bytesRemain, uint16_t crc, uint32_t *pChunkSize)
+{
+    uint32_t chunkSize;
+    uint32_t numBytesToSend;
+    uint16_t headerLen;
+
+    chunkSize = (bytesRemain > pInfo->maxChunkNumBytes) ? pInfo->maxChunkNumBytes : bytesRemain;
+    headerLen = NvmFormatChunk(pInfo, ADI_NVM_WRITE, addr, offset);
+    // Copy chunk data
+    memcpy(&pInfo->txData[headerLen], &pData[offset], chunkSize);
+
+    // Number of bytes to send: 4 address/offset + chunkSize
+    numBytesToSend = headerLen + chunkSize;
+
+    if (pInfo->isErase == 0)
+    {
+        // For the last chunk, add CRC bytes
+        if (bytesRemain == chunkSize)
+        {
+            pInfo->txData[chunkSize + headerLen] = (uint8_t)(crc & 0xFF);
+            pInfo->txData[chunkSize + headerLen + 1] = (uint8_t)((crc >> 8) & 0xFF);
+            numBytesToSend += NUM_CRC_BYTES; // Add CRC bytes
+        }
+    }
+    *pChunkSize = chunkSize;
+    return numBytesToSend;
+}
+
+uint32_t NvmPrepareReadChunk(ADI_NVM_INFO *pInfo, uint32_t addr, uint32_t offset,
+                             uint32_t bytesRemain, uint32_t *pChunkSize)
+{
+    uint32_t chunkSize;
+    uint32_t numBytesToSend;
+
+    chunkSize = (bytesRemain > pInfo->maxChunkNumBytes) ? pInfo->maxChunkNumBytes : bytesRemain;
+    numBytesToSend = chunkSize + NvmFormatChunk(pInfo, ADI_NVM_READ, addr, offset);
+    // For the last chunk, verify CRC.
+    if (bytesRemain == chunkSize)
+    {
+        numBytesToSend += NUM_CRC_BYTES;
+    }
+    *pChunkSize = chunkSize;
+    return numBytesToSend;
+}
+
+ADI_NVM_STATUS NvmCheckReadChunk(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t numBytes,
+                                 uint32_t offset, uint32_t chunkSize, uint16_t *pCrc)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint16_t crc = *pCrc;
+    uint16_t expectedCrc;
+    uint8_t *pChunk = &pInfo->rxData[pInfo->rxOffset];
+
+    // CRC the chunk while it is still in rxData, so that it is copied to pData only once and the
+    // record is never checksummed a second time.
+    if (pInfo->config.pfUpdateCrc != NULL)
+    {
+        crc = pInfo->config.pfUpdateCrc(pInfo->config.hUser, crc, pChunk, chunkSize);
+    }
+    else if (chunkSize == numBytes)
+    {
+        crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pChunk, chunkSize);
+    }
+
+    if (offset + chunkSize == numBytes)
+    {
+        // Extract the received 16-bit CRC (little-endian: low byte first)
+        expectedCrc = ((uint16_t)pChunk[chunkSize]) | ((uint16_t)pChunk[chunkSize + 1] << 8);
+        if ((pInfo->config.pfUpdateCrc == NULL) && (chunkSize != numBytes))
+        {
+            // Without a streaming CRC the whole record has to be in pData before it can be
+            // checked, so keep the original content to restore it on a mismatch.
+            memcpy(&pInfo->tempBuffer[0], &pData[offset], chunkSize);
+            memcpy(&pData[offset], pChunk, chunkSize);
+            crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, (uint8_t *)pData, numBytes);
+            if (crc != expectedCrc)
+            {
+                // retrieve the orginal content if the CRC is mismatched.
+                memcpy(&pData[offset], &pInfo->tempBuffer[0], chunkSize);
+                status = ADI_NVM_STATUS_CRC_MISMATCH;
+            }
+        }
+        else if (crc != expectedCrc)
+        {
+            // The last chunk is left in rxData, pData keeps its content from before the read
+            // except for the earlier chunks of a larger record.
+            status = ADI_NVM_STATUS_CRC_MISMATCH;
+        }
+        else
+        {
+            memcpy(&pData[offset], pChunk, chunkSize);
+        }
+    }
+    else
+    {
+        // Not last chunk: just copy data
+        memcpy(&pData[offset], pChunk, chunkSize);
+    }
+    *pCrc = crc;
+    return status;
+}
+
+ADI_NVM_STATUS NvmCheckRecord(ADI_NVM_INFO *pInfo, uint8_t *pRecord, uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint16_t crc;
+    uint16_t expectedCrc;
+
+    if (pInfo->config.pfUpdateCrc != NULL)
+    {
+        crc = pInfo->config.pfUpdateCrc(pInfo->config.hUser, pInfo->config.crcSeed, pRecord,
+                                        numBytes);
+    }
+    else
+    {
+        crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pRecord, numBytes);
+    }
+    // Extract the received 16-bit CRC (little-endian: low byte first)
+    expectedCrc = ((uint16_t)pRecord[numBytes]) | ((uint16_t)pRecord[numBytes + 1] << 8);
+    if (crc != expectedCrc)
+    {
+        status = ADI_NVM_STATUS_CRC_MISMATCH;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmCheckReadStream(ADI_NVM_INFO *pInfo, uint8_t *pData, uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint16_t crc;
+    uint16_t expectedCrc;
+
+    if (pInfo->config.pfUpdateCrc != NULL)
+    {
+        crc = pInfo->config.pfUpdateCrc(pInfo->config.hUser, pInfo->config.crcSeed, pData,
+                                        numBytes);
+    }
+    else
+    {
+        crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pData, numBytes);
+    }
+    // Extract the received 16-bit CRC (little-endian: low byte first)
+    expectedCrc = ((uint16_t)pInfo->rxData[0]) | ((uint16_t)pInfo->rxData[1] << 8);
+    if (crc != expectedCrc)
+    {
+        status = ADI_NVM_STATUS_CRC_MISMATCH;
+    }
+    return status;
+}
+
+uint8_t NvmIsStreamRead(ADI_NVM_INFO *pInfo)
+{
+    uint8_t isStreamRead = 0;
+    if ((pInfo->config.pfReadStream != NULL) && (pInfo->isContinuousAccess == 1))
+    {
+        isStreamRead = 1;
+    }
+    return isStreamRead;
+}
+
 /**
  * @}
  */
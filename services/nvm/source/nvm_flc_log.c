@@ -0,0 +1,719 @@
+/******************************************************************************
+ Copyright (c) 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file    nvm_flc_log.c
+ * @brief   Log-structured record store for the flash of max32670.
+ *
+ * Each page of the log starts with a page header holding a magic number and a sequence number
+ * that increments with every page opened, so the order of the pages is found from the headers
+ * alone. Records follow the page header:
+ *
+ *     [record ID : 2][numBytes : 2][data : numBytes][CRC : 2][0xFF padding]
+ *
+ * The CRC covers the record ID, numBytes and data. Records are padded to the 128-bit flash
+ * program unit. An erased record ID marks the end of the page. A record with a bad CRC, for
+ * example one torn by a power failure, is skipped and the previous copy stays in use.
+ * @{
+ */
+
+#include "adi_nvm.h"
+#include "adi_nvm_log.h"
+#include "adi_nvm_private.h"
+#include "adi_nvm_status.h"
+#include "nvm_device.h"
+#include "nvm_flc_max32670.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/** Magic number of a page of the log */
+#define NVM_LOG_PAGE_MAGIC 0x474C564Eu
+/** Number of bytes of the page header */
+#define NVM_LOG_PAGE_HEADER_NUM_BYTES 16
+/** Number of bytes of the record header (record ID + numBytes) */
+#define NVM_LOG_RECORD_HEADER_NUM_BYTES 4
+/** Records are aligned to the flash program unit */
+#define NVM_LOG_ALIGN_NUM_BYTES 16
+/** Value of an erased record ID and numBytes */
+#define NVM_LOG_ERASED_FIELD 0xFFFFu
+/** Index entry of a record that is not in the log */
+#define NVM_LOG_NO_RECORD 0xFFFFFFFFu
+/** Number of bytes in flash of a record with numBytes data bytes */
+#define NVM_LOG_RECORD_SIZE(numBytes)                                                              \
+    (((numBytes) + NVM_LOG_RECORD_HEADER_NUM_BYTES + NUM_CRC_BYTES + NVM_LOG_ALIGN_NUM_BYTES -     \
+      1) &                                                                                         \
+     ~(uint32_t)(NVM_LOG_ALIGN_NUM_BYTES - 1))
+/** Index entry of the record at offset in page */
+#define NVM_LOG_LOCATION(page, offset) (((uint32_t)(page) << 16) | (uint32_t)(offset))
+
+/**
+ * @brief Reads bytes of a log page into rxData.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] page          - index of the page in the log
+ * @param[in] offset        - offset in the page
+ * @param[in] numBytes      - number of bytes to read
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+static ADI_NVM_STATUS NvmLogRead(ADI_NVM_INFO *pInfo, uint32_t page, uint32_t offset,
+                                 uint32_t numBytes);
+
+/**
+ * @brief Programs bytes placed in txData after the flash header into a log page.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] page          - index of the page in the log
+ * @param[in] offset        - offset in the page
+ * @param[in] numBytes      - number of bytes to program
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+static ADI_NVM_STATUS NvmLogProgram(ADI_NVM_INFO *pInfo, uint32_t page, uint32_t offset,
+                                    uint32_t numBytes);
+
+/**
+ * @brief Erases a log page.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] page          - index of the page in the log
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_PAGE_ERASE_FAILED
+ */
+static ADI_NVM_STATUS NvmLogErase(ADI_NVM_INFO *pInfo, uint32_t page);
+
+/**
+ * @brief Reads the header of a log page.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] page          - index of the page in the log
+ * @param[out] pSequence    - sequence number of the page
+ * @param[out] pIsActive    - set to 1 if the page belongs to the log
+ * @param[out] pIsErased    - set to 1 if the page header is erased
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+static ADI_NVM_STATUS NvmLogReadPageHeader(ADI_NVM_INFO *pInfo, uint32_t page,
+                                           uint32_t *pSequence, uint8_t *pIsActive,
+                                           uint8_t *pIsErased);
+
+/**
+ * @brief Adds the records of a page to the index.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] page          - index of the page in the log
+ * @param[out] pEndOffset   - offset after the last record of the page
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+static ADI_NVM_STATUS NvmLogScanPage(ADI_NVM_INFO *pInfo, uint32_t page, uint32_t *pEndOffset);
+
+/**
+ * @brief Programs the header of the next page and makes it the head of the log.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_LOG_FULL
+ */
+static ADI_NVM_STATUS NvmLogOpenPage(ADI_NVM_INFO *pInfo);
+
+/**
+ * @brief Programs a record at the end of the log and points the index to it.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] recordId      - ID of the record
+ * @param[in] pData         - pointer to data
+ * @param[in] numBytes      - number of data bytes
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_LOG_FULL
+ */
+static ADI_NVM_STATUS NvmLogAppend(ADI_NVM_INFO *pInfo, uint32_t recordId, uint8_t *pData,
+                                   uint32_t numBytes);
+
+/**
+ * @brief Copies the live records of the oldest page to the end of the log and erases it.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[out] pIsFreed     - set to 1 if the page held records that were not copied
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_PAGE_ERASE_FAILED \n
+ * #ADI_NVM_STATUS_LOG_FULL
+ */
+static ADI_NVM_STATUS NvmLogCompactTail(ADI_NVM_INFO *pInfo, uint8_t *pIsFreed);
+
+/**
+ * @brief Finds the head and tail of the log in flash, erases the pages outside of it and builds
+ * the index.
+ * @param[in] pInfo 		- pointer to NVM data
+ * @param[in] pLogConfig    - pointer to the log configuration
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_COMM_ERROR \n
+ * #ADI_NVM_STATUS_PAGE_ERASE_FAILED
+ */
+static ADI_NVM_STATUS NvmLogLoad(ADI_NVM_INFO *pInfo, ADI_NVM_LOG_CONFIG *pLogConfig);
+
+ADI_NVM_STATUS adi_nvm_LogInit(ADI_NVM_HANDLE hNvm, ADI_NVM_LOG_CONFIG *pLogConfig)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+
+    if ((hNvm == NULL) || (pLogConfig == NULL) || (pLogConfig->pIndex == NULL))
+    {
+        return ADI_NVM_STATUS_NULL_PTR;
+    }
+    // The flash header holds the page number in one byte and the record ID is 16 bits.
+    if ((pLogConfig->numPages < 2) || (pLogConfig->firstPage + pLogConfig->numPages > 256) ||
+        (pLogConfig->numRecordIds >= NVM_LOG_ERASED_FIELD))
+    {
+        return ADI_NVM_STATUS_INVALID_ADDRESS;
+    }
+    if (pInfo->pDevice != &adi_nvm_DeviceFlcMax32670)
+    {
+        // The page and offset addressing of the log is that of the flash.
+        return ADI_NVM_STATUS_INIT_FAILED;
+    }
+
+    ADI_RTOS_LOCK(pInfo->lock);
+    if (pInfo->isQueueActive == 1)
+    {
+        status = ADI_NVM_STATUS_BUSY;
+    }
+    else
+    {
+        status = NvmLogLoad(pInfo, pLogConfig);
+    }
+    ADI_RTOS_UNLOCK(pInfo->lock);
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_LogWrite(ADI_NVM_HANDLE hNvm, uint32_t recordId, uint8_t *pData,
+                                uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    NvmLog *pLog;
+    uint8_t isFreed = 1;
+
+    if ((hNvm == NULL) || (pData == NULL))
+    {
+        return ADI_NVM_STATUS_NULL_PTR;
+    }
+    pLog = &pInfo->log;
+    ADI_RTOS_LOCK(pInfo->lock);
+    if (pLog->config.pIndex == NULL)
+    {
+        status = ADI_NVM_STATUS_INIT_FAILED;
+    }
+    else if (recordId >= pLog->config.numRecordIds)
+    {
+        status = ADI_NVM_STATUS_INVALID_ADDRESS;
+    }
+    else if ((numBytes == 0) || (numBytes > ADI_NVM_LOG_MAX_RECORD_NUM_BYTES) ||
+             (NVM_LOG_RECORD_SIZE(numBytes) + FLASH_HEADER_NUM_BYTES > pInfo->transferNumBytes))
+    {
+        status = ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        status = ADI_NVM_STATUS_BUSY;
+    }
+    else
+    {
+        // Opening a page must leave one erased page for the next compaction.
+        while ((status == ADI_NVM_STATUS_SUCCESS) &&
+               (pLog->writeOffset + NVM_LOG_RECORD_SIZE(numBytes) > NVM_FLC_PAGE_SIZE) &&
+               (pLog->config.numPages - pLog->numActivePages < 2))
+        {
+            if (isFreed == 0)
+            {
+                status = ADI_NVM_STATUS_LOG_FULL;
+            }
+            else
+            {
+                status = NvmLogCompactTail(pInfo, &isFreed);
+            }
+        }
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            status = NvmLogAppend(pInfo, recordId, pData, numBytes);
+        }
+    }
+    ADI_RTOS_UNLOCK(pInfo->lock);
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_LogRead(ADI_NVM_HANDLE hNvm, uint32_t recordId, uint8_t *pData,
+                               uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    NvmLog *pLog;
+    uint32_t location;
+    uint8_t *pRecord;
+    uint16_t crc;
+    uint16_t expectedCrc;
+
+    if ((hNvm == NULL) || (pData == NULL))
+    {
+        return ADI_NVM_STATUS_NULL_PTR;
+    }
+    pLog = &pInfo->log;
+    ADI_RTOS_LOCK(pInfo->lock);
+    if (pLog->config.pIndex == NULL)
+    {
+        status = ADI_NVM_STATUS_INIT_FAILED;
+    }
+    else if (recordId >= pLog->config.numRecordIds)
+    {
+        status = ADI_NVM_STATUS_INVALID_ADDRESS;
+    }
+    else if ((numBytes == 0) || (numBytes > ADI_NVM_LOG_MAX_RECORD_NUM_BYTES) ||
+             (NVM_LOG_RECORD_SIZE(numBytes) + FLASH_HEADER_NUM_BYTES > pInfo->transferNumBytes))
+    {
+        status = ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        status = ADI_NVM_STATUS_BUSY;
+    }
+    else if (pLog->config.pIndex[recordId] == NVM_LOG_NO_RECORD)
+    {
+        status = ADI_NVM_STATUS_CRC_MISMATCH;
+    }
+    else
+    {
+        location = pLog->config.pIndex[recordId];
+        status = NvmLogRead(pInfo, location >> 16, location & 0xFFFF,
+                            NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes + NUM_CRC_BYTES);
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            pRecord = &pInfo->rxData[pInfo->rxOffset];
+            if ((((uint32_t)pRecord[2]) | ((uint32_t)pRecord[3] << 8)) != numBytes)
+            {
+                status = ADI_NVM_STATUS_INVALID_NUM_REGISTERS;
+            }
+            else
+            {
+                crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pRecord,
+                                                   NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes);
+                expectedCrc =
+                    ((uint16_t)pRecord[NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes]) |
+                    ((uint16_t)pRecord[NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes + 1] << 8);
+                if (crc != expectedCrc)
+                {
+                    status = ADI_NVM_STATUS_CRC_MISMATCH;
+                }
+                else
+                {
+                    memcpy(pData, &pRecord[NVM_LOG_RECORD_HEADER_NUM_BYTES], numBytes);
+                }
+            }
+        }
+    }
+    ADI_RTOS_UNLOCK(pInfo->lock);
+    return status;
+}
+
+ADI_NVM_STATUS adi_nvm_LogCompact(ADI_NVM_HANDLE hNvm)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    ADI_NVM_INFO *pInfo = (ADI_NVM_INFO *)hNvm;
+    NvmLog *pLog;
+    uint32_t numSparePages;
+    uint8_t isFreed;
+
+    if (hNvm == NULL)
+    {
+        return ADI_NVM_STATUS_NULL_PTR;
+    }
+    pLog = &pInfo->log;
+    ADI_RTOS_LOCK(pInfo->lock);
+    numSparePages = (pLog->config.numSparePages == 0) ? 1 : pLog->config.numSparePages;
+    if (pLog->config.pIndex == NULL)
+    {
+        status = ADI_NVM_STATUS_INIT_FAILED;
+    }
+    else if (pInfo->isQueueActive == 1)
+    {
+        status = ADI_NVM_STATUS_BUSY;
+    }
+    else if ((pLog->config.numPages - pLog->numActivePages < numSparePages) &&
+             (pLog->numActivePages > 1))
+    {
+        status = NvmLogCompactTail(pInfo, &isFreed);
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (isFreed == 0))
+        {
+            status = ADI_NVM_STATUS_LOG_FULL;
+        }
+    }
+    ADI_RTOS_UNLOCK(pInfo->lock);
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogLoad(ADI_NVM_INFO *pInfo, ADI_NVM_LOG_CONFIG *pLogConfig)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmLog *pLog;
+    uint32_t page;
+    uint32_t sequence;
+    uint32_t headSequence = 0;
+    uint32_t endOffset = NVM_LOG_PAGE_HEADER_NUM_BYTES;
+    uint32_t i;
+    uint8_t isActive;
+    uint8_t isErased;
+    uint8_t isFound = 0;
+
+    pLog = &pInfo->log;
+    pLog->config = *pLogConfig;
+    pLog->config.pIndex = NULL;
+    for (i = 0; i < pLogConfig->numRecordIds; i++)
+    {
+        pLogConfig->pIndex[i] = NVM_LOG_NO_RECORD;
+    }
+
+    // The head is the page with the highest sequence number.
+    for (page = 0; (status == ADI_NVM_STATUS_SUCCESS) && (page < pLogConfig->numPages); page++)
+    {
+        status = NvmLogReadPageHeader(pInfo, page, &sequence, &isActive, &isErased);
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (isActive == 1) &&
+            ((isFound == 0) || (sequence > headSequence)))
+        {
+            isFound = 1;
+            headSequence = sequence;
+            pLog->headPage = page;
+        }
+    }
+
+    // The log continues backwards from the head for as long as the sequence numbers do.
+    pLog->numActivePages = 0;
+    if ((status == ADI_NVM_STATUS_SUCCESS) && (isFound == 1))
+    {
+        page = pLog->headPage;
+        sequence = headSequence;
+        do
+        {
+            pLog->numActivePages++;
+            pLog->tailPage = page;
+            page = (page + pLogConfig->numPages - 1) % pLogConfig->numPages;
+            sequence--;
+            status = NvmLogReadPageHeader(pInfo, page, &i, &isActive, &isErased);
+        } while ((status == ADI_NVM_STATUS_SUCCESS) && (isActive == 1) && (i == sequence) &&
+                 (pLog->numActivePages < pLogConfig->numPages));
+    }
+
+    // Erase the pages outside of the log that are not blank, for example after a compaction
+    // that was interrupted before the erase.
+    for (i = pLog->numActivePages;
+         (status == ADI_NVM_STATUS_SUCCESS) && (i < pLog->config.numPages); i++)
+    {
+        page = (pLog->headPage + 1 + i - pLog->numActivePages) % pLogConfig->numPages;
+        if (isFound == 0)
+        {
+            page = i;
+        }
+        status = NvmLogReadPageHeader(pInfo, page, &sequence, &isActive, &isErased);
+        if ((status == ADI_NVM_STATUS_SUCCESS) && (isErased == 0))
+        {
+            status = NvmLogErase(pInfo, page);
+        }
+    }
+
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pLog->config.pIndex = pLogConfig->pIndex;
+        if (isFound == 0)
+        {
+            // Empty log: start it in the first page.
+            pLog->headPage = pLogConfig->numPages - 1;
+            pLog->tailPage = 0;
+            pLog->headSequence = 0;
+            status = NvmLogOpenPage(pInfo);
+        }
+        else
+        {
+            pLog->headSequence = headSequence;
+            for (i = 0; (status == ADI_NVM_STATUS_SUCCESS) && (i < pLog->numActivePages); i++)
+            {
+                page = (pLog->tailPage + i) % pLogConfig->numPages;
+                status = NvmLogScanPage(pInfo, page, &endOffset);
+            }
+            pLog->writeOffset = endOffset;
+        }
+        if (status != ADI_NVM_STATUS_SUCCESS)
+        {
+            pLog->config.pIndex = NULL;
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogRead(ADI_NVM_INFO *pInfo, uint32_t page, uint32_t offset, uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmDeviceCmdFormat format;
+    uint32_t headerLen;
+
+    format.cmd = ADI_NVM_READ;
+    format.addr = pInfo->log.config.firstPage + page;
+    format.offset = offset;
+    headerLen = pInfo->pfFormat(&format, pInfo->txData);
+    if (pInfo->config.pfRead(pInfo->config.hUser, &pInfo->txData[0], headerLen + numBytes,
+                             &pInfo->rxData[0]) != 0)
+    {
+        status = ADI_NVM_STATUS_COMM_ERROR;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogProgram(ADI_NVM_INFO *pInfo, uint32_t page, uint32_t offset,
+                             uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmDeviceCmdFormat format;
+    uint32_t headerLen;
+
+    format.cmd = ADI_NVM_WRITE;
+    format.addr = pInfo->log.config.firstPage + page;
+    format.offset = offset;
+    headerLen = pInfo->pfFormat(&format, pInfo->txData);
+    if (pInfo->config.pfWrite(pInfo->config.hUser, &pInfo->txData[0], headerLen + numBytes) != 0)
+    {
+        status = ADI_NVM_STATUS_COMM_ERROR;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogErase(ADI_NVM_INFO *pInfo, uint32_t page)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    // Same arguments as the erase of the flash backend.
+    if (pInfo->config.pfErase(pInfo, pInfo->log.config.firstPage + page) != 0)
+    {
+        status = ADI_NVM_STATUS_PAGE_ERASE_FAILED;
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogReadPageHeader(ADI_NVM_INFO *pInfo, uint32_t page, uint32_t *pSequence,
+                                    uint8_t *pIsActive, uint8_t *pIsErased)
+{
+    ADI_NVM_STATUS status;
+    uint8_t *pHeader;
+    uint32_t magic;
+    uint32_t i;
+
+    *pIsActive = 0;
+    *pIsErased = 1;
+    status = NvmLogRead(pInfo, page, 0, NVM_LOG_PAGE_HEADER_NUM_BYTES);
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pHeader = &pInfo->rxData[pInfo->rxOffset];
+        for (i = 0; i < NVM_LOG_PAGE_HEADER_NUM_BYTES; i++)
+        {
+            if (pHeader[i] != 0xFF)
+            {
+                *pIsErased = 0;
+            }
+        }
+        magic = ((uint32_t)pHeader[0]) | ((uint32_t)pHeader[1] << 8) |
+                ((uint32_t)pHeader[2] << 16) | ((uint32_t)pHeader[3] << 24);
+        *pSequence = ((uint32_t)pHeader[4]) | ((uint32_t)pHeader[5] << 8) |
+                     ((uint32_t)pHeader[6] << 16) | ((uint32_t)pHeader[7] << 24);
+        if (magic == NVM_LOG_PAGE_MAGIC)
+        {
+            *pIsActive = 1;
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogScanPage(ADI_NVM_INFO *pInfo, uint32_t page, uint32_t *pEndOffset)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    uint32_t offset = NVM_LOG_PAGE_HEADER_NUM_BYTES;
+    uint32_t recordId;
+    uint32_t numBytes;
+    uint16_t crc;
+    uint16_t expectedCrc;
+    uint8_t *pRecord = &pInfo->rxData[pInfo->rxOffset];
+
+    while (offset + NVM_LOG_RECORD_HEADER_NUM_BYTES <= NVM_FLC_PAGE_SIZE)
+    {
+        status = NvmLogRead(pInfo, page, offset, NVM_LOG_RECORD_HEADER_NUM_BYTES);
+        if (status != ADI_NVM_STATUS_SUCCESS)
+        {
+            break;
+        }
+        recordId = ((uint32_t)pRecord[0]) | ((uint32_t)pRecord[1] << 8);
+        numBytes = ((uint32_t)pRecord[2]) | ((uint32_t)pRecord[3] << 8);
+        if ((recordId == NVM_LOG_ERASED_FIELD) && (numBytes == NVM_LOG_ERASED_FIELD))
+        {
+            break;
+        }
+        if ((numBytes > ADI_NVM_LOG_MAX_RECORD_NUM_BYTES) ||
+            (offset + NVM_LOG_RECORD_SIZE(numBytes) > NVM_FLC_PAGE_SIZE))
+        {
+            // Torn record header, nothing more can be programmed in this page.
+            offset = NVM_FLC_PAGE_SIZE;
+            break;
+        }
+        if (NVM_LOG_RECORD_SIZE(numBytes) + FLASH_HEADER_NUM_BYTES > pInfo->transferNumBytes)
+        {
+            // Written with larger transfer buffers, it cannot be read with these.
+            offset += NVM_LOG_RECORD_SIZE(numBytes);
+            continue;
+        }
+        status = NvmLogRead(pInfo, page, offset,
+                            NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes + NUM_CRC_BYTES);
+        if (status != ADI_NVM_STATUS_SUCCESS)
+        {
+            break;
+        }
+        crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pRecord,
+                                           NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes);
+        expectedCrc = ((uint16_t)pRecord[NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes]) |
+                      ((uint16_t)pRecord[NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes + 1] << 8);
+        // Later copies are scanned later, so the index ends up at the latest valid copy.
+        if ((crc == expectedCrc) && (recordId < pInfo->log.config.numRecordIds))
+        {
+            pInfo->log.config.pIndex[recordId] = NVM_LOG_LOCATION(page, offset);
+        }
+        offset += NVM_LOG_RECORD_SIZE(numBytes);
+    }
+    *pEndOffset = offset;
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogOpenPage(ADI_NVM_INFO *pInfo)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmLog *pLog = &pInfo->log;
+    uint8_t *pHeader = &pInfo->txData[FLASH_HEADER_NUM_BYTES];
+    uint32_t page = (pLog->headPage + 1) % pLog->config.numPages;
+    uint32_t sequence = pLog->headSequence + 1;
+
+    if (pLog->numActivePages == pLog->config.numPages)
+    {
+        status = ADI_NVM_STATUS_LOG_FULL;
+    }
+    else
+    {
+        memset(pHeader, 0xFF, NVM_LOG_PAGE_HEADER_NUM_BYTES);
+        pHeader[0] = (uint8_t)NVM_LOG_PAGE_MAGIC;
+        pHeader[1] = (uint8_t)(NVM_LOG_PAGE_MAGIC >> 8);
+        pHeader[2] = (uint8_t)(NVM_LOG_PAGE_MAGIC >> 16);
+        pHeader[3] = (uint8_t)(NVM_LOG_PAGE_MAGIC >> 24);
+        pHeader[4] = (uint8_t)sequence;
+        pHeader[5] = (uint8_t)(sequence >> 8);
+        pHeader[6] = (uint8_t)(sequence >> 16);
+        pHeader[7] = (uint8_t)(sequence >> 24);
+        status = NvmLogProgram(pInfo, page, 0, NVM_LOG_PAGE_HEADER_NUM_BYTES);
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            pLog->headPage = page;
+            pLog->headSequence = sequence;
+            pLog->numActivePages++;
+            pLog->writeOffset = NVM_LOG_PAGE_HEADER_NUM_BYTES;
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogAppend(ADI_NVM_INFO *pInfo, uint32_t recordId, uint8_t *pData,
+                            uint32_t numBytes)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmLog *pLog = &pInfo->log;
+    uint8_t *pRecord = &pInfo->txData[FLASH_HEADER_NUM_BYTES];
+    uint32_t recordSize = NVM_LOG_RECORD_SIZE(numBytes);
+    uint32_t crcOffset = NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes;
+    uint16_t crc;
+
+    if (pLog->writeOffset + recordSize > NVM_FLC_PAGE_SIZE)
+    {
+        status = NvmLogOpenPage(pInfo);
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pRecord[0] = (uint8_t)recordId;
+        pRecord[1] = (uint8_t)(recordId >> 8);
+        pRecord[2] = (uint8_t)numBytes;
+        pRecord[3] = (uint8_t)(numBytes >> 8);
+        memcpy(&pRecord[NVM_LOG_RECORD_HEADER_NUM_BYTES], pData, numBytes);
+        crc = pInfo->config.pfCalculateCrc(pInfo->config.hUser, pRecord, crcOffset);
+        pRecord[crcOffset] = (uint8_t)(crc & 0xFF);
+        pRecord[crcOffset + 1] = (uint8_t)((crc >> 8) & 0xFF);
+        // Padding is left erased.
+        memset(&pRecord[crcOffset + NUM_CRC_BYTES], 0xFF, recordSize - crcOffset - NUM_CRC_BYTES);
+        status = NvmLogProgram(pInfo, pLog->headPage, pLog->writeOffset, recordSize);
+        if (status == ADI_NVM_STATUS_SUCCESS)
+        {
+            pLog->config.pIndex[recordId] = NVM_LOG_LOCATION(pLog->headPage, pLog->writeOffset);
+            pLog->writeOffset += recordSize;
+        }
+    }
+    return status;
+}
+
+ADI_NVM_STATUS NvmLogCompactTail(ADI_NVM_INFO *pInfo, uint8_t *pIsFreed)
+{
+    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
+    NvmLog *pLog = &pInfo->log;
+    uint32_t page = pLog->tailPage;
+    uint32_t offset = NVM_LOG_PAGE_HEADER_NUM_BYTES;
+    uint32_t recordId;
+    uint32_t numBytes;
+    uint8_t *pRecord = &pInfo->rxData[pInfo->rxOffset];
+
+    *pIsFreed = 0;
+    while ((status == ADI_NVM_STATUS_SUCCESS) &&
+           (offset + NVM_LOG_RECORD_HEADER_NUM_BYTES <= NVM_FLC_PAGE_SIZE))
+    {
+        status = NvmLogRead(pInfo, page, offset, NVM_LOG_RECORD_HEADER_NUM_BYTES);
+        if (status != ADI_NVM_STATUS_SUCCESS)
+        {
+            break;
+        }
+        recordId = ((uint32_t)pRecord[0]) | ((uint32_t)pRecord[1] << 8);
+        numBytes = ((uint32_t)pRecord[2]) | ((uint32_t)pRecord[3] << 8);
+        if ((numBytes > ADI_NVM_LOG_MAX_RECORD_NUM_BYTES) ||
+            (offset + NVM_LOG_RECORD_SIZE(numBytes) > NVM_FLC_PAGE_SIZE))
+        {
+            // End of the page or torn record.
+            break;
+        }
+        if ((recordId < pLog->config.numRecordIds) &&
+            (pLog->config.pIndex[recordId] == NVM_LOG_LOCATION(page, offset)))
+        {
+            // Latest copy of the record, move it to the head. The CRC was checked when the
+            // index was pointed to it.
+            status = NvmLogRead(pInfo, page, offset, NVM_LOG_RECORD_HEADER_NUM_BYTES + numBytes);
+            if (status == ADI_NVM_STATUS_SUCCESS)
+            {
+                status = NvmLogAppend(pInfo, recordId, &pRecord[NVM_LOG_RECORD_HEADER_NUM_BYTES],
+                                      numBytes);
+            }
+        }
+        else
+        {
+            *pIsFreed = 1;
+        }
+        offset += NVM_LOG_RECORD_SIZE(numBytes);
+    }
+    if (offset + NVM_LOG_RECORD_HEADER_NUM_BYTES <= NVM_FLC_PAGE_SIZE)
+    {
+        // Space left at the end of the page is reclaimed as well.
+        *pIsFreed = 1;
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        status = NvmLogErase(pInfo, page);
+    }
+    if (status == ADI_NVM_STATUS_SUCCESS)
+    {
+        pLog->tailPage = (page + 1) % pLog->config.numPages;
+        pLog->numActivePages--;
+    }
+    return status;
+}
+
+/**
+ * @}
+ */
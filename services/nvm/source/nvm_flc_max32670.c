@@ -12,15 +12,11 @@
 #include "adi_nvm_private.h"
 #include "adi_nvm_status.h"
 #include "nvm_device.h"
+#include "nvm_flc_max32670.h"
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
-/** Total size of the non-volatile memory */
-#define NVM_FLC_PAGE_SIZE 8192
-
-/** Number of bytes for the header to be included (pgeNum + offset) to send to Flash */
-#define FLASH_HEADER_NUM_BYTES 3
-
 /**
  * @brief Erases the non volatile memory device
  * @param[in] pInfo 		- pointer to NVM data
@@ -39,15 +35,14 @@ static ADI_NVM_STATUS NvmErase(void *pInfo, uint32_t addr);
  */
 static uint32_t NvmFormat(void *pFormat, uint8_t *pDst);
 
-ADI_NVM_STATUS NvmDeviceInit(ADI_NVM_INFO *pInfo)
-{
-    ADI_NVM_STATUS status = ADI_NVM_STATUS_SUCCESS;
-    pInfo->pfEraseFn = NvmErase;
-    pInfo->pfFormat = NvmFormat;
-    pInfo->maxNumBytes = NVM_FLC_PAGE_SIZE - FLASH_HEADER_NUM_BYTES - NUM_CRC_BYTES;
-    pInfo->rxOffset = 0;
-    return status;
-}
+const ADI_NVM_DEVICE adi_nvm_DeviceFlcMax32670 = {
+    .pfInit = NULL,
+    .pfFormat = NvmFormat,
+    .pfErase = NvmErase,
+    .maxNumBytes = NVM_FLC_PAGE_SIZE - FLASH_HEADER_NUM_BYTES - NUM_CRC_BYTES,
+    .rxOffset = 0,
+    .isContinuousAccess = 0,
+};
 
 ADI_NVM_STATUS NvmErase(void *pNvmInfo, uint32_t addr)
 {
@@ -51,6 +51,16 @@ static ADI_NVM_STATUS NvmErase(void *pInfo, uint32_t addr);
  */
 static uint32_t NvmFormat(void *pFormat, uint8_t *pDst);
 
+/**
+ *  @brief Reads the ID of the device and sets its write enable latch.
+ *
+ *  @param[in] pInfo 		- pointer to NVM data
+ * @return  #ADI_NVM_STATUS_SUCCESS\n
+ * #ADI_NVM_STATUS_INVALID_PRODUCT_ID \n
+ * #ADI_NVM_STATUS_COMM_ERROR
+ */
+static ADI_NVM_STATUS NvmDeviceInit(ADI_NVM_INFO *pInfo);
+
 /**
  * @brief List of FRAM Op-Code
  */
@@ -67,6 +77,16 @@ typedef enum
     MB58RS_SLEEP = 0xb9 /*! @brief Sleep mode. */
 } MB58RS_CMD;
 
+const ADI_NVM_DEVICE adi_nvm_DeviceMb85rs = {
+    .pfInit = NvmDeviceInit,
+    .pfFormat = NvmFormat,
+    .pfErase = NvmErase,
+    .maxNumBytes = NVM_MB85RS_SIZE - MB85RS_HEADER_NUM_BYTES - NUM_CRC_BYTES,
+    .rxOffset = MB85RS_HEADER_NUM_BYTES,
+    // READ and WRITE keep incrementing the address for as long as the clock runs.
+    .isContinuousAccess = 1,
+};
+
 ADI_NVM_STATUS NvmDeviceInit(ADI_NVM_INFO *pInfo)
 {
     ADI_NVM_STATUS status = ADI_NVM_STATUS_COMM_ERROR;
@@ -84,10 +104,6 @@ ADI_NVM_STATUS NvmDeviceInit(ADI_NVM_INFO *pInfo)
         {
             status = NvmSendCmdGetResponse(pInfo, MB58RS_WREN, 0, &dummyData);
         }
-        pInfo->pfFormat = NvmFormat;
-        pInfo->pfEraseFn = NvmErase;
-        pInfo->maxNumBytes = NVM_MB85RS_SIZE - MB85RS_HEADER_NUM_BYTES - NUM_CRC_BYTES;
-        pInfo->rxOffset = MB85RS_HEADER_NUM_BYTES;
     }
     return status;
 }